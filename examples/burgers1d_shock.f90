@@ -104,7 +104,7 @@ program traveling_shock
   integer,parameter :: controlDegree = 7
   integer,parameter :: targetDegree = 10
   real(prec),parameter :: nu = 0.01_prec ! diffusivity
-  real(prec),parameter :: dt = 1.0_prec*10.0_prec**(-5) ! time-step size
+  real(prec),parameter :: cfl = 0.5_prec ! cfl number used to set the time-step size
   real(prec),parameter :: endtime = 2.0_prec
   real(prec),parameter :: iointerval = 0.05_prec
   type(burgers1d_shock) :: modelobj
@@ -138,6 +138,8 @@ program traveling_shock
   modelobj%gradient_enabled = .true.
   !Set the diffusivity
   modelobj%nu = nu
+  ! Recompute the time step size from the cfl number at each io interval
+  modelobj%cfl = cfl
 
   ! Set the initial condition
   jump = modelobj%ul-modelobj%ur
@@ -160,9 +162,9 @@ program traveling_shock
   ! Set the model's time integration method
   call modelobj%SetTimeIntegrator(integrator)
 
-  ! forward step the model to `endtime` using a time step
-  ! of `dt` and outputing model data every `iointerval`
-  call modelobj%ForwardStep(endtime,dt,iointerval)
+  ! forward step the model to `endtime` using the largest stable
+  ! time step and outputing model data every `iointerval`
+  call modelobj%ForwardStep(endtime,modelobj%ComputeStableDt(cfl),iointerval)
 
   print*,"min, max (interior)", &
     minval(modelobj%solution%interior), &
@@ -47,10 +47,10 @@ program Euler_Example
   real(prec),parameter :: nu = 1.020408163_prec ! Viscosity
   real(prec),parameter :: kappa = 1.020408163_prec ! Thermal diffusivity (Pr = 1)
   ! Grid parameters
-  real(prec),parameter :: dx = 5.0_prec ! Grid spacing in the x-direction
-  real(prec),parameter :: dy = 5.0_prec ! Grid spacing in the y-direction
-  integer,parameter :: ny = 50 ! Number of x grid points per tile
-  integer,parameter :: nx = 50 ! Number of y grid points per tile
+  real(prec),parameter :: dx = 25.0_prec ! Grid spacing in the x-direction
+  real(prec),parameter :: dy = 25.0_prec ! Grid spacing in the y-direction
+  integer,parameter :: ny = 10 ! Number of x grid points per tile
+  integer,parameter :: nx = 10 ! Number of y grid points per tile
   integer,parameter :: nTx = 2 ! Number of tiles in the x-direction
   integer,parameter :: nTy = 2 ! Number of tiles in the y-direction
 
@@ -77,7 +77,7 @@ program Euler_Example
 
   ! Create an interpolant
   call interp%Init(N=controlDegree, &
-                   controlNodeType=GAUSS, &
+                   controlNodeType=GAUSS_LOBATTO, & ! Required by the flux differencing volume kernel
                    M=targetDegree, &
                    targetNodeType=UNIFORM)
 
@@ -89,7 +89,9 @@ program Euler_Example
   call modelobj%Init(mesh,geometry)
   modelobj%prescribed_bcs_enabled = .false. ! Disables prescribed boundary condition block for gpu accelerated implementations
   modelobj%tecplot_enabled = .false. ! Disable tecplot output
-  modelobj%primitive_gradient_enabled = .true. ! Enable primitive gradient calculation for momentum and energy diffusion
+  modelobj%gradient_enabled = .true. ! Enable the solution gradient calculation for momentum and energy diffusion
+  modelobj%nu = nu
+  modelobj%kappa = kappa
 
   ! Set up blast wave initial conditions
   call modelobj%ThermalBubble(rho0,rhoprime,Lr,P0,Eprime,Le,x0,y0)
@@ -41,10 +41,11 @@ program LinearEuler_Example
   character(SELF_INTEGRATOR_LENGTH),parameter :: integrator = 'rk3'
   integer,parameter :: controlDegree = 7
   integer,parameter :: targetDegree = 15
-  real(prec),parameter :: dt = 5.0_prec*10.0_prec**(-4) ! time-step size
+  real(prec),parameter :: cfl = 0.2_prec ! cfl number used to set the time-step size
   real(prec),parameter :: endtime = 0.1_prec
   real(prec),parameter :: iointerval = 0.1_prec
   real(prec) :: e0,ef ! Initial and final entropy
+  real(prec) :: dt ! time-step size
   type(LinearEuler3D) :: modelobj
   type(Lagrange),target :: interp
   type(Mesh3D),target :: mesh
@@ -91,6 +92,9 @@ program LinearEuler_Example
   ! Set the model's time integration method
   call modelobj%SetTimeIntegrator(integrator)
 
+  ! Set the time step size from the sound speed and the element size
+  dt = modelobj%ComputeStableDt(cfl)
+
   ! forward step the model to `endtime` using a time step
   ! of `dt` and outputing model data every `iointerval`
   call modelobj%ForwardStep(endtime,dt,iointerval)
@@ -65,23 +65,24 @@ class semquad:
     def load(self, hdf5File):
         """Loads in interpolant and geometry data from SELF model output"""
         import h5py
+        import pyself.links as links
         import dask.array as da
 
         self.interp.load(hdf5File)
 
         f = h5py.File(hdf5File, 'r')
         if 'controlgrid' in list(f.keys()):
-
-            d = f['controlgrid/geometry/x_dim1'] 
+            geometry = links.follow(f, 'controlgrid/geometry', hdf5File)
+            d = geometry['x_dim1'] 
             self.nElem = d.shape[0]
             N = d.shape[2]
             self.x = da.from_array(d, chunks=(self.daskChunkSize,N,N))
-            d = f['controlgrid/geometry/x_dim2'] 
+            d = geometry['x_dim2'] 
             self.y = da.from_array(d, chunks=(self.daskChunkSize,N,N))
             self.x_name = "x"
-            self.x_units = f['controlgrid/geometry/metadata/units/1']
+            self.x_units = geometry['metadata/units/1']
             self.y_name = "y"
-            self.y_units = f['controlgrid/geometry/metadata/units/1']
+            self.y_units = geometry['metadata/units/1']
 
 
         else:
@@ -107,27 +108,28 @@ class semhex:
     def load(self, hdf5File):
         """Loads in interpolant and geometry data from SELF model output"""
         import h5py
+        import pyself.links as links
         import dask.array as da
 
         self.interp.load(hdf5File)
 
         f = h5py.File(hdf5File, 'r')
         if 'controlgrid' in list(f.keys()):
-
-            d = f['controlgrid/geometry/x_dim1'] 
+            geometry = links.follow(f, 'controlgrid/geometry', hdf5File)
+            d = geometry['x_dim1'] 
             self.nElem = d.shape[0]
             N = d.shape[2]
             self.x = da.from_array(d, chunks=(self.daskChunkSize,N,N,N))
-            d = f['controlgrid/geometry/x_dim2'] 
+            d = geometry['x_dim2'] 
             self.y = da.from_array(d, chunks=(self.daskChunkSize,N,N,N))
-            d = f['controlgrid/geometry/x_dim3'] 
+            d = geometry['x_dim3'] 
             self.z = da.from_array(d, chunks=(self.daskChunkSize,N,N,N))
             self.x_name = "x"
-            self.x_units = f['controlgrid/geometry/metadata/units/1']
+            self.x_units = geometry['metadata/units/1']
             self.y_name = "y"
-            self.y_units = f['controlgrid/geometry/metadata/units/1']
+            self.y_units = geometry['metadata/units/1']
             self.y_name = "z"
-            self.y_units = f['controlgrid/geometry/metadata/units/1']
+            self.y_units = geometry['metadata/units/1']
 
 
         else:
@@ -36,15 +36,17 @@ class interp:
     def load(self, hdf5File):
         """Loads in interpolant data from SELF model output"""
         import h5py
+        import pyself.links as links
 
         f = h5py.File(hdf5File, 'r')
         if 'interp' in list(f.keys()):
-            self.controlPoints = f['interp/controlpoints']
-            self.bMatrix = f['interp/bmatrix']
-            self.dMatrix = f['interp/dmatrix'] 
-            self.dgMatrix = f['interp/dgmatrix']
-            self.iMatrix = f['interp/imatrix']
-            self.qweights = f['interp/qweights']
+            interp = links.follow(f, 'interp', hdf5File)
+            self.controlPoints = interp['controlpoints']
+            self.bMatrix = interp['bmatrix']
+            self.dMatrix = interp['dmatrix'] 
+            self.dgMatrix = interp['dgmatrix']
+            self.iMatrix = interp['imatrix']
+            self.qweights = interp['qweights']
             self.M = self.iMatrix.shape[0]-1
             self.N = self.controlPoints.shape[0]-1 # Polynomial degree is number of quadrature points minus 1
 
@@ -0,0 +1,20 @@
+#!/usr/bin/env python
+#
+
+
+def follow(f, name, hdf5File):
+    """Returns the object at name in the open h5py file f. When name is an
+    external link (as written by SELF when geometry_file_enabled is set), the
+    linked file is opened relative to the directory of hdf5File, so that the
+    pickup files can be read from any working directory."""
+    import os
+    import h5py
+
+    link = f.get(name, getlink=True)
+    if isinstance(link, h5py.ExternalLink):
+        target = link.filename
+        if not os.path.isabs(target):
+            target = os.path.join(os.path.dirname(os.path.abspath(hdf5File)), target)
+        return h5py.File(target, 'r')[link.path]
+    else:
+        return f[name]
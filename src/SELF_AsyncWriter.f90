@@ -0,0 +1,195 @@
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+!
+! Maintainers : support@fluidnumerics.com
+! Official Repository : https://github.com/FluidNumerics/self/
+!
+! Copyright © 2024 Fluid Numerics LLC
+!
+! Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+!
+! 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+!
+! 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in
+!    the documentation and/or other materials provided with the distribution.
+!
+! 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from
+!    this software without specific prior written permission.
+!
+! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+! LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+! HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+! LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+! THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+! THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+
+module SELF_AsyncWriter
+!! Nonblocking output of model snapshots.
+!!
+!! The file structure (groups, metadata and the dataset headers) is written with HDF5,
+!! and the datasets holding the snapshot are only allocated in the file. Once the file
+!! is closed to HDF5, each rank posts nonblocking MPI-IO writes of its part of the
+!! snapshot at the file offsets of the datasets. Time stepping continues while the writes
+!! are in flight; the snapshot buffers form a ring of `depth` slots, and a slot is only
+!! waited on when it is reused, when the model is read, or when the writer is freed.
+!!
+!! How much of the write overlaps with computation depends on the progress made by the
+!! MPI-IO implementation between calls into the MPI library.
+
+  use SELF_Constants
+  use mpi
+
+  implicit none
+
+  type,private :: AsyncWriterSlot
+    real(prec),allocatable :: buffer(:,:) ! Snapshot, in (degree of freedom, variable) layout
+    integer,allocatable :: requests(:)
+    integer :: fileHandle = MPI_FILE_NULL
+    logical :: inFlight = .false.
+  endtype AsyncWriterSlot
+
+  type,public :: AsyncWriter
+    integer :: depth = 0 ! Largest number of writes in flight
+    integer :: head = 0 ! Slot of the most recent snapshot
+    type(AsyncWriterSlot),allocatable :: slots(:)
+
+  contains
+
+    procedure,public :: Init => Init_AsyncWriter
+    procedure,public :: Free => Free_AsyncWriter
+    procedure,public :: Snapshot => Snapshot_AsyncWriter
+    procedure,public :: Post => Post_AsyncWriter
+    procedure,public :: Wait => Wait_AsyncWriter
+    procedure,public :: WaitAll => WaitAll_AsyncWriter
+
+  endtype AsyncWriter
+
+contains
+
+  subroutine Init_AsyncWriter(this,depth)
+    implicit none
+    class(AsyncWriter),intent(inout) :: this
+    integer,intent(in) :: depth
+
+    if(depth < 1) then
+      print*,__FILE__//" : The asynchronous output depth must be at least 1."
+      stop 1
+    endif
+
+    call this%Free()
+    this%depth = depth
+    this%head = 0
+    allocate(this%slots(1:depth))
+
+  endsubroutine Init_AsyncWriter
+
+  subroutine Free_AsyncWriter(this)
+    !! Completes the writes in flight and releases the snapshot buffers
+    implicit none
+    class(AsyncWriter),intent(inout) :: this
+
+    if(this%depth == 0) return
+
+    call this%WaitAll()
+    deallocate(this%slots)
+    this%depth = 0
+    this%head = 0
+
+  endsubroutine Free_AsyncWriter
+
+  subroutine Snapshot_AsyncWriter(this,s)
+    !! Copies s to the next snapshot buffer. If the write from that buffer is still in
+    !! flight, this blocks until it is complete.
+    implicit none
+    class(AsyncWriter),intent(inout) :: this
+    real(prec),intent(in) :: s(:,:)
+    ! Local
+    integer :: i
+
+    this%head = mod(this%head,this%depth)+1
+    call this%Wait(this%head)
+
+    associate(slot => this%slots(this%head))
+      if(allocated(slot%buffer)) then
+        if(any(shape(slot%buffer) /= shape(s))) deallocate(slot%buffer)
+      endif
+      if(.not. allocated(slot%buffer)) then
+        allocate(slot%buffer(1:size(s,1),1:size(s,2)))
+      endif
+      do concurrent(i=1:size(s,1))
+        slot%buffer(i,1:size(s,2)) = s(i,1:size(s,2))
+      enddo
+    endassociate
+
+  endsubroutine Snapshot_AsyncWriter
+
+  subroutine Post_AsyncWriter(this,fileName,mpiComm,mpiPrec,datasetOffset,localOffset)
+    !! Starts writing the most recent snapshot to fileName. Variable ivar of the snapshot
+    !! is written to the file at datasetOffset(ivar)+localOffset bytes, where datasetOffset
+    !! is the file offset of the dataset and localOffset is the offset of this rank's part
+    !! in the dataset. All ranks of mpiComm must call this method.
+    implicit none
+    class(AsyncWriter),intent(inout) :: this
+    character(*),intent(in) :: fileName
+    integer,intent(in) :: mpiComm
+    integer,intent(in) :: mpiPrec
+    integer(MPI_OFFSET_KIND),intent(in) :: datasetOffset(:)
+    integer(MPI_OFFSET_KIND),intent(in) :: localOffset
+    ! Local
+    integer :: ivar,nvar,ierror
+
+    associate(slot => this%slots(this%head))
+
+      call MPI_File_open(mpiComm,trim(fileName),MPI_MODE_WRONLY,MPI_INFO_NULL,slot%fileHandle,ierror)
+      if(ierror /= MPI_SUCCESS) then
+        print*,__FILE__//" : Failed to open "//trim(fileName)//" for asynchronous output."
+        stop 1
+      endif
+
+      nvar = size(slot%buffer,2)
+      if(allocated(slot%requests)) deallocate(slot%requests)
+      allocate(slot%requests(1:nvar))
+      do ivar = 1,nvar
+        call MPI_File_iwrite_at(slot%fileHandle,datasetOffset(ivar)+localOffset, &
+                                slot%buffer(1,ivar),size(slot%buffer,1),mpiPrec, &
+                                slot%requests(ivar),ierror)
+      enddo
+      slot%inFlight = .true.
+
+    endassociate
+
+  endsubroutine Post_AsyncWriter
+
+  subroutine Wait_AsyncWriter(this,islot)
+    !! Completes the write from slot islot, if there is one in flight, and closes its file
+    implicit none
+    class(AsyncWriter),intent(inout) :: this
+    integer,intent(in) :: islot
+    ! Local
+    integer :: ierror
+
+    associate(slot => this%slots(islot))
+      if(slot%inFlight) then
+        call MPI_Waitall(size(slot%requests),slot%requests,MPI_STATUSES_IGNORE,ierror)
+        call MPI_File_close(slot%fileHandle,ierror)
+        slot%inFlight = .false.
+      endif
+    endassociate
+
+  endsubroutine Wait_AsyncWriter
+
+  subroutine WaitAll_AsyncWriter(this)
+    !! Completes all writes in flight, oldest first
+    implicit none
+    class(AsyncWriter),intent(inout) :: this
+    ! Local
+    integer :: k
+
+    do k = 1,this%depth
+      call this%Wait(mod(this%head+k-1,this%depth)+1)
+    enddo
+
+  endsubroutine WaitAll_AsyncWriter
+
+endmodule SELF_AsyncWriter
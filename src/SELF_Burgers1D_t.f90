@@ -39,8 +39,12 @@ module self_Burgers1D_t
   contains
     procedure :: SetMetadata => SetMetadata_Burgers1D_t
     procedure :: entropy_func => entropy_func_Burgers1D_t
+    procedure :: maxWaveSpeed => maxWaveSpeed_Burgers1D_t
+    procedure :: maxDiffusivity => maxDiffusivity_Burgers1D_t
     procedure :: flux1d => flux1d_Burgers1D_t
     procedure :: riemannflux1d => riemannflux1d_Burgers1D_t
+    procedure :: flux1d_batch => flux1d_batch_Burgers1D_t
+    procedure :: riemannflux1d_batch => riemannflux1d_batch_Burgers1D_t
 
   endtype Burgers1D_t
 
@@ -63,6 +67,25 @@ contains
 
   endfunction entropy_func_Burgers1D_t
 
+  pure function maxWaveSpeed_Burgers1D_t(this,s) result(c)
+    !! The characteristic speed of Burgers' equation is the solution itself
+    class(Burgers1D_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%solution%nvar)
+    real(prec) :: c
+
+    c = abs(s(1))
+
+  endfunction maxWaveSpeed_Burgers1D_t
+
+  pure function maxDiffusivity_Burgers1D_t(this,s) result(nu)
+    class(Burgers1D_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%solution%nvar)
+    real(prec) :: nu
+
+    nu = this%nu
+
+  endfunction maxDiffusivity_Burgers1D_t
+
   pure function flux1d_Burgers1D_t(this,s,dsdx) result(flux)
     class(Burgers1D_t),intent(in) :: this
     real(prec),intent(in) :: s(1:this%solution%nvar)
@@ -93,4 +116,41 @@ contains
 
   endfunction riemannflux1d_Burgers1D_t
 
+  pure subroutine flux1d_batch_Burgers1D_t(this,s,dsdx,flux)
+    class(Burgers1D_t),intent(in) :: this
+    real(prec),intent(in) :: s(:,:)
+    real(prec),intent(in) :: dsdx(:,:)
+    real(prec),intent(out) :: flux(:,:)
+    ! Local
+    integer :: n
+
+    do concurrent(n=1:size(s,1))
+      flux(n,1) = 0.5_prec*s(n,1)*s(n,1)-this%nu*dsdx(n,1)
+    enddo
+
+  endsubroutine flux1d_batch_Burgers1D_t
+
+  pure subroutine riemannflux1d_batch_Burgers1D_t(this,sL,sR,dsdx,nhat,flux)
+    class(Burgers1D_t),intent(in) :: this
+    real(prec),intent(in) :: sL(:,:)
+    real(prec),intent(in) :: sR(:,:)
+    real(prec),intent(in) :: dsdx(:,:)
+    real(prec),intent(in) :: nhat(:)
+    real(prec),intent(out) :: flux(:,:)
+    ! Local
+    integer :: n
+    real(prec) :: fL,fR,cmax
+
+    ! Local Lax-Friedrich's flux
+    do concurrent(n=1:size(sL,1))
+      fL = 0.5_prec*sL(n,1)*sL(n,1)*nhat(n)
+      fR = 0.5_prec*sR(n,1)*sR(n,1)*nhat(n)
+      cmax = max(abs(sL(n,1)*nhat(n)),abs(sR(n,1)*nhat(n))) ! maximum wave speed
+
+      flux(n,1) = 0.5_prec*(fL+fR)+cmax*(sL(n,1)-sR(n,1)) & ! advective flux
+                  -this%nu*dsdx(n,1)*nhat(n)
+    enddo
+
+  endsubroutine riemannflux1d_batch_Burgers1D_t
+
 endmodule self_Burgers1D_t
@@ -45,6 +45,11 @@ module SELF_DGModel1D_t
     type(MappedScalar1D) :: fluxDivergence
     type(MappedScalar1D) :: dSdt
     type(MappedScalar1D) :: workSol
+    type(MappedScalar1D) :: erkStages
+    type(MappedScalar1D) :: abHistory
+    type(MappedScalar1D) :: imexWork
+    real(prec),allocatable :: lengthScale(:) ! Element length scale used by ComputeStableDt
+    integer,allocatable :: rateLevel(:) ! Element rate level used by the multirate integrators
     type(Mesh1D),pointer :: mesh
     type(Geometry1D),pointer :: geometry
 
@@ -66,9 +71,33 @@ module SELF_DGModel1D_t
     procedure :: UpdateGRK2 => UpdateGRK2_DGModel1D_t
     procedure :: UpdateGRK3 => UpdateGRK3_DGModel1D_t
     procedure :: UpdateGRK4 => UpdateGRK4_DGModel1D_t
+    procedure :: UpdateGLSRK => UpdateGLSRK_DGModel1D_t
+
+    procedure :: ReserveERKStages => ReserveERKStages_DGModel1D_t
+    procedure :: StoreERKStage => StoreERKStage_DGModel1D_t
+    procedure :: UpdateERK => UpdateERK_DGModel1D_t
+    procedure :: ERKErrorNorm => ERKErrorNorm_DGModel1D_t
+
+    procedure :: ReserveABHistory => ReserveABHistory_DGModel1D_t
+    procedure :: UpdateGAB => UpdateGAB_DGModel1D_t
+
+    procedure :: ReserveIMEXSlots => ReserveIMEXSlots_DGModel1D_t
+    procedure :: StoreIMEX => StoreIMEX_DGModel1D_t
+    procedure :: LoadIMEX => LoadIMEX_DGModel1D_t
+    procedure :: CombineIMEX => CombineIMEX_DGModel1D_t
+    procedure :: DotIMEX => DotIMEX_DGModel1D_t
+    procedure :: RandomIMEX => RandomIMEX_DGModel1D_t
+
+    procedure :: CalculateLengthScale => CalculateLengthScale_DGModel1D_t
+    procedure :: ElementStableDt => ElementStableDt_DGModel1D_t
+    procedure :: ComputeStableDt => ComputeStableDt_DGModel1D_t
+    procedure :: SetMultirateLevels => SetMultirateLevels_DGModel1D_t
+    procedure :: UpdateGMRAB => UpdateGMRAB_DGModel1D_t
 
     procedure :: CalculateSolutionGradient => CalculateSolutionGradient_DGModel1D_t
+    procedure :: CalculateFluxDivergence => CalculateFluxDivergence_DGModel1D_t
     procedure :: CalculateTendency => CalculateTendency_DGModel1D_t
+    procedure :: CalculateExplicitTendency => CalculateExplicitTendency_DGModel1D_t
 
     generic :: SetSolution => SetSolutionFromChar_DGModel1D_t, &
       SetSolutionFromEqn_DGModel1D_t
@@ -106,6 +135,10 @@ contains
     call this%flux%AssociateGeometry(geometry)
     call this%fluxDivergence%AssociateGeometry(geometry)
 
+    call this%CalculateLengthScale()
+    allocate(this%rateLevel(1:this%mesh%nElem))
+    this%rateLevel = 0
+
     call this%AdditionalInit()
 
     call this%SetMetadata()
@@ -145,6 +178,20 @@ contains
     call this%flux%Free()
     call this%source%Free()
     call this%fluxDivergence%Free()
+    if(allocated(this%lengthScale)) deallocate(this%lengthScale)
+    if(allocated(this%rateLevel)) deallocate(this%rateLevel)
+    if(this%erk_nslots > 0) then
+      call this%erkStages%Free()
+      this%erk_nslots = 0
+    endif
+    if(this%ab_nslots > 0) then
+      call this%abHistory%Free()
+      this%ab_nslots = 0
+    endif
+    if(this%imex_nslots > 0) then
+      call this%imexWork%Free()
+      this%imex_nslots = 0
+    endif
     call this%AdditionalFree()
 
   endsubroutine Free_DGModel1D_t
@@ -221,7 +268,8 @@ contains
 
       this%workSol%interior(i,iEl,iVar) = rk2_a(m)* &
                                           this%workSol%interior(i,iEl,iVar)+ &
-                                          this%dSdt%interior(i,iEl,iVar)
+                                          this%source%interior(i,iEl,iVar)- &
+                                          this%fluxDivergence%interior(i,iEl,iVar)
 
       this%solution%interior(i,iEl,iVar) = &
         this%solution%interior(i,iEl,iVar)+ &
@@ -243,7 +291,8 @@ contains
 
       this%workSol%interior(i,iEl,iVar) = rk3_a(m)* &
                                           this%workSol%interior(i,iEl,iVar)+ &
-                                          this%dSdt%interior(i,iEl,iVar)
+                                          this%source%interior(i,iEl,iVar)- &
+                                          this%fluxDivergence%interior(i,iEl,iVar)
 
       this%solution%interior(i,iEl,iVar) = &
         this%solution%interior(i,iEl,iVar)+ &
@@ -265,7 +314,8 @@ contains
 
       this%workSol%interior(i,iEl,iVar) = rk4_a(m)* &
                                           this%workSol%interior(i,iEl,iVar)+ &
-                                          this%dSdt%interior(i,iEl,iVar)
+                                          this%source%interior(i,iEl,iVar)- &
+                                          this%fluxDivergence%interior(i,iEl,iVar)
 
       this%solution%interior(i,iEl,iVar) = &
         this%solution%interior(i,iEl,iVar)+ &
@@ -275,6 +325,469 @@ contains
 
   endsubroutine UpdateGRK4_DGModel1D_t
 
+  subroutine UpdateGLSRK_DGModel1D_t(this,m)
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+    integer,intent(in) :: m
+    ! Local
+    integer :: i,iEl,iVar
+
+    do concurrent(i=1:this%solution%N+1, &
+                  iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+
+      this%workSol%interior(i,iEl,iVar) = this%lsrk_a(m)* &
+                                          this%workSol%interior(i,iEl,iVar)+ &
+                                          this%source%interior(i,iEl,iVar)- &
+                                          this%fluxDivergence%interior(i,iEl,iVar)
+
+      this%solution%interior(i,iEl,iVar) = &
+        this%solution%interior(i,iEl,iVar)+ &
+        this%lsrk_g(m)*this%dt*this%workSol%interior(i,iEl,iVar)
+
+    enddo
+
+  endsubroutine UpdateGLSRK_DGModel1D_t
+
+  subroutine ReserveERKStages_DGModel1D_t(this)
+    !! Allocates the stage slots used by the embedded Runge-Kutta pairs. Slot m holds
+    !! variables m*nvar+1 through (m+1)*nvar of erkStages, so that each slot is a
+    !! contiguous block of memory
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+
+    if(this%erk_nslots /= this%erk_nstages+1) then
+      if(this%erk_nslots > 0) call this%erkStages%Free()
+      call this%erkStages%Init(this%geometry%x%interp, &
+                               this%nvar*(this%erk_nstages+1), &
+                               this%mesh%nElem)
+      this%erk_nslots = this%erk_nstages+1
+    endif
+
+  endsubroutine ReserveERKStages_DGModel1D_t
+
+  subroutine StoreERKStage_DGModel1D_t(this,m)
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+    integer,intent(in) :: m
+    ! Local
+    integer :: i,iEl,iVar
+
+    if(m == 0) then
+      call this%ReserveERKStages()
+      do concurrent(i=1:this%solution%N+1, &
+                  iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+        this%erkStages%interior(i,iEl,iVar) = this%solution%interior(i,iEl,iVar)
+      enddo
+    else
+      do concurrent(i=1:this%solution%N+1, &
+                  iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+        this%erkStages%interior(i,iEl,iVar+m*this%nvar) = this%dSdt%interior(i,iEl,iVar)
+      enddo
+    endif
+
+  endsubroutine StoreERKStage_DGModel1D_t
+
+  subroutine UpdateERK_DGModel1D_t(this,w)
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+    real(prec),intent(in) :: w(:)
+    ! Local
+    integer :: i,iEl,iVar,m
+    real(prec) :: s
+
+    do concurrent(i=1:this%solution%N+1, &
+                  iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+
+      s = this%erkStages%interior(i,iEl,iVar)
+      do m = 1,size(w)
+        s = s+w(m)*this%erkStages%interior(i,iEl,iVar+m*this%nvar)
+      enddo
+      this%solution%interior(i,iEl,iVar) = s
+
+    enddo
+
+  endsubroutine UpdateERK_DGModel1D_t
+
+  function ERKErrorNorm_DGModel1D_t(this,w) result(err)
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+    real(prec),intent(in) :: w(:)
+    real(prec) :: err
+    ! Local
+    integer :: i,iEl,iVar,m
+    real(prec) :: e,sc,esum
+
+    esum = 0.0_prec
+    do ivar = 1,this%solution%nVar
+      do iel = 1,this%mesh%nElem
+        do i = 1,this%solution%interp%N+1
+          e = 0.0_prec
+          do m = 1,size(w)
+            e = e+w(m)*this%erkStages%interior(i,iEl,iVar+m*this%nvar)
+          enddo
+          sc = this%abstol+this%reltol*max(abs(this%erkStages%interior(i,iEl,iVar)), &
+                                           abs(this%solution%interior(i,iEl,iVar)))
+          esum = esum+(e/sc)**2
+        enddo
+      enddo
+    enddo
+
+    err = sqrt(esum/real(this%solution%nVar*this%solution%nElem*(this%solution%interp%N+1),prec))
+
+  endfunction ERKErrorNorm_DGModel1D_t
+
+  subroutine ReserveABHistory_DGModel1D_t(this)
+    !! Allocates the tendency history used by the Adams-Bashforth methods. History slot m
+    !! holds variables m*nvar+1 through (m+1)*nvar of abHistory
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+    ! Local
+    integer :: ivar
+    character(LEN=3) :: ivarChar
+
+    if(this%ab_nslots /= this%ab_order) then
+      if(this%ab_nslots > 0) call this%abHistory%Free()
+      call this%abHistory%Init(this%geometry%x%interp, &
+                               this%nvar*this%ab_order, &
+                               this%mesh%nElem)
+      do ivar = 1,this%abHistory%nvar
+        write(ivarChar,'(I3.3)') ivar
+        call this%abHistory%SetName(ivar,"dsdt"//trim(ivarChar))
+      enddo
+      this%ab_nslots = this%ab_order
+    endif
+
+  endsubroutine ReserveABHistory_DGModel1D_t
+
+  subroutine UpdateGAB_DGModel1D_t(this,w)
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+    real(prec),intent(in) :: w(:)
+    ! Local
+    integer :: i,iEl,iVar,m
+    integer :: head
+    real(prec) :: s
+
+    call this%ReserveABHistory()
+    head = this%ab_head*this%nvar
+
+    do concurrent(i=1:this%solution%N+1, &
+                  iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+
+      this%abHistory%interior(i,iEl,iVar+head) = this%dSdt%interior(i,iEl,iVar)
+      s = 0.0_prec
+      do m = 1,size(w)
+        s = s+w(m)*this%abHistory%interior(i,iEl,iVar+(m-1)*this%nvar)
+      enddo
+      this%dSdt%interior(i,iEl,iVar) = s
+
+    enddo
+
+  endsubroutine UpdateGAB_DGModel1D_t
+
+  subroutine ReserveIMEXSlots_DGModel1D_t(this)
+    !! Allocates the vector slots used by the IMEX methods. Slot m holds variables
+    !! m*nvar+1 through (m+1)*nvar of imexWork. The slots are only held on the host.
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+
+    if(this%imex_nslots /= this%imex_nvectors) then
+      if(this%imex_nslots > 0) call this%imexWork%Free()
+      call this%imexWork%Init(this%geometry%x%interp, &
+                              this%nvar*this%imex_nvectors, &
+                              this%mesh%nElem)
+      this%imex_nslots = this%imex_nvectors
+    endif
+
+  endsubroutine ReserveIMEXSlots_DGModel1D_t
+
+  subroutine StoreIMEX_DGModel1D_t(this,slot,fromTendency)
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+    integer,intent(in) :: slot
+    logical,intent(in) :: fromTendency
+    ! Local
+    integer :: i,iEl,iVar
+
+    call this%ReserveIMEXSlots()
+    if(fromTendency) then
+      call this%dSdt%UpdateHost()
+      do concurrent(i=1:this%solution%N+1, &
+                  iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+        this%imexWork%interior(i,iEl,iVar+slot*this%nvar) = this%dSdt%interior(i,iEl,iVar)
+      enddo
+    else
+      call this%solution%UpdateHost()
+      do concurrent(i=1:this%solution%N+1, &
+                  iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+        this%imexWork%interior(i,iEl,iVar+slot*this%nvar) = this%solution%interior(i,iEl,iVar)
+      enddo
+    endif
+
+  endsubroutine StoreIMEX_DGModel1D_t
+
+  subroutine LoadIMEX_DGModel1D_t(this,slot)
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+    integer,intent(in) :: slot
+    ! Local
+    integer :: i,iEl,iVar
+
+    do concurrent(i=1:this%solution%N+1, &
+                  iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+      this%solution%interior(i,iEl,iVar) = this%imexWork%interior(i,iEl,iVar+slot*this%nvar)
+    enddo
+    call this%solution%UpdateDevice()
+
+  endsubroutine LoadIMEX_DGModel1D_t
+
+  subroutine CombineIMEX_DGModel1D_t(this,slot,slots,w)
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+    integer,intent(in) :: slot
+    integer,intent(in) :: slots(:)
+    real(prec),intent(in) :: w(:)
+    ! Local
+    integer :: i,iEl,iVar,m
+    real(prec) :: s
+
+    call this%ReserveIMEXSlots()
+    do concurrent(i=1:this%solution%N+1, &
+                  iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+
+      s = 0.0_prec
+      do m = 1,size(slots)
+        s = s+w(m)*this%imexWork%interior(i,iEl,iVar+slots(m)*this%nvar)
+      enddo
+      this%imexWork%interior(i,iEl,iVar+slot*this%nvar) = s
+
+    enddo
+
+  endsubroutine CombineIMEX_DGModel1D_t
+
+  function DotIMEX_DGModel1D_t(this,a,b) result(d)
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+    integer,intent(in) :: a
+    integer,intent(in) :: b
+    real(prec) :: d
+    ! Local
+    integer :: i,iEl,iVar
+    real(prec) :: dloc
+
+    dloc = 0.0_prec
+    do ivar = 1,this%solution%nVar
+      do iel = 1,this%mesh%nElem
+        do i = 1,this%solution%interp%N+1
+        dloc = dloc+this%imexWork%interior(i,iEl,iVar+a*this%nvar)* &
+               this%imexWork%interior(i,iEl,iVar+b*this%nvar)
+        enddo
+      enddo
+    enddo
+
+    d = dloc
+
+  endfunction DotIMEX_DGModel1D_t
+
+  subroutine RandomIMEX_DGModel1D_t(this,slot)
+    !! Fills the given vector slot with random values, uniformly distributed in [-1,1]
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+    integer,intent(in) :: slot
+    ! Local
+    integer :: v1,v2
+
+    call this%ReserveIMEXSlots()
+    v1 = slot*this%nvar+1
+    v2 = (slot+1)*this%nvar
+    call random_number(this%imexWork%interior(:,:,v1:v2))
+    this%imexWork%interior(:,:,v1:v2) = 2.0_prec*this%imexWork%interior(:,:,v1:v2)-1.0_prec
+
+  endsubroutine RandomIMEX_DGModel1D_t
+
+  subroutine CalculateLengthScale_DGModel1D_t(this)
+    !! Sets the length scale of each element to its width, 2*dx/ds, where
+    !! dx/ds is the smallest value of the metric term in the element
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+    ! Local
+    integer :: iel
+
+    if(allocated(this%lengthScale)) deallocate(this%lengthScale)
+    allocate(this%lengthScale(1:this%mesh%nElem))
+
+    do concurrent(iel=1:this%mesh%nElem)
+      this%lengthScale(iel) = 2.0_prec*minval(abs(this%geometry%dxds%interior(:,iel,1)))
+    enddo
+
+  endsubroutine CalculateLengthScale_DGModel1D_t
+
+  subroutine ElementStableDt_DGModel1D_t(this,cfl,dtElem)
+    !! Sets dtElem to the largest time step size that satisfies
+    !!
+    !!   dt*( c*(N+1)^2/h + nu*(N+1)^4/h^2 ) <= cfl
+    !!
+    !! in each element, where h is the element length scale and c and nu are the
+    !! largest values of maxWaveSpeed and maxDiffusivity in the element. The diffusive
+    !! limit is only applied when gradient_enabled is set. Elements where the model
+    !! reports no wave speed or diffusivity are set to huge(1.0_prec).
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+    real(prec),intent(in) :: cfl
+    real(prec),intent(out) :: dtElem(1:this%mesh%nElem)
+    ! Local
+    integer :: i,iel
+    real(prec) :: s(1:this%nvar)
+    real(prec) :: c,nu,np,rate
+
+    call this%solution%UpdateHost()
+
+    np = real(this%solution%interp%N+1,prec)**2
+    do iel = 1,this%mesh%nElem
+      c = 0.0_prec
+      nu = 0.0_prec
+      do i = 1,this%solution%interp%N+1
+        s = this%solution%interior(i,iel,1:this%nvar)
+        c = max(c,this%maxWaveSpeed(s))
+        if(this%gradient_enabled) nu = max(nu,this%maxDiffusivity(s))
+      enddo
+      rate = c*np/this%lengthScale(iel)+nu*(np/this%lengthScale(iel))**2
+      if(rate > 0.0_prec) then
+        dtElem(iel) = cfl/rate
+      else
+        dtElem(iel) = huge(1.0_prec)
+      endif
+    enddo
+
+  endsubroutine ElementStableDt_DGModel1D_t
+
+  function ComputeStableDt_DGModel1D_t(this,cfl) result(dt)
+    !! Returns the smallest stable time step size of the elements (see ElementStableDt).
+    !! When the model reports no wave speed or diffusivity, the current time step size
+    !! is returned.
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+    real(prec),intent(in) :: cfl
+    real(prec) :: dt
+    ! Local
+    real(prec) :: dtElem(1:this%mesh%nElem)
+    real(prec) :: dtloc
+
+    call this%ElementStableDt(cfl,dtElem)
+    dtloc = minval(dtElem)
+
+    dt = dtloc
+
+    if(dt == huge(1.0_prec)) dt = this%dt
+
+  endfunction ComputeStableDt_DGModel1D_t
+
+  subroutine SetMultirateLevels_DGModel1D_t(this,cfl,maxLevels)
+    !! Assigns each element to the rate level floor(log2(dtElem/dtMin)), capped at
+    !! maxLevels-1, where dtElem is the stable time step size of the element for the cfl
+    !! number (see ElementStableDt) and dtMin is the smallest one. Elements
+    !! where the model reports no wave speed or diffusivity are put on the slowest level.
+    !! The time step size dt is set to dtMin, the step size of level 0.
+    !!
+    !! The levels are kept until this method is called again. When cfl > 0, ForwardStep
+    !! only resets dt, which should then remain close to dtMin.
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+    real(prec),intent(in) :: cfl
+    integer,intent(in) :: maxLevels
+    ! Local
+    integer :: iel,l,nlevels
+    integer :: nPerLevel(0:SELF_MAX_RATE_LEVELS-1)
+    real(prec) :: dtElem(1:this%mesh%nElem)
+    real(prec) :: dtMin,work
+
+    if(maxLevels < 1 .or. maxLevels > SELF_MAX_RATE_LEVELS) then
+      print*,__FILE__//" : maxLevels must be between 1 and ",SELF_MAX_RATE_LEVELS
+      stop 1
+    endif
+
+    call this%ElementStableDt(cfl,dtElem)
+    dtMin = minval(dtElem)
+
+    ! Elements without a stable time step size are set once the slowest level is known
+    do iel = 1,this%mesh%nElem
+      if(dtElem(iel) == huge(1.0_prec)) then
+        this%rateLevel(iel) = -1
+      else
+        ! Ratios within ab_steptol of a power of two are rounded up to it
+        this%rateLevel(iel) = min(floor(log((1.0_prec+ab_steptol)*dtElem(iel)/dtMin)/log(2.0_prec)), &
+                                  maxLevels-1)
+      endif
+    enddo
+    nlevels = maxval(this%rateLevel)+1
+    nlevels = max(nlevels,1)
+    where(this%rateLevel < 0) this%rateLevel = nlevels-1
+
+    this%lts_nlevels = nlevels
+    this%lts_nhistory = 0
+    this%lts_head = 0
+    if(dtMin < huge(1.0_prec)) this%dt = dtMin
+
+    nPerLevel = 0
+    do iel = 1,this%mesh%nElem
+      nPerLevel(this%rateLevel(iel)) = nPerLevel(this%rateLevel(iel))+1
+    enddo
+
+    ! Element tendency evaluations per macro step, relative to stepping all elements with dt
+    work = 0.0_prec
+    do l = 0,nlevels-1
+      work = work+real(nPerLevel(l),prec)/real(2**l,prec)
+    enddo
+    work = work/real(max(sum(nPerLevel),1),prec)
+
+    do l = 0,nlevels-1
+      print*,__FILE__//" : Rate level ",l," : ",nPerLevel(l)," elements, dt = ",this%dt*real(2**l,prec)
+    enddo
+    print*,__FILE__//" : Element updates relative to single rate stepping : ",work
+
+  endsubroutine SetMultirateLevels_DGModel1D_t
+
+  subroutine UpdateGMRAB_DGModel1D_t(this,w,activeLevel,predict)
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+    real(prec),intent(in) :: w(:,0:)
+    integer,intent(in) :: activeLevel
+    logical,intent(in) :: predict
+    ! Local
+    integer :: i,iEl,iVar,m,l
+    real(prec) :: s
+
+    call this%ReserveABHistory()
+    ! The rate levels are only held on the host
+    call this%solution%UpdateHost()
+    call this%dSdt%UpdateHost()
+    call this%workSol%UpdateHost()
+    call this%abHistory%UpdateHost()
+
+    do concurrent(i=1:this%solution%N+1, &
+                  iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+
+      l = this%rateLevel(iel)
+      if(l <= activeLevel) then
+        this%workSol%interior(i,iel,ivar) = this%solution%interior(i,iel,ivar)
+        this%abHistory%interior(i,iel,ivar+this%lts_head(l)*this%nvar) = this%dSdt%interior(i,iel,ivar)
+      endif
+      if(predict) then
+        s = 0.0_prec
+        do m = 1,size(w,1)
+          s = s+w(m,l)*this%abHistory%interior(i,iel,ivar+(m-1)*this%nvar)
+        enddo
+        this%solution%interior(i,iel,ivar) = this%workSol%interior(i,iel,ivar)+s
+      endif
+
+    enddo
+
+    call this%solution%UpdateDevice()
+    call this%workSol%UpdateDevice()
+    call this%abHistory%UpdateDevice()
+
+  endsubroutine UpdateGMRAB_DGModel1D_t
+
   subroutine CalculateSolutionGradient_DGModel1D_t(this)
     implicit none
     class(DGModel1D_t),intent(inout) :: this
@@ -447,76 +960,92 @@ contains
     implicit none
     class(DGModel1D_t),intent(inout) :: this
     ! Local
-    integer :: iel
-    integer :: iside
-    real(prec) :: fin(1:this%solution%nvar)
-    real(prec) :: fout(1:this%solution%nvar)
-    real(prec) :: dfdx(1:this%solution%nvar),nhat
-
-    do concurrent(iside=1:2,iel=1:this%mesh%nElem)
-
-      ! set the normal velocity
-      if(iside == 1) then
-        nhat = -1.0_prec
-      else
-        nhat = 1.0_prec
-      endif
-
-      fin = this%solution%boundary(iside,iel,1:this%solution%nvar) ! interior solution
-      fout = this%solution%extboundary(iside,iel,1:this%solution%nvar) ! exterior solution
-      dfdx = this%solutionGradient%avgboundary(iside,iel,1:this%solution%nvar) ! average solution gradient (with direction taken into account)
-      this%flux%boundarynormal(iside,iel,1:this%solution%nvar) = &
-        this%riemannflux1d(fin,fout,dfdx,nhat)
+    integer :: e1,e2,n1,n2,ndof,n
+    real(prec),pointer :: fin(:,:),fout(:,:),dfdx(:,:),fb(:,:)
+    real(prec),allocatable :: nhat(:)
+
+    ndof = 2*this%mesh%nElem
+    allocate(nhat(1:ndof))
+    fin(1:ndof,1:this%solution%nvar) => this%solution%boundary ! interior solution
+    fout(1:ndof,1:this%solution%nvar) => this%solution%extboundary ! exterior solution
+    dfdx(1:ndof,1:this%solution%nvar) => this%solutionGradient%avgboundary ! average solution gradient
+    fb(1:ndof,1:this%solution%nvar) => this%flux%boundarynormal
+
+    ! set the normal velocity; side 1 is the left side of each element
+    do concurrent(n=1:ndof)
+      nhat(n) = real(2*mod(n-1,2)-1,prec)
+    enddo
 
+    e1 = 1
+    do
+      call NextActiveRun(this%rateLevel,this%lts_activeLevel,e1,e2)
+      if(e1 > this%mesh%nElem) exit
+      n1 = 2*e1-1
+      n2 = 2*e2
+      call this%riemannflux1d_batch(fin(n1:n2,:),fout(n1:n2,:),dfdx(n1:n2,:),nhat(n1:n2),fb(n1:n2,:))
+      e1 = e2+1
     enddo
 
+    deallocate(nhat)
+
   endsubroutine BoundaryFlux_DGModel1D_t
 
   subroutine fluxmethod_DGModel1D_t(this)
+    !! Evaluates flux1d_batch on each contiguous range of active elements
     implicit none
     class(DGModel1D_t),intent(inout) :: this
     ! Local
-    integer :: iel
-    integer :: i
-    real(prec) :: f(1:this%solution%nvar),dfdx(1:this%solution%nvar)
-
-    do concurrent(i=1:this%solution%N+1,iel=1:this%mesh%nElem)
-
-      f = this%solution%interior(i,iel,1:this%solution%nvar)
-      dfdx = this%solutionGradient%interior(i,iel,1:this%solution%nvar)
-
-      this%flux%interior(i,iel,1:this%solution%nvar) = &
-        this%flux1d(f,dfdx)
-
+    integer :: e1,e2,np,n1,n2,ndof
+    real(prec),pointer :: f(:,:),dfdx(:,:),flux(:,:)
+
+    np = this%solution%N+1
+    ndof = np*this%mesh%nElem
+    f(1:ndof,1:this%solution%nvar) => this%solution%interior
+    dfdx(1:ndof,1:this%solution%nvar) => this%solutionGradient%interior
+    flux(1:ndof,1:this%solution%nvar) => this%flux%interior
+
+    e1 = 1
+    do
+      call NextActiveRun(this%rateLevel,this%lts_activeLevel,e1,e2)
+      if(e1 > this%mesh%nElem) exit
+      n1 = (e1-1)*np+1
+      n2 = e2*np
+      call this%flux1d_batch(f(n1:n2,:),dfdx(n1:n2,:),flux(n1:n2,:))
+      e1 = e2+1
     enddo
 
   endsubroutine fluxmethod_DGModel1D_t
 
   subroutine sourcemethod_DGModel1D_t(this)
+    !! Evaluates source1d_batch on each contiguous range of active elements
     implicit none
     class(DGModel1D_t),intent(inout) :: this
     ! Local
-    integer :: iel
-    integer :: i
-    real(prec) :: f(1:this%solution%nvar),dfdx(1:this%solution%nvar)
-
-    do concurrent(i=1:this%solution%N+1,iel=1:this%mesh%nElem)
-
-      f = this%solution%interior(i,iel,1:this%solution%nvar)
-      dfdx = this%solutionGradient%interior(i,iel,1:this%solution%nvar)
-
-      this%source%interior(i,iel,1:this%solution%nvar) = &
-        this%source1d(f,dfdx)
-
+    integer :: e1,e2,np,n1,n2,ndof
+    real(prec),pointer :: f(:,:),dfdx(:,:),src(:,:)
+
+    np = this%solution%N+1
+    ndof = np*this%mesh%nElem
+    f(1:ndof,1:this%solution%nvar) => this%solution%interior
+    dfdx(1:ndof,1:this%solution%nvar) => this%solutionGradient%interior
+    src(1:ndof,1:this%solution%nvar) => this%source%interior
+
+    e1 = 1
+    do
+      call NextActiveRun(this%rateLevel,this%lts_activeLevel,e1,e2)
+      if(e1 > this%mesh%nElem) exit
+      n1 = (e1-1)*np+1
+      n2 = e2*np
+      call this%source1d_batch(f(n1:n2,:),dfdx(n1:n2,:),src(n1:n2,:))
+      e1 = e2+1
     enddo
 
   endsubroutine sourcemethod_DGModel1D_t
 
-  subroutine CalculateTendency_DGModel1D_t(this)
+  subroutine CalculateFluxDivergence_DGModel1D_t(this)
+    !! Calculates the source and the flux divergence, without assembling the tendency dSdt
     implicit none
     class(DGModel1D_t),intent(inout) :: this
-    ! Local
-    integer :: i,iEl,iVar
 
     call this%solution%BoundaryInterp()
     call this%solution%SideExchange(this%mesh)
@@ -535,6 +1064,17 @@ contains
     call this%FluxMethod() ! User supplied
 
     call this%flux%MappedDGDerivative(this%fluxDivergence%interior)
+
+  endsubroutine CalculateFluxDivergence_DGModel1D_t
+
+  subroutine CalculateTendency_DGModel1D_t(this)
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+    ! Local
+    integer :: i,iEl,iVar
+
+    call this%CalculateFluxDivergence()
+
     do concurrent(i=1:this%solution%N+1, &
                   iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
 
@@ -546,6 +1086,27 @@ contains
 
   endsubroutine CalculateTendency_DGModel1D_t
 
+  subroutine CalculateExplicitTendency_DGModel1D_t(this)
+    !! Calculates the tendency with a zero solution gradient, which leaves out the terms that
+    !! need gradient_enabled (e.g. diffusion). This is the explicit part of the tendency for
+    !! the IMEX methods.
+    implicit none
+    class(DGModel1D_t),intent(inout) :: this
+    ! Local
+    logical :: gradient_enabled
+
+    gradient_enabled = this%gradient_enabled
+    this%gradient_enabled = .false.
+    this%solutionGradient%interior = 0.0_prec
+    this%solutionGradient%avgBoundary = 0.0_prec
+    call this%solutionGradient%UpdateDevice()
+
+    call this%CalculateTendency()
+
+    this%gradient_enabled = gradient_enabled
+
+  endsubroutine CalculateExplicitTendency_DGModel1D_t
+
   subroutine Write_DGModel1D_t(this,fileName)
 #undef __FUNC__
 #define __FUNC__ "Write_DGModel1D_t"
@@ -580,11 +1141,18 @@ contains
 
     ! Write the model state to file
     call CreateGroup_HDF5(fileId,'/controlgrid')
-    call this%solution%WriteHDF5(fileId,'/controlgrid/solution')
+    call this%solution%WriteHDF5(fileId,'/controlgrid/solution',storage=this%outputStorage%Lossless())
+
+    ! Write the Adams-Bashforth tendency history, for pickup runs with a multistep method
+    if(this%ab_nhistory > 0) then
+      call this%abHistory%UpdateHost()
+      call this%abHistory%WriteHDF5(fileId,'/controlgrid/abhistory',storage=this%outputStorage%Lossless())
+      call this%WriteABState(fileId)
+    endif
 
     ! Write the geometry to file
     call CreateGroup_HDF5(fileId,'/controlgrid/geometry')
-    call this%geometry%x%WriteHDF5(fileId,'/controlgrid/geometry/x')
+    call this%geometry%x%WriteHDF5(fileId,'/controlgrid/geometry/x',storage=this%outputStorage%Lossless())
     ! -- END : writing solution on control grid -- !
 
     ! Interpolate the solution to a grid for plotting results
@@ -607,11 +1175,11 @@ contains
 
     ! Write the model state to file
     call CreateGroup_HDF5(fileId,'/targetgrid')
-    call solution%WriteHDF5(fileId,'/targetgrid/solution')
+    call solution%WriteHDF5(fileId,'/targetgrid/solution',storage=this%outputStorage)
 
     ! Write the geometry to file
     call CreateGroup_HDF5(fileId,'/targetgrid/geometry')
-    call x%WriteHDF5(fileId,'/targetgrid/geometry/x')
+    call x%WriteHDF5(fileId,'/targetgrid/geometry/x',storage=this%outputStorage)
 
     call Close_HDF5(fileId)
 
@@ -633,9 +1201,18 @@ contains
 
     call Open_HDF5(fileName,H5F_ACC_RDWR_F,fileId)
     call ReadArray_HDF5(fileId,'/controlgrid/solution/interior',this%solution%interior)
-    call Close_HDF5(fileId)
     call this%solution%UpdateDevice()
 
+    ! Read the Adams-Bashforth tendency history, when the file holds one for the
+    ! current time integrator
+    if(this%ReadABState(fileId)) then
+      call this%ReserveABHistory()
+      call ReadArray_HDF5(fileId,'/controlgrid/abhistory/interior',this%abHistory%interior)
+      call this%abHistory%UpdateDevice()
+    endif
+
+    call Close_HDF5(fileId)
+
   endsubroutine Read_DGModel1D_t
 
   subroutine WriteTecplot_DGModel1D_t(this,filename)
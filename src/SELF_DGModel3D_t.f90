@@ -33,6 +33,7 @@ module SELF_DGModel3D_t
   use SELF_MappedScalar_3D
   use SELF_MappedVector_3D
   use SELF_HDF5
+  use SELF_XDMF
   use HDF5
   use FEQParse
   use SELF_Model
@@ -47,8 +48,20 @@ module SELF_DGModel3D_t
     type(MappedScalar3D)   :: fluxDivergence
     type(MappedScalar3D)   :: dSdt
     type(MappedScalar3D)   :: workSol
+    type(MappedScalar3D)   :: erkStages
+    type(MappedScalar3D)   :: abHistory
+    type(MappedScalar3D)   :: imexWork
+    real(prec),allocatable :: lengthScale(:) ! Element length scale used by ComputeStableDt
+    integer,allocatable :: rateLevel(:) ! Element rate level used by the multirate integrators
     type(Mesh3D),pointer   :: mesh
     type(SEMHex),pointer  :: geometry
+    ! Uniform grid interpolant, buffers and cell connectivity used by WriteXDMF.
+    ! They are created on the first output and kept until Free.
+    type(Lagrange),pointer :: vizInterp => null()
+    type(Scalar3D)         :: vizSolution
+    type(Vector3D)         :: vizGradient
+    type(Vector3D)         :: vizX
+    integer,allocatable    :: vizCells(:,:,:)
 
   contains
 
@@ -69,9 +82,34 @@ module SELF_DGModel3D_t
     procedure :: UpdateGRK2 => UpdateGRK2_DGModel3D_t
     procedure :: UpdateGRK3 => UpdateGRK3_DGModel3D_t
     procedure :: UpdateGRK4 => UpdateGRK4_DGModel3D_t
+    procedure :: UpdateGLSRK => UpdateGLSRK_DGModel3D_t
+
+    procedure :: ReserveERKStages => ReserveERKStages_DGModel3D_t
+    procedure :: StoreERKStage => StoreERKStage_DGModel3D_t
+    procedure :: UpdateERK => UpdateERK_DGModel3D_t
+    procedure :: ERKErrorNorm => ERKErrorNorm_DGModel3D_t
+
+    procedure :: ReserveABHistory => ReserveABHistory_DGModel3D_t
+    procedure :: UpdateGAB => UpdateGAB_DGModel3D_t
+
+    procedure :: ReserveIMEXSlots => ReserveIMEXSlots_DGModel3D_t
+    procedure :: StoreIMEX => StoreIMEX_DGModel3D_t
+    procedure :: LoadIMEX => LoadIMEX_DGModel3D_t
+    procedure :: CombineIMEX => CombineIMEX_DGModel3D_t
+    procedure :: DotIMEX => DotIMEX_DGModel3D_t
+    procedure :: RandomIMEX => RandomIMEX_DGModel3D_t
+
+    procedure :: CalculateLengthScale => CalculateLengthScale_DGModel3D_t
+    procedure :: ElementStableDt => ElementStableDt_DGModel3D_t
+    procedure :: ComputeStableDt => ComputeStableDt_DGModel3D_t
+    procedure :: SetMultirateLevels => SetMultirateLevels_DGModel3D_t
+    procedure :: UpdateGMRAB => UpdateGMRAB_DGModel3D_t
 
     procedure :: CalculateSolutionGradient => CalculateSolutionGradient_DGModel3D_t
+    procedure :: FluxDivergenceVolume => FluxDivergenceVolume_DGModel3D_t
+    procedure :: CalculateFluxDivergence => CalculateFluxDivergence_DGModel3D_t
     procedure :: CalculateTendency => CalculateTendency_DGModel3D_t
+    procedure :: CalculateExplicitTendency => CalculateExplicitTendency_DGModel3D_t
 
     generic :: SetSolution => SetSolutionFromChar_DGModel3D_t, &
       SetSolutionFromEqn_DGModel3D_t
@@ -80,7 +118,11 @@ module SELF_DGModel3D_t
 
     procedure :: ReadModel => Read_DGModel3D_t
     procedure :: WriteModel => Write_DGModel3D_t
+    procedure :: WriteGeometry => WriteGeometry_DGModel3D_t
     procedure :: WriteTecplot => WriteTecplot_DGModel3D_t
+    procedure :: WriteXDMF => WriteXDMF_DGModel3D_t
+    procedure,private :: InitVisualization => InitVisualization_DGModel3D_t
+    procedure,private :: WriteVisualizationArray => WriteVisualizationArray_DGModel3D_t
 
   endtype DGModel3D_t
 
@@ -113,6 +155,10 @@ contains
     call this%flux%AssociateGeometry(geometry)
     call this%fluxDivergence%AssociateGeometry(geometry)
 
+    call this%CalculateLengthScale()
+    allocate(this%rateLevel(1:this%mesh%nElem))
+    this%rateLevel = 0
+
     call this%AdditionalInit()
 
     call this%SetMetadata()
@@ -147,6 +193,28 @@ contains
     call this%flux%Free()
     call this%source%Free()
     call this%fluxDivergence%Free()
+    if(allocated(this%lengthScale)) deallocate(this%lengthScale)
+    if(allocated(this%rateLevel)) deallocate(this%rateLevel)
+    if(this%erk_nslots > 0) then
+      call this%erkStages%Free()
+      this%erk_nslots = 0
+    endif
+    if(this%ab_nslots > 0) then
+      call this%abHistory%Free()
+      this%ab_nslots = 0
+    endif
+    if(this%imex_nslots > 0) then
+      call this%imexWork%Free()
+      this%imex_nslots = 0
+    endif
+    call this%asyncWriter%Free()
+    if(associated(this%vizInterp)) then
+      call this%vizSolution%Free()
+      call this%vizGradient%Free()
+      call this%vizX%Free()
+      call this%vizInterp%Free()
+      deallocate(this%vizInterp,this%vizCells)
+    endif
     call this%AdditionalFree()
 
   endsubroutine Free_DGModel3D_t
@@ -262,7 +330,8 @@ contains
 
       this%workSol%interior(i,j,k,iEl,iVar) = rk2_a(m)* &
                                               this%workSol%interior(i,j,k,iEl,iVar)+ &
-                                              this%dSdt%interior(i,j,k,iEl,iVar)
+                                              this%source%interior(i,j,k,iEl,iVar)- &
+                                              this%fluxDivergence%interior(i,j,k,iEl,iVar)
 
       this%solution%interior(i,j,k,iEl,iVar) = &
         this%solution%interior(i,j,k,iEl,iVar)+ &
@@ -284,7 +353,8 @@ contains
 
       this%workSol%interior(i,j,k,iEl,iVar) = rk3_a(m)* &
                                               this%workSol%interior(i,j,k,iEl,iVar)+ &
-                                              this%dSdt%interior(i,j,k,iEl,iVar)
+                                              this%source%interior(i,j,k,iEl,iVar)- &
+                                              this%fluxDivergence%interior(i,j,k,iEl,iVar)
 
       this%solution%interior(i,j,k,iEl,iVar) = &
         this%solution%interior(i,j,k,iEl,iVar)+ &
@@ -306,7 +376,8 @@ contains
 
       this%workSol%interior(i,j,k,iEl,iVar) = rk4_a(m)* &
                                               this%workSol%interior(i,j,k,iEl,iVar)+ &
-                                              this%dSdt%interior(i,j,k,iEl,iVar)
+                                              this%source%interior(i,j,k,iEl,iVar)- &
+                                              this%fluxDivergence%interior(i,j,k,iEl,iVar)
 
       this%solution%interior(i,j,k,iEl,iVar) = &
         this%solution%interior(i,j,k,iEl,iVar)+ &
@@ -316,6 +387,554 @@ contains
 
   endsubroutine UpdateGRK4_DGModel3D_t
 
+  subroutine UpdateGLSRK_DGModel3D_t(this,m)
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    integer,intent(in) :: m
+    ! Local
+    integer :: i,j,k,iVar,iEl
+
+    do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
+                  k=1:this%solution%N+1,iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+
+      this%workSol%interior(i,j,k,iEl,iVar) = this%lsrk_a(m)* &
+                                              this%workSol%interior(i,j,k,iEl,iVar)+ &
+                                              this%source%interior(i,j,k,iEl,iVar)- &
+                                              this%fluxDivergence%interior(i,j,k,iEl,iVar)
+
+      this%solution%interior(i,j,k,iEl,iVar) = &
+        this%solution%interior(i,j,k,iEl,iVar)+ &
+        this%lsrk_g(m)*this%dt*this%workSol%interior(i,j,k,iEl,iVar)
+
+    enddo
+
+  endsubroutine UpdateGLSRK_DGModel3D_t
+
+  subroutine ReserveERKStages_DGModel3D_t(this)
+    !! Allocates the stage slots used by the embedded Runge-Kutta pairs. Slot m holds
+    !! variables m*nvar+1 through (m+1)*nvar of erkStages, so that each slot is a
+    !! contiguous block of memory
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+
+    if(this%erk_nslots /= this%erk_nstages+1) then
+      if(this%erk_nslots > 0) call this%erkStages%Free()
+      call this%erkStages%Init(this%geometry%x%interp, &
+                               this%nvar*(this%erk_nstages+1), &
+                               this%mesh%nElem)
+      this%erk_nslots = this%erk_nstages+1
+    endif
+
+  endsubroutine ReserveERKStages_DGModel3D_t
+
+  subroutine StoreERKStage_DGModel3D_t(this,m)
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    integer,intent(in) :: m
+    ! Local
+    integer :: i,j,k,iEl,iVar
+
+    if(m == 0) then
+      call this%ReserveERKStages()
+      do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
+                  k=1:this%solution%N+1,iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+        this%erkStages%interior(i,j,k,iEl,iVar) = this%solution%interior(i,j,k,iEl,iVar)
+      enddo
+    else
+      do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
+                  k=1:this%solution%N+1,iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+        this%erkStages%interior(i,j,k,iEl,iVar+m*this%nvar) = this%dSdt%interior(i,j,k,iEl,iVar)
+      enddo
+    endif
+
+  endsubroutine StoreERKStage_DGModel3D_t
+
+  subroutine UpdateERK_DGModel3D_t(this,w)
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    real(prec),intent(in) :: w(:)
+    ! Local
+    integer :: i,j,k,iEl,iVar,m
+    real(prec) :: s
+
+    do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
+                  k=1:this%solution%N+1,iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+
+      s = this%erkStages%interior(i,j,k,iEl,iVar)
+      do m = 1,size(w)
+        s = s+w(m)*this%erkStages%interior(i,j,k,iEl,iVar+m*this%nvar)
+      enddo
+      this%solution%interior(i,j,k,iEl,iVar) = s
+
+    enddo
+
+  endsubroutine UpdateERK_DGModel3D_t
+
+  function ERKErrorNorm_DGModel3D_t(this,w) result(err)
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    real(prec),intent(in) :: w(:)
+    real(prec) :: err
+    ! Local
+    integer :: i,j,k,iEl,iVar,m,ierror
+    real(prec) :: e,sc,esum
+    real(prec) :: local(1:2),global(1:2)
+
+    esum = 0.0_prec
+    do ivar = 1,this%solution%nVar
+      do iel = 1,this%mesh%nElem
+        do k = 1,this%solution%interp%N+1
+          do j = 1,this%solution%interp%N+1
+            do i = 1,this%solution%interp%N+1
+              e = 0.0_prec
+              do m = 1,size(w)
+                e = e+w(m)*this%erkStages%interior(i,j,k,iEl,iVar+m*this%nvar)
+              enddo
+              sc = this%abstol+this%reltol*max(abs(this%erkStages%interior(i,j,k,iEl,iVar)), &
+                                               abs(this%solution%interior(i,j,k,iEl,iVar)))
+              esum = esum+(e/sc)**2
+            enddo
+          enddo
+        enddo
+      enddo
+    enddo
+
+    local(1) = esum
+    local(2) = real(this%solution%nVar,prec)*real(this%solution%nElem,prec)* &
+               real(this%solution%interp%N+1,prec)**3
+
+    if(this%mesh%decomp%mpiEnabled) then
+      call mpi_allreduce(local, &
+                         global, &
+                         2, &
+                         this%mesh%decomp%mpiPrec, &
+                         MPI_SUM, &
+                         this%mesh%decomp%mpiComm, &
+                         iError)
+    else
+      global = local
+    endif
+
+    err = sqrt(global(1)/global(2))
+
+  endfunction ERKErrorNorm_DGModel3D_t
+
+  subroutine ReserveABHistory_DGModel3D_t(this)
+    !! Allocates the tendency history used by the Adams-Bashforth methods. History slot m
+    !! holds variables m*nvar+1 through (m+1)*nvar of abHistory
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    ! Local
+    integer :: ivar
+    character(LEN=3) :: ivarChar
+
+    if(this%ab_nslots /= this%ab_order) then
+      if(this%ab_nslots > 0) call this%abHistory%Free()
+      call this%abHistory%Init(this%geometry%x%interp, &
+                               this%nvar*this%ab_order, &
+                               this%mesh%nElem)
+      do ivar = 1,this%abHistory%nvar
+        write(ivarChar,'(I3.3)') ivar
+        call this%abHistory%SetName(ivar,"dsdt"//trim(ivarChar))
+      enddo
+      this%ab_nslots = this%ab_order
+    endif
+
+  endsubroutine ReserveABHistory_DGModel3D_t
+
+  subroutine UpdateGAB_DGModel3D_t(this,w)
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    real(prec),intent(in) :: w(:)
+    ! Local
+    integer :: i,j,k,iEl,iVar,m
+    integer :: head
+    real(prec) :: s
+
+    call this%ReserveABHistory()
+    head = this%ab_head*this%nvar
+
+    do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
+                  k=1:this%solution%N+1,iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+
+      this%abHistory%interior(i,j,k,iEl,iVar+head) = this%dSdt%interior(i,j,k,iEl,iVar)
+      s = 0.0_prec
+      do m = 1,size(w)
+        s = s+w(m)*this%abHistory%interior(i,j,k,iEl,iVar+(m-1)*this%nvar)
+      enddo
+      this%dSdt%interior(i,j,k,iEl,iVar) = s
+
+    enddo
+
+  endsubroutine UpdateGAB_DGModel3D_t
+
+  subroutine ReserveIMEXSlots_DGModel3D_t(this)
+    !! Allocates the vector slots used by the IMEX methods. Slot m holds variables
+    !! m*nvar+1 through (m+1)*nvar of imexWork. The slots are only held on the host.
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+
+    if(this%imex_nslots /= this%imex_nvectors) then
+      if(this%imex_nslots > 0) call this%imexWork%Free()
+      call this%imexWork%Init(this%geometry%x%interp, &
+                              this%nvar*this%imex_nvectors, &
+                              this%mesh%nElem)
+      this%imex_nslots = this%imex_nvectors
+    endif
+
+  endsubroutine ReserveIMEXSlots_DGModel3D_t
+
+  subroutine StoreIMEX_DGModel3D_t(this,slot,fromTendency)
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    integer,intent(in) :: slot
+    logical,intent(in) :: fromTendency
+    ! Local
+    integer :: i,j,k,iEl,iVar
+
+    call this%ReserveIMEXSlots()
+    if(fromTendency) then
+      call this%dSdt%UpdateHost()
+      do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
+                  k=1:this%solution%N+1,iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+        this%imexWork%interior(i,j,k,iEl,iVar+slot*this%nvar) = this%dSdt%interior(i,j,k,iEl,iVar)
+      enddo
+    else
+      call this%solution%UpdateHost()
+      do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
+                  k=1:this%solution%N+1,iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+        this%imexWork%interior(i,j,k,iEl,iVar+slot*this%nvar) = this%solution%interior(i,j,k,iEl,iVar)
+      enddo
+    endif
+
+  endsubroutine StoreIMEX_DGModel3D_t
+
+  subroutine LoadIMEX_DGModel3D_t(this,slot)
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    integer,intent(in) :: slot
+    ! Local
+    integer :: i,j,k,iEl,iVar
+
+    do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
+                  k=1:this%solution%N+1,iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+      this%solution%interior(i,j,k,iEl,iVar) = this%imexWork%interior(i,j,k,iEl,iVar+slot*this%nvar)
+    enddo
+    call this%solution%UpdateDevice()
+
+  endsubroutine LoadIMEX_DGModel3D_t
+
+  subroutine CombineIMEX_DGModel3D_t(this,slot,slots,w)
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    integer,intent(in) :: slot
+    integer,intent(in) :: slots(:)
+    real(prec),intent(in) :: w(:)
+    ! Local
+    integer :: i,j,k,iEl,iVar,m
+    real(prec) :: s
+
+    call this%ReserveIMEXSlots()
+    do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
+                  k=1:this%solution%N+1,iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+
+      s = 0.0_prec
+      do m = 1,size(slots)
+        s = s+w(m)*this%imexWork%interior(i,j,k,iEl,iVar+slots(m)*this%nvar)
+      enddo
+      this%imexWork%interior(i,j,k,iEl,iVar+slot*this%nvar) = s
+
+    enddo
+
+  endsubroutine CombineIMEX_DGModel3D_t
+
+  function DotIMEX_DGModel3D_t(this,a,b) result(d)
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    integer,intent(in) :: a
+    integer,intent(in) :: b
+    real(prec) :: d
+    ! Local
+    integer :: i,j,k,iEl,iVar,iError
+    real(prec) :: dloc
+
+    dloc = 0.0_prec
+    do ivar = 1,this%solution%nVar
+      do iel = 1,this%mesh%nElem
+        do k = 1,this%solution%interp%N+1
+          do j = 1,this%solution%interp%N+1
+            do i = 1,this%solution%interp%N+1
+            dloc = dloc+this%imexWork%interior(i,j,k,iEl,iVar+a*this%nvar)* &
+                   this%imexWork%interior(i,j,k,iEl,iVar+b*this%nvar)
+            enddo
+          enddo
+        enddo
+      enddo
+    enddo
+
+    if(this%mesh%decomp%mpiEnabled) then
+      call mpi_allreduce(dloc, &
+                         d, &
+                         1, &
+                         this%mesh%decomp%mpiPrec, &
+                         MPI_SUM, &
+                         this%mesh%decomp%mpiComm, &
+                         iError)
+    else
+      d = dloc
+    endif
+
+  endfunction DotIMEX_DGModel3D_t
+
+  subroutine RandomIMEX_DGModel3D_t(this,slot)
+    !! Fills the given vector slot with random values, uniformly distributed in [-1,1]
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    integer,intent(in) :: slot
+    ! Local
+    integer :: v1,v2
+
+    call this%ReserveIMEXSlots()
+    v1 = slot*this%nvar+1
+    v2 = (slot+1)*this%nvar
+    call random_number(this%imexWork%interior(:,:,:,:,v1:v2))
+    this%imexWork%interior(:,:,:,:,v1:v2) = 2.0_prec*this%imexWork%interior(:,:,:,:,v1:v2)-1.0_prec
+
+  endsubroutine RandomIMEX_DGModel3D_t
+
+  subroutine CalculateLengthScale_DGModel3D_t(this)
+    !! Sets the length scale of each element to the smallest distance across the
+    !! element, estimated at the element boundaries as 2*J/nScale
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    ! Local
+    integer :: iel
+
+    if(allocated(this%lengthScale)) deallocate(this%lengthScale)
+    allocate(this%lengthScale(1:this%mesh%nElem))
+
+    do concurrent(iel=1:this%mesh%nElem)
+      this%lengthScale(iel) = 2.0_prec*minval(abs(this%geometry%J%boundary(:,:,:,iel,1))/ &
+                                              this%geometry%nScale%boundary(:,:,:,iel,1))
+    enddo
+
+  endsubroutine CalculateLengthScale_DGModel3D_t
+
+  subroutine ElementStableDt_DGModel3D_t(this,cfl,dtElem)
+    !! Sets dtElem to the largest time step size that satisfies
+    !!
+    !!   dt*( c*(N+1)^2/h + nu*(N+1)^4/h^2 ) <= cfl
+    !!
+    !! in each element, where h is the element length scale and c and nu are the
+    !! largest values of maxWaveSpeed and maxDiffusivity in the element. The diffusive
+    !! limit is only applied when gradient_enabled is set. Elements where the model
+    !! reports no wave speed or diffusivity are set to huge(1.0_prec).
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    real(prec),intent(in) :: cfl
+    real(prec),intent(out) :: dtElem(1:this%mesh%nElem)
+    ! Local
+    integer :: i,j,k,iel
+    real(prec) :: s(1:this%nvar)
+    real(prec) :: c,nu,np,rate
+
+    call this%solution%UpdateHost()
+
+    np = real(this%solution%interp%N+1,prec)**2
+    do iel = 1,this%mesh%nElem
+      c = 0.0_prec
+      nu = 0.0_prec
+      do k = 1,this%solution%interp%N+1
+        do j = 1,this%solution%interp%N+1
+          do i = 1,this%solution%interp%N+1
+            s = this%solution%interior(i,j,k,iel,1:this%nvar)
+            c = max(c,this%maxWaveSpeed(s))
+            if(this%gradient_enabled) nu = max(nu,this%maxDiffusivity(s))
+          enddo
+        enddo
+      enddo
+      rate = c*np/this%lengthScale(iel)+nu*(np/this%lengthScale(iel))**2
+      if(rate > 0.0_prec) then
+        dtElem(iel) = cfl/rate
+      else
+        dtElem(iel) = huge(1.0_prec)
+      endif
+    enddo
+
+  endsubroutine ElementStableDt_DGModel3D_t
+
+  function ComputeStableDt_DGModel3D_t(this,cfl) result(dt)
+    !! Returns the smallest stable time step size of the elements (see ElementStableDt), over
+    !! all ranks. When the model reports no wave speed or diffusivity, the current time step
+    !! size is returned.
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    real(prec),intent(in) :: cfl
+    real(prec) :: dt
+    ! Local
+    integer :: ierror
+    real(prec) :: dtElem(1:this%mesh%nElem)
+    real(prec) :: dtloc
+
+    call this%ElementStableDt(cfl,dtElem)
+    dtloc = minval(dtElem)
+
+    if(this%mesh%decomp%mpiEnabled) then
+      call mpi_allreduce(dtloc, &
+                         dt, &
+                         1, &
+                         this%mesh%decomp%mpiPrec, &
+                         MPI_MIN, &
+                         this%mesh%decomp%mpiComm, &
+                         iError)
+    else
+      dt = dtloc
+    endif
+
+    if(dt == huge(1.0_prec)) dt = this%dt
+
+  endfunction ComputeStableDt_DGModel3D_t
+
+  subroutine SetMultirateLevels_DGModel3D_t(this,cfl,maxLevels)
+    !! Assigns each element to the rate level floor(log2(dtElem/dtMin)), capped at
+    !! maxLevels-1, where dtElem is the stable time step size of the element for the cfl
+    !! number (see ElementStableDt) and dtMin is the smallest one over all ranks. Elements
+    !! where the model reports no wave speed or diffusivity are put on the slowest level.
+    !! The time step size dt is set to dtMin, the step size of level 0.
+    !!
+    !! The levels are kept until this method is called again. When cfl > 0, ForwardStep
+    !! only resets dt, which should then remain close to dtMin.
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    real(prec),intent(in) :: cfl
+    integer,intent(in) :: maxLevels
+    ! Local
+    integer :: iel,l,nlevels,maxLevel,iError
+    integer :: nPerLevel(0:SELF_MAX_RATE_LEVELS-1)
+    real(prec) :: dtElem(1:this%mesh%nElem)
+    real(prec) :: dtMin,dtloc,work
+
+    if(maxLevels < 1 .or. maxLevels > SELF_MAX_RATE_LEVELS) then
+      print*,__FILE__//" : maxLevels must be between 1 and ",SELF_MAX_RATE_LEVELS
+      stop 1
+    endif
+
+    call this%ElementStableDt(cfl,dtElem)
+    dtloc = minval(dtElem)
+    if(this%mesh%decomp%mpiEnabled) then
+      call mpi_allreduce(dtloc, &
+                         dtMin, &
+                         1, &
+                         this%mesh%decomp%mpiPrec, &
+                         MPI_MIN, &
+                         this%mesh%decomp%mpiComm, &
+                         iError)
+    else
+      dtMin = dtloc
+    endif
+
+    ! Elements without a stable time step size are set once the slowest level is known
+    do iel = 1,this%mesh%nElem
+      if(dtElem(iel) == huge(1.0_prec)) then
+        this%rateLevel(iel) = -1
+      else
+        ! Ratios within ab_steptol of a power of two are rounded up to it
+        this%rateLevel(iel) = min(floor(log((1.0_prec+ab_steptol)*dtElem(iel)/dtMin)/log(2.0_prec)), &
+                                  maxLevels-1)
+      endif
+    enddo
+    maxLevel = maxval(this%rateLevel)
+    if(this%mesh%decomp%mpiEnabled) then
+      call mpi_allreduce(maxLevel, &
+                         nlevels, &
+                         1, &
+                         MPI_INTEGER, &
+                         MPI_MAX, &
+                         this%mesh%decomp%mpiComm, &
+                         iError)
+      nlevels = nlevels+1
+    else
+      nlevels = maxLevel+1
+    endif
+    nlevels = max(nlevels,1)
+    where(this%rateLevel < 0) this%rateLevel = nlevels-1
+
+    this%lts_nlevels = nlevels
+    this%lts_nhistory = 0
+    this%lts_head = 0
+    if(dtMin < huge(1.0_prec)) this%dt = dtMin
+
+    nPerLevel = 0
+    do iel = 1,this%mesh%nElem
+      nPerLevel(this%rateLevel(iel)) = nPerLevel(this%rateLevel(iel))+1
+    enddo
+    if(this%mesh%decomp%mpiEnabled) then
+      call mpi_allreduce(MPI_IN_PLACE, &
+                         nPerLevel, &
+                         SELF_MAX_RATE_LEVELS, &
+                         MPI_INTEGER, &
+                         MPI_SUM, &
+                         this%mesh%decomp%mpiComm, &
+                         iError)
+    endif
+
+    ! Element tendency evaluations per macro step, relative to stepping all elements with dt
+    work = 0.0_prec
+    do l = 0,nlevels-1
+      work = work+real(nPerLevel(l),prec)/real(2**l,prec)
+    enddo
+    work = work/real(max(sum(nPerLevel),1),prec)
+
+    if(this%mesh%decomp%rankId == 0) then
+      do l = 0,nlevels-1
+        print*,__FILE__//" : Rate level ",l," : ",nPerLevel(l)," elements, dt = ",this%dt*real(2**l,prec)
+      enddo
+      print*,__FILE__//" : Element updates relative to single rate stepping : ",work
+    endif
+
+  endsubroutine SetMultirateLevels_DGModel3D_t
+
+  subroutine UpdateGMRAB_DGModel3D_t(this,w,activeLevel,predict)
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    real(prec),intent(in) :: w(:,0:)
+    integer,intent(in) :: activeLevel
+    logical,intent(in) :: predict
+    ! Local
+    integer :: i,j,k,iEl,iVar,m,l
+    real(prec) :: s
+
+    call this%ReserveABHistory()
+    ! The rate levels are only held on the host
+    call this%solution%UpdateHost()
+    call this%dSdt%UpdateHost()
+    call this%workSol%UpdateHost()
+    call this%abHistory%UpdateHost()
+
+    do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
+                  k=1:this%solution%N+1,iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
+
+      l = this%rateLevel(iel)
+      if(l <= activeLevel) then
+        this%workSol%interior(i,j,k,iel,ivar) = this%solution%interior(i,j,k,iel,ivar)
+        this%abHistory%interior(i,j,k,iel,ivar+this%lts_head(l)*this%nvar) = this%dSdt%interior(i,j,k,iel,ivar)
+      endif
+      if(predict) then
+        s = 0.0_prec
+        do m = 1,size(w,1)
+          s = s+w(m,l)*this%abHistory%interior(i,j,k,iel,ivar+(m-1)*this%nvar)
+        enddo
+        this%solution%interior(i,j,k,iel,ivar) = this%workSol%interior(i,j,k,iel,ivar)+s
+      endif
+
+    enddo
+
+    call this%solution%UpdateDevice()
+    call this%workSol%UpdateDevice()
+    call this%abHistory%UpdateDevice()
+
+  endsubroutine UpdateGMRAB_DGModel3D_t
+
   subroutine CalculateSolutionGradient_DGModel3D_t(this)
     implicit none
     class(DGModel3D_t),intent(inout) :: this
@@ -369,20 +988,27 @@ contains
   endsubroutine CalculateEntropy_DGModel3D_t
 
   subroutine fluxmethod_DGModel3D_t(this)
+    !! Evaluates flux3d_batch on each contiguous range of active elements
     implicit none
     class(DGModel3D_t),intent(inout) :: this
     ! Local
-    integer :: iel
-    integer :: i,j,k
-    real(prec) :: s(1:this%nvar),dsdx(1:this%nvar,1:3)
-
-    do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
-                  k=1:this%solution%N+1,iel=1:this%mesh%nElem)
-
-      s = this%solution%interior(i,j,k,iel,1:this%nvar)
-      dsdx = this%solutionGradient%interior(i,j,k,iel,1:this%nvar,1:3)
-      this%flux%interior(i,j,k,iel,1:this%nvar,1:3) = this%flux3d(s,dsdx)
-
+    integer :: e1,e2,np,n1,n2,ndof
+    real(prec),pointer :: s(:,:),dsdx(:,:,:),f(:,:,:)
+
+    np = (this%solution%N+1)**3
+    ndof = np*this%mesh%nElem
+    s(1:ndof,1:this%nvar) => this%solution%interior
+    dsdx(1:ndof,1:this%nvar,1:3) => this%solutionGradient%interior
+    f(1:ndof,1:this%nvar,1:3) => this%flux%interior
+
+    e1 = 1
+    do
+      call NextActiveRun(this%rateLevel,this%lts_activeLevel,e1,e2)
+      if(e1 > this%mesh%nElem) exit
+      n1 = (e1-1)*np+1
+      n2 = e2*np
+      call this%flux3d_batch(s(n1:n2,:),dsdx(n1:n2,:,:),f(n1:n2,:,:))
+      e1 = e2+1
     enddo
 
   endsubroutine fluxmethod_DGModel3D_t
@@ -394,40 +1020,57 @@ contains
     implicit none
     class(DGModel3D_t),intent(inout) :: this
     ! Local
-    integer :: i,j,k,iel
-    real(prec) :: sL(1:this%nvar),sR(1:this%nvar)
-    real(prec) :: dsdx(1:this%nvar,1:3)
-    real(prec) :: nhat(1:3),nmag
-
-    do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
-                  k=1:6,iel=1:this%mesh%nElem)
-      ! Get the boundary normals on cell edges from the mesh geometry
-      nhat = this%geometry%nHat%boundary(i,j,k,iEl,1,1:3)
-      sL = this%solution%boundary(i,j,k,iel,1:this%nvar) ! interior solution
-      sR = this%solution%extboundary(i,j,k,iel,1:this%nvar) ! exterior solution
-      dsdx = this%solutiongradient%avgboundary(i,j,k,iel,1:this%nvar,1:3)
-      nmag = this%geometry%nScale%boundary(i,j,k,iEl,1)
-
-      this%flux%boundaryNormal(i,j,k,iEl,1:this%nvar) = this%riemannflux3d(sL,sR,dsdx,nhat)*nmag
-
+    integer :: e1,e2,nb,n1,n2,ndof,n,ivar
+    real(prec),pointer :: sL(:,:),sR(:,:),dsdx(:,:,:),fb(:,:)
+    real(prec),pointer :: nhat(:,:),nmag(:)
+
+    nb = 6*(this%solution%N+1)**2
+    ndof = nb*this%mesh%nElem
+    sL(1:ndof,1:this%nvar) => this%solution%boundary ! interior solution
+    sR(1:ndof,1:this%nvar) => this%solution%extboundary ! exterior solution
+    dsdx(1:ndof,1:this%nvar,1:3) => this%solutiongradient%avgboundary
+    fb(1:ndof,1:this%nvar) => this%flux%boundaryNormal
+    nhat(1:ndof,1:3) => this%geometry%nHat%boundary
+    nmag(1:ndof) => this%geometry%nScale%boundary
+
+    e1 = 1
+    do
+      call NextActiveRun(this%rateLevel,this%lts_activeLevel,e1,e2)
+      if(e1 > this%mesh%nElem) exit
+      n1 = (e1-1)*nb+1
+      n2 = e2*nb
+      call this%riemannflux3d_batch(sL(n1:n2,:),sR(n1:n2,:),dsdx(n1:n2,:,:), &
+                                    nhat(n1:n2,:),fb(n1:n2,:))
+      do concurrent(n=n1:n2,ivar=1:this%nvar)
+        fb(n,ivar) = fb(n,ivar)*nmag(n)
+      enddo
+      e1 = e2+1
     enddo
 
   endsubroutine BoundaryFlux_DGModel3D_t
 
   subroutine sourcemethod_DGModel3D_t(this)
+    !! Evaluates source3d_batch on each contiguous range of active elements
     implicit none
     class(DGModel3D_t),intent(inout) :: this
     ! Local
-    integer :: i,j,k,iel
-    real(prec) :: s(1:this%nvar),dsdx(1:this%nvar,1:3)
-
-    do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
-                  k=1:this%solution%N+1,iel=1:this%mesh%nElem)
-
-      s = this%solution%interior(i,j,k,iel,1:this%nvar)
-      dsdx = this%solutionGradient%interior(i,j,k,iel,1:this%nvar,1:3)
-      this%source%interior(i,j,k,iel,1:this%nvar) = this%source3d(s,dsdx)
-
+    integer :: e1,e2,np,n1,n2,ndof
+    real(prec),pointer :: s(:,:),dsdx(:,:,:),src(:,:)
+
+    np = (this%solution%N+1)**3
+    ndof = np*this%mesh%nElem
+    s(1:ndof,1:this%nvar) => this%solution%interior
+    dsdx(1:ndof,1:this%nvar,1:3) => this%solutionGradient%interior
+    src(1:ndof,1:this%nvar) => this%source%interior
+
+    e1 = 1
+    do
+      call NextActiveRun(this%rateLevel,this%lts_activeLevel,e1,e2)
+      if(e1 > this%mesh%nElem) exit
+      n1 = (e1-1)*np+1
+      n2 = e2*np
+      call this%source3d_batch(s(n1:n2,:),dsdx(n1:n2,:,:),src(n1:n2,:))
+      e1 = e2+1
     enddo
 
   endsubroutine sourcemethod_DGModel3D_t
@@ -549,19 +1192,33 @@ contains
 
   endsubroutine setgradientboundarycondition_DGModel3D_t
 
-  subroutine CalculateTendency_DGModel3D_t(this)
+  subroutine FluxDivergenceVolume_DGModel3D_t(this)
+    !! Computes the volume term of the flux divergence from the flux set by FluxMethod.
+    !! Models with a purpose-built volume kernel, such as the flux differencing of the
+    !! Euler models, override this method.
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+
+    call this%flux%MappedDGDivergenceVolume(this%fluxDivergence%interior)
+
+  endsubroutine FluxDivergenceVolume_DGModel3D_t
+
+  subroutine CalculateFluxDivergence_DGModel3D_t(this)
+    !! Calculates the source and the flux divergence, without assembling the tendency dSdt
     implicit none
     class(DGModel3D_t),intent(inout) :: this
-    ! Local
-    integer :: i,j,k,iVar,iEl
 
     call this%solution%BoundaryInterp()
-    call this%solution%SideExchange(this%mesh)
+    ! The halo exchange is started here and completed once the work that only
+    ! needs the element interiors is done
+    call this%solution%SideExchangeBegin(this%mesh)
 
     call this%PreTendency() ! User-supplied
-    call this%SetBoundaryCondition() ! User-supplied
 
     if(this%gradient_enabled) then
+      ! The solution gradient needs the neighbor data, so the exchange is finished first
+      call this%solution%SideExchangeEnd(this%mesh)
+      call this%SetBoundaryCondition() ! User-supplied
       call this%solution%AverageSides()
       call this%CalculateSolutionGradient()
       call this%SetGradientBoundaryCondition() ! User-supplied
@@ -569,10 +1226,26 @@ contains
     endif
 
     call this%SourceMethod() ! User supplied
-    call this%BoundaryFlux() ! User supplied
     call this%FluxMethod() ! User supplied
+    call this%FluxDivergenceVolume()
 
-    call this%flux%MappedDGDivergence(this%fluxDivergence%interior)
+    if(.not. this%gradient_enabled) then
+      call this%solution%SideExchangeEnd(this%mesh)
+      call this%SetBoundaryCondition() ! User-supplied
+    endif
+
+    call this%BoundaryFlux() ! User supplied
+    call this%flux%MappedDGDivergenceSurface(this%fluxDivergence%interior)
+
+  endsubroutine CalculateFluxDivergence_DGModel3D_t
+
+  subroutine CalculateTendency_DGModel3D_t(this)
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    ! Local
+    integer :: i,j,k,iVar,iEl
+
+    call this%CalculateFluxDivergence()
 
     do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
                   k=1:this%solution%N+1,iel=1:this%mesh%nElem,ivar=1:this%solution%nVar)
@@ -585,7 +1258,36 @@ contains
 
   endsubroutine CalculateTendency_DGModel3D_t
 
+  subroutine CalculateExplicitTendency_DGModel3D_t(this)
+    !! Calculates the tendency with a zero solution gradient, which leaves out the terms that
+    !! need gradient_enabled (e.g. diffusion). This is the explicit part of the tendency for
+    !! the IMEX methods.
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    ! Local
+    logical :: gradient_enabled
+
+    gradient_enabled = this%gradient_enabled
+    this%gradient_enabled = .false.
+    this%solutionGradient%interior = 0.0_prec
+    this%solutionGradient%avgBoundary = 0.0_prec
+    call this%solutionGradient%UpdateDevice()
+
+    call this%CalculateTendency()
+
+    this%gradient_enabled = gradient_enabled
+
+  endsubroutine CalculateExplicitTendency_DGModel3D_t
+
   subroutine Write_DGModel3D_t(this,fileName)
+    !! Writes the solution on the control grid to a pickup file. When
+    !! geometry_file_enabled is set, the interpolant and geometry are written
+    !! once, to geometryFile in the same directory as the pickup file, and the
+    !! pickup file holds external links to them in place of copies.
+    !!
+    !! When async_io_enabled is set, the solution is written by the asyncWriter
+    !! after the file is closed, and the datasets are stored losslessly following
+    !! outputStorage, as in Write_DGModel2D_t.
     implicit none
     class(DGModel3D_t),intent(inout) :: this
     character(*),optional,intent(in) :: fileName
@@ -593,6 +1295,10 @@ contains
     integer(HID_T) :: fileId
     character(LEN=self_FileNameLength) :: pickupFile
     character(13) :: timeStampString
+    integer :: ndof,mpiComm
+    integer(MPI_OFFSET_KIND) :: localOffset
+    integer(MPI_OFFSET_KIND),allocatable :: datasetOffset(:)
+    real(prec),pointer :: s(:,:)
 
     if(present(filename)) then
       pickupFile = filename
@@ -601,54 +1307,186 @@ contains
       pickupFile = 'solution.'//timeStampString//'.h5'
     endif
 
+    if(this%geometry_file_enabled .and. (.not. this%geometry_file_written)) then
+      call this%WriteGeometry(pickupFile(1:index(pickupFile,'/',back=.true.))//trim(this%geometryFile))
+      this%geometry_file_written = .true.
+    endif
+
     print*,__FILE__//" : Writing pickup file : "//trim(pickupFile)
+    if(this%ab_nhistory > 0) call this%abHistory%UpdateHost()
+
+    if(this%async_io_enabled) then
+      if(this%asyncWriter%depth /= this%async_io_depth) then
+        call this%asyncWriter%Init(this%async_io_depth)
+      endif
+      call this%solution%UpdateHost()
+      ndof = (this%solution%interp%N+1)**3*this%solution%nElem
+      s(1:ndof,1:this%nvar) => this%solution%interior
+      call this%asyncWriter%Snapshot(s)
+      allocate(datasetOffset(1:this%nvar))
+    endif
 
     if(this%mesh%decomp%mpiEnabled) then
 
       call Open_HDF5(pickupFile,H5F_ACC_TRUNC_F,fileId,this%mesh%decomp%mpiComm)
 
       ! Write the interpolant to the file
-      call this%solution%interp%WriteHDF5(fileId)
+      if(this%geometry_file_enabled) then
+        call CreateExternalLink_HDF5(fileId,'/interp',this%geometryFile,'/interp')
+      else
+        call this%solution%interp%WriteHDF5(fileId)
+      endif
 
       ! In this section, we write the solution and geometry on the control (quadrature) grid
       ! which can be used for model pickup runs or post-processing
       ! Write the model state to file
       call CreateGroup_HDF5(fileId,'/controlgrid')
-      call this%solution%WriteHDF5(fileId,'/controlgrid/solution', &
-                                   this%mesh%decomp%offsetElem(this%mesh%decomp%rankId+1),this%mesh%decomp%nElem)
+      if(this%async_io_enabled) then
+        call CreateSolutionDatasets_DGModel3D_t(this,fileId,this%mesh%decomp%nElem,datasetOffset)
+      else
+        call this%solution%WriteHDF5(fileId,'/controlgrid/solution', &
+                                     this%mesh%decomp%offsetElem(this%mesh%decomp%rankId+1),this%mesh%decomp%nElem, &
+                                     storage=this%outputStorage%Lossless())
+      endif
+
+      ! Write the Adams-Bashforth tendency history, for pickup runs with a multistep method
+      if(this%ab_nhistory > 0) then
+        call this%abHistory%WriteHDF5(fileId,'/controlgrid/abhistory', &
+                                      this%mesh%decomp%offsetElem(this%mesh%decomp%rankId+1),this%mesh%decomp%nElem, &
+                                      storage=this%outputStorage%Lossless())
+        call this%WriteABState(fileId)
+      endif
 
       ! Write the geometry to file
-      call this%geometry%x%WriteHDF5(fileId,'/controlgrid/geometry', &
-                                     this%mesh%decomp%offsetElem(this%mesh%decomp%rankId+1),this%mesh%decomp%nElem)
+      if(this%geometry_file_enabled) then
+        call CreateExternalLink_HDF5(fileId,'/controlgrid/geometry',this%geometryFile,'/controlgrid/geometry')
+      else
+        call this%geometry%x%WriteHDF5(fileId,'/controlgrid/geometry', &
+                                       this%mesh%decomp%offsetElem(this%mesh%decomp%rankId+1),this%mesh%decomp%nElem, &
+                                       storage=this%outputStorage%Lossless())
+      endif
 
       ! -- END : writing solution on control grid -- !
 
       call Close_HDF5(fileId)
 
+      mpiComm = this%mesh%decomp%mpiComm
+      localOffset = int(this%mesh%decomp%offsetElem(this%mesh%decomp%rankId+1),MPI_OFFSET_KIND)* &
+                    (this%solution%interp%N+1)**3*(storage_size(1.0_prec)/8)
+
     else
 
       call Open_HDF5(pickupFile,H5F_ACC_TRUNC_F,fileId)
 
       ! Write the interpolant to the file
-      call this%solution%interp%WriteHDF5(fileId)
+      if(this%geometry_file_enabled) then
+        call CreateExternalLink_HDF5(fileId,'/interp',this%geometryFile,'/interp')
+      else
+        call this%solution%interp%WriteHDF5(fileId)
+      endif
 
       ! In this section, we write the solution and geometry on the control (quadrature) grid
       ! which can be used for model pickup runs or post-processing
 
       ! Write the model state to file
       call CreateGroup_HDF5(fileId,'/controlgrid')
-      call this%solution%WriteHDF5(fileId,'/controlgrid/solution')
+      if(this%async_io_enabled) then
+        call CreateSolutionDatasets_DGModel3D_t(this,fileId,this%solution%nElem,datasetOffset)
+      else
+        call this%solution%WriteHDF5(fileId,'/controlgrid/solution',storage=this%outputStorage%Lossless())
+      endif
+
+      ! Write the Adams-Bashforth tendency history, for pickup runs with a multistep method
+      if(this%ab_nhistory > 0) then
+        call this%abHistory%WriteHDF5(fileId,'/controlgrid/abhistory',storage=this%outputStorage%Lossless())
+        call this%WriteABState(fileId)
+      endif
 
       ! Write the geometry to file
-      call this%geometry%x%WriteHDF5(fileId,'/controlgrid/geometry')
+      if(this%geometry_file_enabled) then
+        call CreateExternalLink_HDF5(fileId,'/controlgrid/geometry',this%geometryFile,'/controlgrid/geometry')
+      else
+        call this%geometry%x%WriteHDF5(fileId,'/controlgrid/geometry',storage=this%outputStorage%Lossless())
+      endif
       ! -- END : writing solution on control grid -- !
 
       call Close_HDF5(fileId)
 
+      mpiComm = MPI_COMM_SELF
+      localOffset = 0
+
+    endif
+
+    if(this%async_io_enabled) then
+      call this%asyncWriter%Post(pickupFile,mpiComm,this%mesh%decomp%mpiPrec,datasetOffset,localOffset)
+      deallocate(datasetOffset)
     endif
 
   endsubroutine Write_DGModel3D_t
 
+  subroutine CreateSolutionDatasets_DGModel3D_t(this,fileId,nGlobalElem,datasetOffset)
+    !! Creates the datasets of /controlgrid/solution, with the same layout as
+    !! MappedScalar3D%WriteHDF5, and returns their offsets in the file
+    implicit none
+    class(DGModel3D_t),intent(in) :: this
+    integer(HID_T),intent(in) :: fileId
+    integer,intent(in) :: nGlobalElem
+    integer(MPI_OFFSET_KIND),intent(out) :: datasetOffset(1:this%nvar)
+    ! Local
+    integer(HSIZE_T) :: globalDims(1:4)
+    integer(HADDR_T) :: fileOffset
+    integer :: ivar
+
+    globalDims(1:4) = (/this%solution%interp%N+1, &
+                        this%solution%interp%N+1, &
+                        this%solution%interp%N+1, &
+                        nGlobalElem/)
+
+    call CreateGroup_HDF5(fileId,'/controlgrid/solution')
+    do ivar = 1,this%nvar
+      if(.not. this%mesh%decomp%mpiEnabled) then
+        call this%solution%meta(ivar)%WriteHDF5('/controlgrid/solution',ivar,fileId)
+      endif
+      call CreateDataset_HDF5(fileId,'/controlgrid/solution/'//trim(this%solution%meta(ivar)%name), &
+                              globalDims,fileOffset)
+      datasetOffset(ivar) = int(fileOffset,MPI_OFFSET_KIND)
+    enddo
+
+  endsubroutine CreateSolutionDatasets_DGModel3D_t
+
+  subroutine WriteGeometry_DGModel3D_t(this,fileName)
+    !! Writes the interpolant and the geometry on the control grid to fileName,
+    !! using the same layout as the pickup files
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    character(*),intent(in) :: fileName
+    ! Local
+    integer(HID_T) :: fileId
+
+    print*,__FILE__//" : Writing geometry file : "//trim(fileName)
+
+    if(this%mesh%decomp%mpiEnabled) then
+
+      call Open_HDF5(fileName,H5F_ACC_TRUNC_F,fileId,this%mesh%decomp%mpiComm)
+      call this%solution%interp%WriteHDF5(fileId)
+      call CreateGroup_HDF5(fileId,'/controlgrid')
+      call this%geometry%x%WriteHDF5(fileId,'/controlgrid/geometry', &
+                                     this%mesh%decomp%offsetElem(this%mesh%decomp%rankId+1),this%mesh%decomp%nElem, &
+                                     storage=this%outputStorage%Lossless())
+      call Close_HDF5(fileId)
+
+    else
+
+      call Open_HDF5(fileName,H5F_ACC_TRUNC_F,fileId)
+      call this%solution%interp%WriteHDF5(fileId)
+      call CreateGroup_HDF5(fileId,'/controlgrid')
+      call this%geometry%x%WriteHDF5(fileId,'/controlgrid/geometry',storage=this%outputStorage%Lossless())
+      call Close_HDF5(fileId)
+
+    endif
+
+  endsubroutine WriteGeometry_DGModel3D_t
+
   subroutine Read_DGModel3D_t(this,fileName)
     implicit none
     class(DGModel3D_t),intent(inout) :: this
@@ -658,6 +1496,9 @@ contains
     integer(HID_T) :: solOffset(1:4)
     integer :: firstElem,ivar
 
+    ! The file may still be in the asynchronous output queue
+    call this%asyncWriter%WaitAll()
+
     if(this%mesh%decomp%mpiEnabled) then
       call Open_HDF5(fileName,H5F_ACC_RDWR_F,fileId, &
                      this%mesh%decomp%mpiComm)
@@ -680,6 +1521,25 @@ contains
                             this%solution%interior(:,:,:,:,ivar))
       enddo
     endif
+    call this%solution%UpdateDevice()
+
+    ! Read the Adams-Bashforth tendency history, when the file holds one for the
+    ! current time integrator
+    if(this%ReadABState(fileId)) then
+      call this%ReserveABHistory()
+      do ivar = 1,this%abHistory%nvar
+        if(this%mesh%decomp%mpiEnabled) then
+          call ReadArray_HDF5(fileId, &
+                              '/controlgrid/abhistory/'//trim(this%abHistory%meta(ivar)%name), &
+                              this%abHistory%interior(:,:,:,:,ivar),solOffset)
+        else
+          call ReadArray_HDF5(fileId, &
+                              '/controlgrid/abhistory/'//trim(this%abHistory%meta(ivar)%name), &
+                              this%abHistory%interior(:,:,:,:,ivar))
+        endif
+      enddo
+      call this%abHistory%UpdateDevice()
+    endif
 
     call Close_HDF5(fileId)
 
@@ -800,4 +1660,184 @@ contains
 
   endsubroutine WriteTecplot_DGModel3D_t
 
+  subroutine InitVisualization_DGModel3D_t(this)
+    !! Creates the uniform grid interpolant and buffers used by WriteXDMF,
+    !! interpolates the mesh positions to the uniform grid, and builds the
+    !! connectivity of the M x M x M hexahedral cells of each element, as in
+    !! InitVisualization_DGModel2D_t
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    ! Local
+    integer :: M,firstElem
+    integer :: i,j,k,iel,p,q
+
+    allocate(this%vizInterp)
+    call this%vizInterp%Init(this%solution%interp%M, &
+                             this%solution%interp%targetNodeType, &
+                             this%solution%interp%N, &
+                             this%solution%interp%controlNodeType)
+
+    call this%vizSolution%Init(this%vizInterp,this%solution%nVar,this%solution%nElem)
+    call this%vizGradient%Init(this%vizInterp,this%solution%nVar,this%solution%nElem)
+    call this%vizX%Init(this%vizInterp,1,this%solution%nElem)
+
+    call this%geometry%x%GridInterp(this%vizX%interior)
+
+    M = this%solution%interp%M
+    firstElem = this%mesh%decomp%offsetElem(this%mesh%decomp%rankId+1)
+    allocate(this%vizCells(1:8,1:M*M*M,1:this%solution%nElem))
+    do concurrent(i=1:M,j=1:M,k=1:M,iel=1:this%solution%nElem)
+      ! p is the first corner of the bottom face of the cell, q of the top face
+      p = (firstElem+iel-1)*(M+1)**3+(i-1)+(j-1)*(M+1)+(k-1)*(M+1)**2
+      q = p+(M+1)**2
+      this%vizCells(1:8,i+(j-1)*M+(k-1)*M*M,iel) = (/p,p+1,p+M+2,p+M+1, &
+                                                     q,q+1,q+M+2,q+M+1/)
+    enddo
+
+  endsubroutine InitVisualization_DGModel3D_t
+
+  subroutine WriteXDMF_DGModel3D_t(this,filename)
+    !! Writes the solution, its gradient (when gradient_enabled is set) and the
+    !! mesh positions on the uniform target grid to filename.h5, with an XDMF
+    !! description in filename.xmf that splits each element into M x M x M
+    !! hexahedra. See WriteXDMF_DGModel2D_t for the file layout.
+    implicit none
+    class(DGModel3D_t),intent(inout) :: this
+    character(*),intent(in),optional :: filename
+    ! Local
+    integer(HID_T) :: fileId
+    integer(HID_T) :: cellOffset(1:3)
+    integer(HID_T) :: cellGlobalDims(1:3)
+    character(LEN=self_FileNameLength) :: vizFile
+    character(LEN=self_FileNameLength) :: h5Name
+    character(LEN=64) :: pointDims,cellDims
+    character(13) :: timeStampString
+    character(4) :: dimvar
+    character(1),parameter :: xName(1:3) = (/'x','y','z'/)
+    integer :: M,nGlobalElem,fUnit,precision
+    integer :: ivar,idir
+
+    if(present(filename)) then
+      vizFile = filename
+    else
+      write(timeStampString,'(I13.13)') this%ioIterate
+      vizFile = 'visualization.'//timeStampString
+    endif
+
+    if(.not. associated(this%vizInterp)) call this%InitVisualization()
+
+    call this%solution%UpdateHost()
+    call this%solution%GridInterp(this%vizSolution%interior)
+    if(this%gradient_enabled) then
+      call this%solutionGradient%UpdateHost()
+      call this%solutionGradient%GridInterp(this%vizGradient%interior)
+    endif
+
+    M = this%solution%interp%M
+    nGlobalElem = this%mesh%decomp%nElem
+
+    if(this%mesh%decomp%mpiEnabled) then
+      call Open_HDF5(trim(vizFile)//'.h5',H5F_ACC_TRUNC_F,fileId,this%mesh%decomp%mpiComm)
+    else
+      call Open_HDF5(trim(vizFile)//'.h5',H5F_ACC_TRUNC_F,fileId)
+    endif
+
+    call CreateGroup_HDF5(fileId,'/mesh')
+    do idir = 1,3
+      call this%WriteVisualizationArray(fileId,'/mesh/'//xName(idir),this%vizX%interior(:,:,:,:,1,idir), &
+                                        this%outputStorage%Lossless())
+    enddo
+    if(this%mesh%decomp%mpiEnabled) then
+      cellOffset(1:3) = (/0,0,this%mesh%decomp%offsetElem(this%mesh%decomp%rankId+1)/)
+      cellGlobalDims(1:3) = (/8,M*M*M,nGlobalElem/)
+      call WriteArray_HDF5(fileId,'/mesh/cells',this%vizCells,cellOffset,cellGlobalDims)
+    else
+      call WriteArray_HDF5(fileId,'/mesh/cells',this%vizCells)
+    endif
+
+    call CreateGroup_HDF5(fileId,'/solution')
+    do ivar = 1,this%nvar
+      call this%WriteVisualizationArray(fileId,'/solution/'//trim(this%solution%meta(ivar)%name), &
+                                        this%vizSolution%interior(:,:,:,:,ivar),this%outputStorage)
+    enddo
+
+    if(this%gradient_enabled) then
+      call CreateGroup_HDF5(fileId,'/gradient')
+      do idir = 1,3
+        write(dimvar,'(I1)') idir
+        dimvar = "dim"//trim(dimvar)
+        do ivar = 1,this%nvar
+          call this%WriteVisualizationArray(fileId, &
+                                            '/gradient/'//trim(this%solution%meta(ivar)%name)//"_"//dimvar, &
+                                            this%vizGradient%interior(:,:,:,:,ivar,idir),this%outputStorage)
+        enddo
+      enddo
+    endif
+
+    call Close_HDF5(fileId)
+
+    if(this%mesh%decomp%rankId /= 0) return
+
+    h5Name = trim(vizFile(index(vizFile,'/',back=.true.)+1:))//'.h5'
+    write(pointDims,'(I0,1x,I0,1x,I0,1x,I0)') nGlobalElem,M+1,M+1,M+1
+    write(cellDims,'(I0,1x,I0,1x,I0)') nGlobalElem,M*M*M,8
+    precision = storage_size(1.0_prec)/8
+
+    call BeginGrid_XDMF(fUnit,trim(vizFile)//'.xmf',this%t,"Hexahedron",nGlobalElem*M*M*M, &
+                        cellDims,trim(h5Name)//':/mesh/cells')
+
+    write(fUnit,'(A)') '   <Geometry GeometryType="X_Y_Z">'
+    do idir = 1,3
+      call WriteDataItem_XDMF(fUnit,pointDims,"Float",precision,trim(h5Name)//':/mesh/'//xName(idir))
+    enddo
+    write(fUnit,'(A)') '   </Geometry>'
+
+    do ivar = 1,this%nvar
+      write(fUnit,'(A)') '   <Attribute Name="'//trim(this%solution%meta(ivar)%name)// &
+        '" AttributeType="Scalar" Center="Node">'
+      call WriteDataItem_XDMF(fUnit,pointDims,"Float",precision, &
+                              trim(h5Name)//':/solution/'//trim(this%solution%meta(ivar)%name))
+      write(fUnit,'(A)') '   </Attribute>'
+    enddo
+
+    if(this%gradient_enabled) then
+      do idir = 1,3
+        write(dimvar,'(I1)') idir
+        dimvar = "dim"//trim(dimvar)
+        do ivar = 1,this%nvar
+          write(fUnit,'(A)') '   <Attribute Name="grad_'//trim(this%solution%meta(ivar)%name)//"_"//dimvar// &
+            '" AttributeType="Scalar" Center="Node">'
+          call WriteDataItem_XDMF(fUnit,pointDims,"Float",precision, &
+                                  trim(h5Name)//':/gradient/'//trim(this%solution%meta(ivar)%name)//"_"//dimvar)
+          write(fUnit,'(A)') '   </Attribute>'
+        enddo
+      enddo
+    endif
+
+    call EndGrid_XDMF(fUnit)
+
+  endsubroutine WriteXDMF_DGModel3D_t
+
+  subroutine WriteVisualizationArray_DGModel3D_t(this,fileId,arrayName,f,storage)
+    !! Writes one field on the uniform grid for WriteXDMF
+    implicit none
+    class(DGModel3D_t),intent(in) :: this
+    integer(HID_T),intent(in) :: fileId
+    character(*),intent(in) :: arrayName
+    real(prec),intent(in) :: f(:,:,:,:)
+    type(HDF5StoragePolicy),intent(in) :: storage
+    ! Local
+    integer(HID_T) :: offset(1:4)
+    integer(HID_T) :: globalDims(1:4)
+
+    if(this%mesh%decomp%mpiEnabled) then
+      offset(1:4) = (/0,0,0,this%mesh%decomp%offsetElem(this%mesh%decomp%rankId+1)/)
+      globalDims(1:4) = (/size(f,1),size(f,2),size(f,3),this%mesh%decomp%nElem/)
+      call WriteArray_HDF5(fileId,arrayName,f,offset,globalDims,storage=storage)
+    else
+      call WriteArray_HDF5(fileId,arrayName,f,storage=storage)
+    endif
+
+  endsubroutine WriteVisualizationArray_DGModel3D_t
+
 endmodule SELF_DGModel3D_t
@@ -34,6 +34,12 @@ module SELF_DomainDecomposition_t
 
   implicit none
 
+  integer,parameter :: SELF_PARTITION_CONTIGUOUS = 0
+  integer,parameter :: SELF_PARTITION_MORTON = 1
+  integer,parameter :: SELF_PARTITION_RCB = 2
+
+  integer,parameter :: SELF_PARTITIONER_LENGTH = 10 ! max length of partitioner methods when specified as char
+
   type DomainDecomposition_t
     logical :: mpiEnabled = .false.
     logical :: initialized = .false.
@@ -49,6 +55,59 @@ module SELF_DomainDecomposition_t
     integer,allocatable :: requests(:)
     integer,allocatable :: stats(:,:)
 
+    integer :: partitioner = SELF_PARTITION_CONTIGUOUS
+      !! The method used to assign elements to ranks (see SetPartitioner)
+    integer,pointer,contiguous,dimension(:) :: localToGlobal => null()
+      !! The mesh file id of each local element. Only set when the elements are
+      !! renumbered by PartitionElements; otherwise local element iel is mesh file
+      !! element offsetElem(rankId+1)+iel.
+    integer :: edgeCut = 0
+      !! The number of sides shared by elements on different ranks, summed over all ranks
+
+    ! Neighbor-rank communication plan for the side exchange. Sides that are shared with
+    ! an element on another rank are grouped by that rank and, within each group, ordered
+    ! by their global side id. Both ranks that share a side see the same ordering, which
+    ! lets all sides and variables bound for one rank travel in a single message.
+    logical :: haloExchangeReady = .false.
+    integer :: nNeighbors = 0
+      !! The number of ranks that share at least one side with this rank
+    integer :: nHaloSides = 0
+      !! The number of local sides whose neighboring element is owned by another rank
+    integer,pointer,contiguous,dimension(:) :: neighborRank => null()
+      !! The rank id of each neighbor
+    integer,pointer,contiguous,dimension(:) :: neighborOffset => null()
+      !! Halo sides neighborOffset(n)+1 through neighborOffset(n+1) are shared with neighborRank(n)
+    integer,pointer,contiguous,dimension(:) :: haloSide => null()
+      !! The local side id of each halo side
+    integer,pointer,contiguous,dimension(:) :: haloElem => null()
+      !! The local element id of each halo side
+    integer,pointer,contiguous,dimension(:) :: haloFlip => null()
+      !! The index flip that maps the neighbor's side data onto the local side
+    real(prec),pointer,contiguous,dimension(:) :: sendBuffer => null()
+    real(prec),pointer,contiguous,dimension(:) :: recvBuffer => null()
+
+    ! Persistent receive and send requests on the halo buffers. A schedule is created the
+    ! first time a given number of values per side is exchanged and is restarted with
+    ! MPI_Startall on every later exchange of that size. The schedules are freed when the
+    ! halo buffers are reallocated or the communication plan is rebuilt.
+    integer :: nSchedules = 0
+    integer :: activeSchedule = 0
+      !! The schedule started by the last HaloExchangeAsync, or 0 when none is in flight
+    integer,allocatable :: scheduleSize(:)
+      !! The number of values per halo side exchanged by each schedule
+    integer,allocatable :: scheduleRequests(:,:)
+      !! The persistent requests of each schedule, scheduleRequests(1:2*nNeighbors,1:nSchedules)
+
+    ! Local elements are classified when the communication plan is built. Rank-boundary
+    ! elements have at least one side shared with another rank; their surface terms
+    ! must wait for the halo exchange, while interior elements only need on-rank data.
+    integer :: nInteriorElem = 0
+    integer :: nRankBoundaryElem = 0
+    integer,pointer,contiguous,dimension(:) :: interiorElem => null()
+      !! Local ids of the elements with no side shared with another rank
+    integer,pointer,contiguous,dimension(:) :: rankBoundaryElem => null()
+      !! Local ids of the elements with at least one side shared with another rank
+
   contains
 
     procedure :: Init => Init_DomainDecomposition_t
@@ -57,6 +116,23 @@ module SELF_DomainDecomposition_t
     procedure :: GenerateDecomposition => GenerateDecomposition_DomainDecomposition_t
     procedure :: SetElemToRank => SetElemToRank_DomainDecomposition_t
 
+    generic,public :: SetPartitioner => SetPartitioner_withChar
+    procedure,private :: SetPartitioner_withChar
+    procedure,public :: PartitionElements => PartitionElements_DomainDecomposition_t
+    procedure,public :: ReportPartition => ReportPartition_DomainDecomposition_t
+
+    procedure,public :: SetupHaloExchange => SetupHaloExchange_DomainDecomposition_t
+    procedure,public :: FreeHaloExchange => FreeHaloExchange_DomainDecomposition_t
+    procedure,public :: ClassifyElements => ClassifyElements_DomainDecomposition_t
+    procedure,public :: ReserveHaloBuffers => ReserveHaloBuffers_DomainDecomposition_t
+    procedure,public :: HaloExchangeAsync => HaloExchangeAsync_DomainDecomposition_t
+    procedure,public :: StartHaloSchedule => StartHaloSchedule_DomainDecomposition_t
+    procedure,public :: FreeHaloSchedules => FreeHaloSchedules_DomainDecomposition_t
+    procedure,public :: PackHalo2D => PackHalo2D_DomainDecomposition_t
+    procedure,public :: UnpackHalo2D => UnpackHalo2D_DomainDecomposition_t
+    procedure,public :: PackHalo3D => PackHalo3D_DomainDecomposition_t
+    procedure,public :: UnpackHalo3D => UnpackHalo3D_DomainDecomposition_t
+
     procedure,public :: FinalizeMPIExchangeAsync
 
   endtype DomainDecomposition_t
@@ -115,10 +191,15 @@ contains
     if(associated(this%elemToRank)) then
       deallocate(this%elemToRank)
     endif
+    if(associated(this%localToGlobal)) then
+      deallocate(this%localToGlobal)
+    endif
 
     if(allocated(this%requests)) deallocate(this%requests)
     if(allocated(this%stats)) deallocate(this%stats)
 
+    call this%FreeHaloExchange()
+
     !if(this%mpiEnabled) then
     print*,__FILE__," : Rank ",this%rankId+1,"/",this%nRanks," checking out."
     call MPI_FINALIZE(ierror)
@@ -228,18 +309,643 @@ contains
 
   endsubroutine ElemToRank
 
+  subroutine SetPartitioner_withChar(this,partitioner)
+    !! Sets the method used to assign elements to ranks, using a character input
+    !!
+    !! Valid options for partitioner are
+    !!
+    !!   "contiguous" : Contiguous ranges of the mesh file element ids (default)
+    !!   "morton"     : Contiguous ranges of a Morton (Z-order) curve through the element centroids
+    !!   "rcb"        : Recursive coordinate bisection of the element centroids
+    !!
+    !! Note that the character provided is not case-sensitive
+    !!
+    implicit none
+    class(DomainDecomposition_t),intent(inout) :: this
+    character(*),intent(in) :: partitioner
+    ! Local
+    character(SELF_PARTITIONER_LENGTH) :: upperCasePart
+
+    upperCasePart = UpperCase(trim(partitioner))
+
+    select case(trim(upperCasePart))
+
+    case("CONTIGUOUS")
+      this%partitioner = SELF_PARTITION_CONTIGUOUS
+
+    case("MORTON")
+      this%partitioner = SELF_PARTITION_MORTON
+
+    case("RCB")
+      this%partitioner = SELF_PARTITION_RCB
+
+    case DEFAULT
+      print*,__FILE__//" : Unknown partitioner "//trim(partitioner)//". Using contiguous partitioning."
+      this%partitioner = SELF_PARTITION_CONTIGUOUS
+
+    endselect
+
+  endsubroutine SetPartitioner_withChar
+
+  subroutine PartitionElements_DomainDecomposition_t(this,centroid,newElemId)
+    !! Assigns elements to ranks from their centroids, using the selected partitioner.
+    !!
+    !! The elements are renumbered so that each rank owns a contiguous range of the
+    !! new element ids; offsetElem and elemToRank are given in the new numbering,
+    !! so the rest of SELF can continue to use offset arithmetic. On output,
+    !! newElemId(e) is the new id of mesh file element e, and localToGlobal(iel) is
+    !! the mesh file id of local element iel. Every rank computes the same partition
+    !! from the same centroids, without communication.
+    implicit none
+    class(DomainDecomposition_t),intent(inout) :: this
+    real(prec),intent(in) :: centroid(:,:)
+    !! Element centroids, centroid(1:nDim,1:nGlobalElem), in mesh file order
+    integer,intent(out) :: newElemId(:)
+    ! Local
+    integer :: nGlobalElem,iel,ie,r
+    integer,allocatable :: order(:),elemRank(:),nPerRank(:)
+    integer(int64),allocatable :: key(:)
+
+    nGlobalElem = size(centroid,2)
+    allocate(order(1:nGlobalElem),elemRank(1:nGlobalElem),nPerRank(0:this%nRanks-1))
+
+    select case(this%partitioner)
+
+    case(SELF_PARTITION_MORTON)
+      allocate(key(1:nGlobalElem))
+      call MortonKeys(centroid,key)
+      call SortIndex(key,order,nGlobalElem)
+      deallocate(key)
+
+      ! Split the curve into the same contiguous counts as DomainDecomp
+      call DomainDecomp(nGlobalElem,this%nRanks,this%offsetElem)
+
+    case(SELF_PARTITION_RCB)
+      do iel = 1,nGlobalElem
+        order(iel) = iel
+      enddo
+      ! On output, order is grouped by rank in ascending rank order
+      call BisectElements(centroid,order,0,this%nRanks,elemRank)
+
+      nPerRank = 0
+      do iel = 1,nGlobalElem
+        nPerRank(elemRank(iel)) = nPerRank(elemRank(iel))+1
+      enddo
+      this%offsetElem(1) = 0
+      do r = 0,this%nRanks-1
+        this%offsetElem(r+2) = this%offsetElem(r+1)+nPerRank(r)
+      enddo
+
+    case default
+      do iel = 1,nGlobalElem
+        order(iel) = iel
+      enddo
+      call DomainDecomp(nGlobalElem,this%nRanks,this%offsetElem)
+
+    endselect
+
+    do ie = 1,nGlobalElem
+      newElemId(order(ie)) = ie
+    enddo
+
+    do iel = 1,nGlobalElem
+      call ElemToRank(this%nRanks, &
+                      this%offSetElem, &
+                      iel, &
+                      this%elemToRank(iel))
+    enddo
+
+    if(associated(this%localToGlobal)) deallocate(this%localToGlobal)
+    allocate(this%localToGlobal(1:this%offsetElem(this%rankId+2)-this%offsetElem(this%rankId+1)))
+    do iel = 1,size(this%localToGlobal)
+      this%localToGlobal(iel) = order(this%offsetElem(this%rankId+1)+iel)
+    enddo
+
+    deallocate(order,elemRank,nPerRank)
+
+  endsubroutine PartitionElements_DomainDecomposition_t
+
+  subroutine MortonKeys(centroid,key)
+    !! Computes the Morton (Z-order) key of each point by interleaving the bits of
+    !! its coordinates, quantized on the bounding box of all points
+    implicit none
+    real(prec),intent(in) :: centroid(:,:)
+    integer(int64),intent(out) :: key(:)
+    ! Local
+    integer :: nDim,nBits,iel,idim,ibit
+    integer(int64) :: q(1:3)
+    real(prec) :: xmin(1:3),xmax(1:3),width
+
+    nDim = size(centroid,1)
+    nBits = 63/nDim
+    do idim = 1,nDim
+      xmin(idim) = minval(centroid(idim,:))
+      xmax(idim) = maxval(centroid(idim,:))
+    enddo
+
+    do iel = 1,size(centroid,2)
+      do idim = 1,nDim
+        width = max(xmax(idim)-xmin(idim),tiny(1.0_prec))
+        q(idim) = int((centroid(idim,iel)-xmin(idim))/width*real(2_int64**nBits-1,prec),int64)
+      enddo
+      key(iel) = 0_int64
+      do ibit = nBits-1,0,-1
+        do idim = nDim,1,-1
+          key(iel) = ishft(key(iel),1)
+          if(btest(q(idim),ibit)) key(iel) = ibset(key(iel),0)
+        enddo
+      enddo
+    enddo
+
+  endsubroutine MortonKeys
+
+  recursive subroutine BisectElements(centroid,elems,firstRank,nRanks,elemRank)
+    !! Recursive coordinate bisection. The elements in elems are split along the
+    !! longest side of their bounding box, in proportion to the number of ranks
+    !! assigned to each half, until each set holds the elements of one rank.
+    implicit none
+    real(prec),intent(in) :: centroid(:,:)
+    integer,intent(inout) :: elems(:)
+    !! Mesh file ids of the elements to split; reordered on output
+    integer,intent(in) :: firstRank
+    integer,intent(in) :: nRanks
+    integer,intent(inout) :: elemRank(:)
+    ! Local
+    integer :: n,nLeftRanks,nLeft,idim,splitDim,ie
+    integer,allocatable :: perm(:),sorted(:)
+    integer(int64),allocatable :: key(:)
+    real(prec) :: xmin,xmax,width,widest
+
+    n = size(elems)
+    if(nRanks == 1 .or. n == 0) then
+      do ie = 1,n
+        elemRank(elems(ie)) = firstRank
+      enddo
+      return
+    endif
+
+    ! Split along the longest side of the bounding box
+    splitDim = 1
+    widest = -1.0_prec
+    do idim = 1,size(centroid,1)
+      xmin = minval(centroid(idim,elems))
+      xmax = maxval(centroid(idim,elems))
+      if(xmax-xmin > widest) then
+        widest = xmax-xmin
+        splitDim = idim
+      endif
+    enddo
+
+    xmin = minval(centroid(splitDim,elems))
+    width = max(widest,tiny(1.0_prec))
+    allocate(key(1:n),perm(1:n),sorted(1:n))
+    do ie = 1,n
+      key(ie) = int((centroid(splitDim,elems(ie))-xmin)/width*real(2_int64**52,prec),int64)
+    enddo
+    call SortIndex(key,perm,n)
+    do ie = 1,n
+      sorted(ie) = elems(perm(ie))
+    enddo
+    elems = sorted
+    deallocate(key,perm,sorted)
+
+    nLeftRanks = nRanks/2
+    nLeft = int((int(n,int64)*nLeftRanks)/nRanks)
+
+    call BisectElements(centroid,elems(1:nLeft),firstRank,nLeftRanks,elemRank)
+    call BisectElements(centroid,elems(nLeft+1:n),firstRank+nLeftRanks,nRanks-nLeftRanks,elemRank)
+
+  endsubroutine BisectElements
+
+  subroutine ReportPartition_DomainDecomposition_t(this)
+    !! Reports the partition quality : the number of elements, halo sides, neighbor ranks
+    !! and rank-boundary elements on each rank, and the global edge cut (the number of
+    !! sides shared by elements on different ranks).
+    implicit none
+    class(DomainDecomposition_t),intent(inout) :: this
+    ! Local
+    integer :: ierror
+
+    call mpi_allreduce(this%nHaloSides, &
+                       this%edgeCut, &
+                       1, &
+                       MPI_INTEGER, &
+                       MPI_SUM, &
+                       this%mpiComm, &
+                       iError)
+    ! Each shared side is counted once by each of the two ranks
+    this%edgeCut = this%edgeCut/2
+
+    print*,__FILE__//" : Rank ",this%rankId+1," : n_elements = ", &
+      this%offSetElem(this%rankId+2)-this%offSetElem(this%rankId+1), &
+      ", halo sides = ",this%nHaloSides, &
+      ", neighbor ranks = ",this%nNeighbors, &
+      ", rank boundary elements = ",this%nRankBoundaryElem
+    if(this%rankId == 0) then
+      print*,__FILE__//" : Edge cut = ",this%edgeCut
+    endif
+
+  endsubroutine ReportPartition_DomainDecomposition_t
+
+  subroutine SetupHaloExchange_DomainDecomposition_t(this,sideInfo)
+    !! Builds the neighbor-rank communication plan from the mesh side information and
+    !! the element-to-rank map. This is called once, after the mesh sides (and their
+    !! flips) are final.
+    implicit none
+    class(DomainDecomposition_t),intent(inout) :: this
+    integer,intent(in) :: sideInfo(:,:,:)
+    !! Side information for the local elements, sideInfo(1:5,1:nSides,1:nLocalElem)
+    ! Local
+    integer :: e1,s1,e2,s2,r2,ihalo,n
+    integer(int64) :: maxSideId
+    integer,allocatable :: perm(:),rank(:),side(:),elem(:),flip(:)
+    integer(int64),allocatable :: key(:)
+
+    call this%FreeHaloExchange()
+
+    this%nHaloSides = 0
+    maxSideId = 0
+    do e1 = 1,size(sideInfo,3)
+      do s1 = 1,size(sideInfo,2)
+        e2 = sideInfo(3,s1,e1)
+        if(e2 > 0) then
+          if(this%elemToRank(e2) /= this%rankId) then
+            this%nHaloSides = this%nHaloSides+1
+            maxSideId = max(maxSideId,int(abs(sideInfo(2,s1,e1)),int64))
+          endif
+        endif
+      enddo
+    enddo
+
+    allocate(key(1:this%nHaloSides),perm(1:this%nHaloSides), &
+             rank(1:this%nHaloSides),side(1:this%nHaloSides), &
+             elem(1:this%nHaloSides),flip(1:this%nHaloSides))
+
+    ihalo = 0
+    do e1 = 1,size(sideInfo,3)
+      do s1 = 1,size(sideInfo,2)
+        e2 = sideInfo(3,s1,e1)
+        if(e2 > 0) then
+          r2 = this%elemToRank(e2)
+          if(r2 /= this%rankId) then
+            ihalo = ihalo+1
+            s2 = sideInfo(4,s1,e1)/10
+            rank(ihalo) = r2
+            side(ihalo) = s1
+            elem(ihalo) = e1
+            flip(ihalo) = sideInfo(4,s1,e1)-s2*10
+            ! Order by neighbor rank first, then by global side id
+            key(ihalo) = int(r2,int64)*(maxSideId+1)+int(abs(sideInfo(2,s1,e1)),int64)
+          endif
+        endif
+      enddo
+    enddo
+
+    call SortIndex(key,perm,this%nHaloSides)
+
+    allocate(this%haloSide(1:this%nHaloSides), &
+             this%haloElem(1:this%nHaloSides), &
+             this%haloFlip(1:this%nHaloSides))
+
+    this%nNeighbors = 0
+    do ihalo = 1,this%nHaloSides
+      this%haloSide(ihalo) = side(perm(ihalo))
+      this%haloElem(ihalo) = elem(perm(ihalo))
+      this%haloFlip(ihalo) = flip(perm(ihalo))
+      if(ihalo == 1) then
+        this%nNeighbors = 1
+      elseif(rank(perm(ihalo)) /= rank(perm(ihalo-1))) then
+        this%nNeighbors = this%nNeighbors+1
+      endif
+    enddo
+
+    allocate(this%neighborRank(1:this%nNeighbors), &
+             this%neighborOffset(1:this%nNeighbors+1))
+
+    n = 0
+    do ihalo = 1,this%nHaloSides
+      if(ihalo == 1) then
+        n = 1
+        this%neighborRank(n) = rank(perm(ihalo))
+        this%neighborOffset(n) = 0
+      elseif(rank(perm(ihalo)) /= rank(perm(ihalo-1))) then
+        n = n+1
+        this%neighborRank(n) = rank(perm(ihalo))
+        this%neighborOffset(n) = ihalo-1
+      endif
+    enddo
+    this%neighborOffset(this%nNeighbors+1) = this%nHaloSides
+
+    ! One send and one receive per neighbor
+    if(allocated(this%requests)) then
+      if(size(this%requests) < 2*this%nNeighbors) then
+        deallocate(this%requests,this%stats)
+      endif
+    endif
+    if(.not. allocated(this%requests)) then
+      allocate(this%requests(1:max(2*this%nNeighbors,1)))
+      allocate(this%stats(MPI_STATUS_SIZE,1:max(2*this%nNeighbors,1)))
+      this%maxMsg = max(2*this%nNeighbors,1)
+    endif
+
+    deallocate(key,perm,rank,side,elem,flip)
+
+    call this%ClassifyElements(size(sideInfo,3))
+
+    this%haloExchangeReady = .true.
+
+    if(this%mpiEnabled) call this%ReportPartition()
+
+  endsubroutine SetupHaloExchange_DomainDecomposition_t
+
+  subroutine FreeHaloExchange_DomainDecomposition_t(this)
+    implicit none
+    class(DomainDecomposition_t),intent(inout) :: this
+
+    if(associated(this%neighborRank)) deallocate(this%neighborRank)
+    if(associated(this%neighborOffset)) deallocate(this%neighborOffset)
+    if(associated(this%haloSide)) deallocate(this%haloSide)
+    if(associated(this%haloElem)) deallocate(this%haloElem)
+    if(associated(this%haloFlip)) deallocate(this%haloFlip)
+    if(associated(this%sendBuffer)) deallocate(this%sendBuffer)
+    if(associated(this%recvBuffer)) deallocate(this%recvBuffer)
+    if(associated(this%interiorElem)) deallocate(this%interiorElem)
+    if(associated(this%rankBoundaryElem)) deallocate(this%rankBoundaryElem)
+    call this%FreeHaloSchedules()
+    this%nNeighbors = 0
+    this%nHaloSides = 0
+    this%nInteriorElem = 0
+    this%nRankBoundaryElem = 0
+    this%haloExchangeReady = .false.
+
+  endsubroutine FreeHaloExchange_DomainDecomposition_t
+
+  subroutine ClassifyElements_DomainDecomposition_t(this,nLocalElem)
+    !! Splits the local elements into interior and rank-boundary elements, using the
+    !! halo side list of the communication plan
+    implicit none
+    class(DomainDecomposition_t),intent(inout) :: this
+    integer,intent(in) :: nLocalElem
+    ! Local
+    logical,allocatable :: onRankBoundary(:)
+    integer :: iel,ihalo
+
+    allocate(onRankBoundary(1:nLocalElem))
+    onRankBoundary = .false.
+    do ihalo = 1,this%nHaloSides
+      onRankBoundary(this%haloElem(ihalo)) = .true.
+    enddo
+
+    this%nRankBoundaryElem = count(onRankBoundary)
+    this%nInteriorElem = nLocalElem-this%nRankBoundaryElem
+    allocate(this%interiorElem(1:this%nInteriorElem), &
+             this%rankBoundaryElem(1:this%nRankBoundaryElem))
+
+    this%nInteriorElem = 0
+    this%nRankBoundaryElem = 0
+    do iel = 1,nLocalElem
+      if(onRankBoundary(iel)) then
+        this%nRankBoundaryElem = this%nRankBoundaryElem+1
+        this%rankBoundaryElem(this%nRankBoundaryElem) = iel
+      else
+        this%nInteriorElem = this%nInteriorElem+1
+        this%interiorElem(this%nInteriorElem) = iel
+      endif
+    enddo
+
+    deallocate(onRankBoundary)
+
+  endsubroutine ClassifyElements_DomainDecomposition_t
+
+  subroutine ReserveHaloBuffers_DomainDecomposition_t(this,n)
+    !! Ensures that the send and receive buffers hold at least n values
+    implicit none
+    class(DomainDecomposition_t),intent(inout) :: this
+    integer,intent(in) :: n
+
+    if(associated(this%sendBuffer)) then
+      if(size(this%sendBuffer) >= n) return
+      ! The persistent requests are bound to the old buffers
+      call this%FreeHaloSchedules()
+      deallocate(this%sendBuffer,this%recvBuffer)
+    endif
+    allocate(this%sendBuffer(1:max(n,1)),this%recvBuffer(1:max(n,1)))
+
+  endsubroutine ReserveHaloBuffers_DomainDecomposition_t
+
+  subroutine HaloExchangeAsync_DomainDecomposition_t(this,nPerSide)
+    !! Starts one receive and one send per neighbor rank. The data bound for each neighbor
+    !! must already be packed in the send buffer with PackHalo2D or PackHalo3D. nPerSide
+    !! is the number of values packed for each halo side (all variables included).
+    implicit none
+    class(DomainDecomposition_t),intent(inout) :: this
+    integer,intent(in) :: nPerSide
+
+    call this%StartHaloSchedule(nPerSide,this%sendBuffer,this%recvBuffer)
+
+  endsubroutine HaloExchangeAsync_DomainDecomposition_t
+
+  subroutine StartHaloSchedule_DomainDecomposition_t(this,nPerSide,sendBuffer,recvBuffer)
+    !! Starts the persistent requests that exchange nPerSide values per halo side between
+    !! sendBuffer and recvBuffer. The requests are created on the first exchange of this
+    !! size; the buffers must stay at the same address until FreeHaloSchedules is called.
+    implicit none
+    class(DomainDecomposition_t),intent(inout) :: this
+    integer,intent(in) :: nPerSide
+    real(prec),contiguous,intent(inout) :: sendBuffer(:)
+    real(prec),contiguous,intent(inout) :: recvBuffer(:)
+    ! Local
+    integer :: n,i1,i2,is,iError
+    integer,allocatable :: sizeTmp(:),requestTmp(:,:)
+
+    is = 0
+    do n = 1,this%nSchedules
+      if(this%scheduleSize(n) == nPerSide) is = n
+    enddo
+
+    if(is == 0) then
+      ! Add a schedule for this message size
+      allocate(sizeTmp(1:this%nSchedules+1),requestTmp(1:max(2*this%nNeighbors,1),1:this%nSchedules+1))
+      if(this%nSchedules > 0) then
+        sizeTmp(1:this%nSchedules) = this%scheduleSize(1:this%nSchedules)
+        requestTmp(:,1:this%nSchedules) = this%scheduleRequests(:,1:this%nSchedules)
+      endif
+      call move_alloc(sizeTmp,this%scheduleSize)
+      call move_alloc(requestTmp,this%scheduleRequests)
+      this%nSchedules = this%nSchedules+1
+      is = this%nSchedules
+      this%scheduleSize(is) = nPerSide
+
+      do n = 1,this%nNeighbors
+        i1 = nPerSide*this%neighborOffset(n)+1
+        i2 = nPerSide*this%neighborOffset(n+1)
+
+        call MPI_RECV_INIT(recvBuffer(i1:i2), &
+                           i2-i1+1, &
+                           this%mpiPrec, &
+                           this%neighborRank(n),0, &
+                           this%mpiComm, &
+                           this%scheduleRequests(2*n-1,is),iError)
+
+        call MPI_SEND_INIT(sendBuffer(i1:i2), &
+                           i2-i1+1, &
+                           this%mpiPrec, &
+                           this%neighborRank(n),0, &
+                           this%mpiComm, &
+                           this%scheduleRequests(2*n,is),iError)
+      enddo
+    endif
+
+    if(this%nNeighbors > 0) then
+      call MPI_STARTALL(2*this%nNeighbors,this%scheduleRequests(1:2*this%nNeighbors,is),iError)
+    endif
+    this%activeSchedule = is
+    this%msgCount = 2*this%nNeighbors
+
+  endsubroutine StartHaloSchedule_DomainDecomposition_t
+
+  subroutine FreeHaloSchedules_DomainDecomposition_t(this)
+    !! Releases the persistent requests of all halo exchange schedules
+    implicit none
+    class(DomainDecomposition_t),intent(inout) :: this
+    ! Local
+    integer :: is,n,iError
+
+    do is = 1,this%nSchedules
+      do n = 1,2*this%nNeighbors
+        call MPI_REQUEST_FREE(this%scheduleRequests(n,is),iError)
+      enddo
+    enddo
+    if(allocated(this%scheduleSize)) deallocate(this%scheduleSize)
+    if(allocated(this%scheduleRequests)) deallocate(this%scheduleRequests)
+    this%nSchedules = 0
+    this%activeSchedule = 0
+
+  endsubroutine FreeHaloSchedules_DomainDecomposition_t
+
+  subroutine PackHalo2D_DomainDecomposition_t(this,boundary,N,nVar,nElem)
+    !! Copies the boundary data of every halo side into the send buffer, ordered
+    !! by halo side and then by variable.
+    implicit none
+    class(DomainDecomposition_t),intent(inout) :: this
+    integer,intent(in) :: N,nVar,nElem
+    real(prec),intent(in) :: boundary(1:N+1,1:4,1:nElem,1:nVar)
+    ! Local
+    real(prec),pointer,contiguous :: buffer(:,:,:)
+    integer :: i,ivar,ihalo
+
+    call this%ReserveHaloBuffers((N+1)*nVar*this%nHaloSides)
+    buffer(1:N+1,1:nVar,1:this%nHaloSides) => this%sendBuffer
+
+    do concurrent(i=1:N+1,ivar=1:nVar,ihalo=1:this%nHaloSides)
+      buffer(i,ivar,ihalo) = boundary(i,this%haloSide(ihalo),this%haloElem(ihalo),ivar)
+    enddo
+
+  endsubroutine PackHalo2D_DomainDecomposition_t
+
+  subroutine UnpackHalo2D_DomainDecomposition_t(this,extBoundary,N,nVar,nElem)
+    !! Copies the received neighbor data into extBoundary, applying the side flip
+    implicit none
+    class(DomainDecomposition_t),intent(inout) :: this
+    integer,intent(in) :: N,nVar,nElem
+    real(prec),intent(inout) :: extBoundary(1:N+1,1:4,1:nElem,1:nVar)
+    ! Local
+    real(prec),pointer,contiguous :: buffer(:,:,:)
+    integer :: i,i2,ivar,ihalo
+
+    buffer(1:N+1,1:nVar,1:this%nHaloSides) => this%recvBuffer
+
+    do concurrent(i=1:N+1,ivar=1:nVar,ihalo=1:this%nHaloSides)
+      if(this%haloFlip(ihalo) == 1) then
+        i2 = N+2-i
+      else
+        i2 = i
+      endif
+      extBoundary(i,this%haloSide(ihalo),this%haloElem(ihalo),ivar) = buffer(i2,ivar,ihalo)
+    enddo
+
+  endsubroutine UnpackHalo2D_DomainDecomposition_t
+
+  subroutine PackHalo3D_DomainDecomposition_t(this,boundary,N,nVar,nElem)
+    !! Copies the boundary data of every halo side into the send buffer, ordered
+    !! by halo side and then by variable.
+    implicit none
+    class(DomainDecomposition_t),intent(inout) :: this
+    integer,intent(in) :: N,nVar,nElem
+    real(prec),intent(in) :: boundary(1:N+1,1:N+1,1:6,1:nElem,1:nVar)
+    ! Local
+    real(prec),pointer,contiguous :: buffer(:,:,:,:)
+    integer :: i,j,ivar,ihalo
+
+    call this%ReserveHaloBuffers((N+1)*(N+1)*nVar*this%nHaloSides)
+    buffer(1:N+1,1:N+1,1:nVar,1:this%nHaloSides) => this%sendBuffer
+
+    do concurrent(i=1:N+1,j=1:N+1,ivar=1:nVar,ihalo=1:this%nHaloSides)
+      buffer(i,j,ivar,ihalo) = boundary(i,j,this%haloSide(ihalo),this%haloElem(ihalo),ivar)
+    enddo
+
+  endsubroutine PackHalo3D_DomainDecomposition_t
+
+  subroutine UnpackHalo3D_DomainDecomposition_t(this,extBoundary,N,nVar,nElem)
+    !! Copies the received neighbor data into extBoundary, applying the side flip.
+    !! See SELF_Mesh_3D_t for the definition of the flip indices.
+    implicit none
+    class(DomainDecomposition_t),intent(inout) :: this
+    integer,intent(in) :: N,nVar,nElem
+    real(prec),intent(inout) :: extBoundary(1:N+1,1:N+1,1:6,1:nElem,1:nVar)
+    ! Local
+    real(prec),pointer,contiguous :: buffer(:,:,:,:)
+    integer :: i,j,i2,j2,ivar,ihalo
+
+    buffer(1:N+1,1:N+1,1:nVar,1:this%nHaloSides) => this%recvBuffer
+
+    do concurrent(i=1:N+1,j=1:N+1,ivar=1:nVar,ihalo=1:this%nHaloSides)
+      select case(this%haloFlip(ihalo))
+      case(1)
+        i2 = N+2-i
+        j2 = j
+      case(2)
+        i2 = N+2-i
+        j2 = N+2-j
+      case(3)
+        i2 = i
+        j2 = N+2-j
+      case(4)
+        i2 = j
+        j2 = i
+      case(5)
+        i2 = N+2-j
+        j2 = i
+      case(6)
+        i2 = N+2-j
+        j2 = N+2-i
+      case(7)
+        i2 = j
+        j2 = N+2-i
+      case default
+        i2 = i
+        j2 = j
+      endselect
+      extBoundary(i,j,this%haloSide(ihalo),this%haloElem(ihalo),ivar) = buffer(i2,j2,ivar,ihalo)
+    enddo
+
+  endsubroutine UnpackHalo3D_DomainDecomposition_t
+
   subroutine FinalizeMPIExchangeAsync(mpiHandler)
     class(DomainDecomposition_t),intent(inout) :: mpiHandler
     ! Local
     integer :: ierror
     integer :: msgCount
 
-    if(mpiHandler%mpiEnabled) then
-      msgCount = mpiHandler%msgCount
-      call MPI_WaitAll(msgCount, &
-                       mpiHandler%requests(1:msgCount), &
-                       mpiHandler%stats(1:MPI_STATUS_SIZE,1:msgCount), &
-                       iError)
+    if(mpiHandler%mpiEnabled .and. mpiHandler%activeSchedule > 0) then
+      msgCount = 2*mpiHandler%nNeighbors
+      if(msgCount > 0) then
+        call MPI_WaitAll(msgCount, &
+                         mpiHandler%scheduleRequests(1:msgCount,mpiHandler%activeSchedule), &
+                         mpiHandler%stats(1:MPI_STATUS_SIZE,1:msgCount), &
+                         iError)
+      endif
+      mpiHandler%activeSchedule = 0
     endif
 
   endsubroutine FinalizeMPIExchangeAsync
@@ -0,0 +1,475 @@
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+!
+! Maintainers : support@fluidnumerics.com
+! Official Repository : https://github.com/FluidNumerics/self/
+!
+! Copyright © 2024 Fluid Numerics LLC
+!
+! Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+!
+! 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+!
+! 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in
+!    the documentation and/or other materials provided with the distribution.
+!
+! 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from
+!    this software without specific prior written permission.
+!
+! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+! LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+! HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+! LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+! THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+! THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+
+module self_Euler2D_t
+!! This module defines a class that can be used to solve the compressible
+!! Euler equations in 2-D, with optional Navier-Stokes viscous and heat
+!! fluxes.
+!!
+!! The conserved variables are
+!!
+!! \begin{equation}
+!! \vec{s} = \begin{pmatrix}
+!!     \rho \\
+!!     \rho u \\
+!!     \rho v \\
+!!     E
+!!  \end{pmatrix}
+!! \end{equation}
+!!
+!! with the pressure given by the ideal gas law, $p = (\gamma-1)(E - \frac{1}{2}\rho(u^2+v^2))$.
+!! The inviscid flux is
+!!
+!! \begin{equation}
+!! \overleftrightarrow{f} = \begin{pmatrix}
+!!     \rho u \hat{x} + \rho v \hat{y} \\
+!!     (\rho u^2 + p) \hat{x} + \rho u v \hat{y} \\
+!!     \rho u v \hat{x} + (\rho v^2 + p) \hat{y} \\
+!!     (E+p) u \hat{x} + (E+p) v \hat{y}
+!!  \end{pmatrix}
+!! \end{equation}
+!!
+!! and the source terms are null.
+!!
+!! The volume integral of the inviscid flux is computed with a split form
+!! (flux differencing) on Gauss-Lobatto points, using the entropy conserving
+!! and kinetic energy preserving two-point flux of Ranocha (2018). Together
+!! with the local Lax-Friedrichs flux on the element sides, the scheme is
+!! entropy stable. For this reason, the model must be initialized with an
+!! interpolant that uses GAUSS_LOBATTO control points.
+!!
+!! When gradient_enabled is set, the viscous stress (kinematic viscosity nu)
+!! and the heat flux (thermal diffusivity kappa) are added through flux2d and
+!! riemannflux2d, and their volume integral is computed in the weak form.
+!!
+
+  use self_model
+  use self_dgmodel2d
+  use self_mesh
+
+  implicit none
+
+  type,extends(dgmodel2d) :: Euler2D_t
+    ! Add any additional attributes here that are specific to your model
+    real(prec) :: gamma = 1.4_prec ! Ratio of specific heats
+    real(prec) :: nu = 0.0_prec ! Kinematic viscosity
+    real(prec) :: kappa = 0.0_prec ! Thermal diffusivity
+
+  contains
+    procedure :: AdditionalInit => AdditionalInit_Euler2D_t
+    procedure :: SetNumberOfVariables => SetNumberOfVariables_Euler2D_t
+    procedure :: SetMetadata => SetMetadata_Euler2D_t
+    procedure :: entropy_func => entropy_func_Euler2D_t
+    procedure :: maxWaveSpeed => maxWaveSpeed_Euler2D_t
+    procedure :: hbc2d_NoNormalFlow => hbc2d_NoNormalFlow_Euler2D_t
+    procedure :: hbc2d_Radiation => hbc2d_Radiation_Euler2D_t
+    procedure :: pbc2d_NoNormalFlow => pbc2d_NoNormalFlow_Euler2D_t
+    procedure :: flux2d => flux2d_Euler2D_t
+    procedure :: riemannflux2d => riemannflux2d_Euler2D_t
+    procedure :: SourceMethod => sourcemethod_Euler2D_t
+    procedure :: FluxMethod => fluxmethod_Euler2D_t
+    procedure :: FluxDivergenceVolume => FluxDivergenceVolume_Euler2D_t
+    procedure :: ThermalBubble => ThermalBubble_Euler2D_t
+
+  endtype Euler2D_t
+
+contains
+
+  subroutine AdditionalInit_Euler2D_t(this)
+    implicit none
+    class(Euler2D_t),intent(inout) :: this
+
+    if(this%solution%interp%controlNodeType /= GAUSS_LOBATTO) then
+      print*,__FILE__//" : The flux differencing volume kernel requires GAUSS_LOBATTO control points."
+      stop 1
+    endif
+
+  endsubroutine AdditionalInit_Euler2D_t
+
+  subroutine SetNumberOfVariables_Euler2D_t(this)
+    implicit none
+    class(Euler2D_t),intent(inout) :: this
+
+    this%nvar = 4
+
+  endsubroutine SetNumberOfVariables_Euler2D_t
+
+  subroutine SetMetadata_Euler2D_t(this)
+    implicit none
+    class(Euler2D_t),intent(inout) :: this
+
+    call this%solution%SetName(1,"rho") ! Density
+    call this%solution%SetUnits(1,"kg⋅m⁻³")
+
+    call this%solution%SetName(2,"rhou") ! x-momentum
+    call this%solution%SetUnits(2,"kg⋅m⁻²⋅s⁻¹")
+
+    call this%solution%SetName(3,"rhov") ! y-momentum
+    call this%solution%SetUnits(3,"kg⋅m⁻²⋅s⁻¹")
+
+    call this%solution%SetName(4,"E") ! Total energy
+    call this%solution%SetUnits(4,"kg⋅m⁻¹⋅s⁻²")
+
+  endsubroutine SetMetadata_Euler2D_t
+
+  pure function entropy_func_Euler2D_t(this,s) result(e)
+    !! The mathematical entropy of the Euler equations,
+    !!
+    !! \begin{equation}
+    !!   e = -\frac{\rho \sigma}{\gamma - 1}
+    !! \end{equation}
+    !!
+    !! where $\sigma = \ln(p \rho^{-\gamma})$ is the thermodynamic entropy.
+    class(Euler2D_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%nvar)
+    real(prec) :: e
+    ! Local
+    real(prec) :: p
+
+    p = (this%gamma-1.0_prec)*(s(4)-0.5_prec*(s(2)*s(2)+s(3)*s(3))/s(1))
+    e = -s(1)*(log(p)-this%gamma*log(s(1)))/(this%gamma-1.0_prec)
+
+  endfunction entropy_func_Euler2D_t
+
+  pure function maxWaveSpeed_Euler2D_t(this,s) result(c)
+    !! The fastest waves are sound waves, carried by the flow
+    class(Euler2D_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%nvar)
+    real(prec) :: c
+    ! Local
+    real(prec) :: u,v,p
+
+    u = s(2)/s(1)
+    v = s(3)/s(1)
+    p = (this%gamma-1.0_prec)*(s(4)-0.5_prec*s(1)*(u*u+v*v))
+    c = sqrt(u*u+v*v)+sqrt(this%gamma*p/s(1))
+
+  endfunction maxWaveSpeed_Euler2D_t
+
+  pure function hbc2d_NoNormalFlow_Euler2D_t(this,s,nhat) result(exts)
+    !! The external state has the normal momentum reflected
+    class(Euler2D_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%nvar)
+    real(prec),intent(in) :: nhat(1:2)
+    real(prec) :: exts(1:this%nvar)
+    ! Local
+    real(prec) :: mn
+
+    mn = s(2)*nhat(1)+s(3)*nhat(2)
+    exts(1) = s(1) ! density
+    exts(2) = s(2)-2.0_prec*mn*nhat(1) ! x-momentum
+    exts(3) = s(3)-2.0_prec*mn*nhat(2) ! y-momentum
+    exts(4) = s(4) ! total energy
+
+  endfunction hbc2d_NoNormalFlow_Euler2D_t
+
+  pure function hbc2d_Radiation_Euler2D_t(this,s,nhat) result(exts)
+    !! The external state is set to the interior state, so that waves leave the
+    !! domain without reflection from the jump (to the extent that they are normal
+    !! to the boundary).
+    class(Euler2D_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%nvar)
+    real(prec),intent(in) :: nhat(1:2)
+    real(prec) :: exts(1:this%nvar)
+
+    exts(1:this%nvar) = s(1:this%nvar)
+
+  endfunction hbc2d_Radiation_Euler2D_t
+
+  pure function pbc2d_NoNormalFlow_Euler2D_t(this,dsdx,nhat) result(extDsdx)
+    !! The external gradient is set to the interior gradient
+    class(Euler2D_t),intent(in) :: this
+    real(prec),intent(in) :: dsdx(1:this%nvar,1:2)
+    real(prec),intent(in) :: nhat(1:2)
+    real(prec) :: extDsdx(1:this%nvar,1:2)
+
+    extDsdx(1:this%nvar,1:2) = dsdx(1:this%nvar,1:2)
+
+  endfunction pbc2d_NoNormalFlow_Euler2D_t
+
+  pure function flux2d_Euler2D_t(this,s,dsdx) result(flux)
+    !! Returns the viscous and heat fluxes. The inviscid flux is integrated by the
+    !! flux differencing kernel (see FluxDivergenceVolume) and is not included here.
+    !! The velocity and $p/\rho$ gradients are obtained from the gradient of the
+    !! conserved variables by the chain rule.
+    class(Euler2D_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%nvar)
+    real(prec),intent(in) :: dsdx(1:this%nvar,1:2)
+    real(prec) :: flux(1:this%nvar,1:2)
+    ! Local
+    real(prec) :: u,v,p,mu,divu
+    real(prec) :: dudx(1:2),dvdx(1:2),dpdx(1:2),tau(1:2,1:2)
+    integer :: d
+
+    u = s(2)/s(1)
+    v = s(3)/s(1)
+    p = (this%gamma-1.0_prec)*(s(4)-0.5_prec*s(1)*(u*u+v*v))
+    mu = this%nu*s(1)
+
+    do d = 1,2
+      dudx(d) = (dsdx(2,d)-u*dsdx(1,d))/s(1)
+      dvdx(d) = (dsdx(3,d)-v*dsdx(1,d))/s(1)
+      dpdx(d) = (this%gamma-1.0_prec)*(dsdx(4,d)-u*dsdx(2,d)-v*dsdx(3,d)+ &
+                                       0.5_prec*(u*u+v*v)*dsdx(1,d))
+    enddo
+
+    divu = dudx(1)+dvdx(2)
+    tau(1,1) = mu*(2.0_prec*dudx(1)-2.0_prec*divu/3.0_prec)
+    tau(2,2) = mu*(2.0_prec*dvdx(2)-2.0_prec*divu/3.0_prec)
+    tau(1,2) = mu*(dudx(2)+dvdx(1))
+    tau(2,1) = tau(1,2)
+
+    do d = 1,2
+      flux(1,d) = 0.0_prec
+      flux(2,d) = -tau(1,d)
+      flux(3,d) = -tau(2,d)
+      ! Work of the viscous stress and the heat flux, rho*cp*kappa*grad(T), with T = p/(rho*R)
+      flux(4,d) = -(u*tau(1,d)+v*tau(2,d))- &
+                  this%kappa*this%gamma/(this%gamma-1.0_prec)*(dpdx(d)-p*dsdx(1,d)/s(1))
+    enddo
+
+  endfunction flux2d_Euler2D_t
+
+  pure function riemannflux2d_Euler2D_t(this,sL,sR,dsdx,nhat) result(flux)
+    !! Uses a local Lax-Friedrichs flux for the inviscid terms, with the
+    !! largest wave speed of the two states, and the Bassi-Rebay flux for the
+    !! viscous terms
+    class(Euler2D_t),intent(in) :: this
+    real(prec),intent(in) :: sL(1:this%nvar)
+    real(prec),intent(in) :: sR(1:this%nvar)
+    real(prec),intent(in) :: dsdx(1:this%nvar,1:2)
+    real(prec),intent(in) :: nhat(1:2)
+    real(prec) :: flux(1:this%nvar)
+    ! Local
+    real(prec) :: fL(1:this%nvar)
+    real(prec) :: fR(1:this%nvar)
+    real(prec) :: fv(1:this%nvar,1:2)
+    real(prec) :: un,p,lam
+
+    un = (sL(2)*nhat(1)+sL(3)*nhat(2))/sL(1)
+    p = (this%gamma-1.0_prec)*(sL(4)-0.5_prec*(sL(2)*sL(2)+sL(3)*sL(3))/sL(1))
+    fL(1) = sL(1)*un ! density
+    fL(2) = sL(2)*un+p*nhat(1) ! x-momentum
+    fL(3) = sL(3)*un+p*nhat(2) ! y-momentum
+    fL(4) = (sL(4)+p)*un ! total energy
+    lam = abs(un)+sqrt(this%gamma*p/sL(1))
+
+    un = (sR(2)*nhat(1)+sR(3)*nhat(2))/sR(1)
+    p = (this%gamma-1.0_prec)*(sR(4)-0.5_prec*(sR(2)*sR(2)+sR(3)*sR(3))/sR(1))
+    fR(1) = sR(1)*un ! density
+    fR(2) = sR(2)*un+p*nhat(1) ! x-momentum
+    fR(3) = sR(3)*un+p*nhat(2) ! y-momentum
+    fR(4) = (sR(4)+p)*un ! total energy
+    lam = max(lam,abs(un)+sqrt(this%gamma*p/sR(1)))
+
+    flux(1:4) = 0.5_prec*(fL(1:4)+fR(1:4))+0.5_prec*lam*(sL(1:4)-sR(1:4))
+
+    if(this%gradient_enabled) then
+      fv = this%flux2d(0.5_prec*(sL+sR),dsdx)
+      flux(1:4) = flux(1:4)+fv(1:4,1)*nhat(1)+fv(1:4,2)*nhat(2)
+    endif
+
+  endfunction riemannflux2d_Euler2D_t
+
+  subroutine sourcemethod_Euler2D_t(this)
+    implicit none
+    class(Euler2D_t),intent(inout) :: this
+
+    return
+
+  endsubroutine sourcemethod_Euler2D_t
+
+  subroutine fluxmethod_Euler2D_t(this)
+    !! Only the viscous flux is stored in the flux attribute, so there is
+    !! nothing to compute for the inviscid equations
+    !!
+    !! Note that the loop is not delegated to the parent method: called on the
+    !! dgmodel2d parent component, the flux2d binding would resolve to the parent
+    !! type instead of flux2d_Euler2D_t.
+    implicit none
+    class(Euler2D_t),intent(inout) :: this
+    ! Local
+    integer :: i,j,iel
+    real(prec) :: s(1:this%nvar),dsdx(1:this%nvar,1:2)
+
+    if(.not. this%gradient_enabled) return
+
+    do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
+                  iel=1:this%mesh%nElem, &
+                  this%rateLevel(iel) <= this%lts_activeLevel)
+
+      s = this%solution%interior(i,j,iel,1:this%nvar)
+      dsdx = this%solutionGradient%interior(i,j,iel,1:this%nvar,1:2)
+      this%flux%interior(i,j,iel,1:this%nvar,1:2) = this%flux2d(s,dsdx)
+
+    enddo
+
+  endsubroutine fluxmethod_Euler2D_t
+
+  subroutine FluxDivergenceVolume_Euler2D_t(this)
+    !! Computes the volume term of the flux divergence with the split form
+    !!
+    !! \begin{equation}
+    !!   \sum_{n} 2 D_{in} \tilde{f}^{\#}_1(s_{ij},s_{nj}) + 2 D_{jn} \tilde{f}^{\#}_2(s_{ij},s_{in})
+    !! \end{equation}
+    !!
+    !! where $\tilde{f}^{\#}_d$ is the two-point flux in the direction of the average of the
+    !! contravariant basis vectors $J\vec{a}^d$ at the two points. The diagonal of $2D$ is
+    !! replaced by zero; on Gauss-Lobatto points, this accounts for the boundary terms
+    !! that turn the strong form into the weak form completed by MappedDGDivergenceSurface.
+    !!
+    !! Each direction is swept separately, and the primitive variables are computed
+    !! once per point before the sweeps.
+    implicit none
+    class(Euler2D_t),intent(inout) :: this
+    ! Local
+    integer :: i,j,n,iel,N1
+    real(prec) :: df(1:4),nhat(1:2)
+    real(prec),allocatable :: prim(:,:,:,:),dsplit(:,:)
+
+    if(this%gradient_enabled) then
+      call this%dgmodel2d%FluxDivergenceVolume()
+    else
+      this%fluxDivergence%interior = 0.0_prec
+    endif
+
+    N1 = this%solution%interp%N+1
+    allocate(prim(1:N1,1:N1,1:this%mesh%nElem,1:4),dsplit(1:N1,1:N1))
+
+    ! dsplit(n,i) = 2*D(i,n), with the same (transposed) layout as dMatrix
+    dsplit = 2.0_prec*this%solution%interp%dMatrix
+    do i = 1,N1
+      dsplit(i,i) = 0.0_prec
+    enddo
+
+    do concurrent(i=1:N1,j=1:N1,iel=1:this%mesh%nElem)
+      prim(i,j,iel,1) = this%solution%interior(i,j,iel,1)
+      prim(i,j,iel,2) = this%solution%interior(i,j,iel,2)/prim(i,j,iel,1)
+      prim(i,j,iel,3) = this%solution%interior(i,j,iel,3)/prim(i,j,iel,1)
+      prim(i,j,iel,4) = (this%gamma-1.0_prec)*(this%solution%interior(i,j,iel,4)- &
+                                               0.5_prec*prim(i,j,iel,1)* &
+                                               (prim(i,j,iel,2)**2+prim(i,j,iel,3)**2))
+    enddo
+
+    do concurrent(i=1:N1,j=1:N1,iel=1:this%mesh%nElem, &
+                  this%rateLevel(iel) <= this%lts_activeLevel)
+
+      df = 0.0_prec
+      do n = 1,N1
+        ! Computational direction 1
+        nhat = 0.5_prec*(this%geometry%dsdx%interior(i,j,iel,1,1:2,1)+ &
+                         this%geometry%dsdx%interior(n,j,iel,1,1:2,1))
+        df = df+dsplit(n,i)*TwoPointFlux_Euler2D(prim(i,j,iel,1:4),prim(n,j,iel,1:4),nhat,this%gamma)
+        ! Computational direction 2
+        nhat = 0.5_prec*(this%geometry%dsdx%interior(i,j,iel,1,1:2,2)+ &
+                         this%geometry%dsdx%interior(i,n,iel,1,1:2,2))
+        df = df+dsplit(n,j)*TwoPointFlux_Euler2D(prim(i,j,iel,1:4),prim(i,n,iel,1:4),nhat,this%gamma)
+      enddo
+      this%fluxDivergence%interior(i,j,iel,1:4) = this%fluxDivergence%interior(i,j,iel,1:4)+df
+
+    enddo
+
+    deallocate(prim,dsplit)
+
+  endsubroutine FluxDivergenceVolume_Euler2D_t
+
+  pure function TwoPointFlux_Euler2D(pL,pR,nhat,gamma) result(f)
+    !! The entropy conserving and kinetic energy preserving flux of Ranocha (2018),
+    !! "Generalised summation-by-parts operators and entropy stability of numerical
+    !! methods for hyperbolic balance laws", in the direction nhat. The states are
+    !! given in primitive variables (rho,u,v,p) and nhat need not be a unit vector.
+    real(prec),intent(in) :: pL(1:4)
+    real(prec),intent(in) :: pR(1:4)
+    real(prec),intent(in) :: nhat(1:2)
+    real(prec),intent(in) :: gamma
+    real(prec) :: f(1:4)
+    ! Local
+    real(prec) :: rhoMean,invRhoPMean,unL,unR,pAvg
+
+    rhoMean = LogarithmicMean(pL(1),pR(1))
+    invRhoPMean = pL(4)*pR(4)*InverseLogarithmicMean(pL(1)*pR(4),pR(1)*pL(4))
+    unL = pL(2)*nhat(1)+pL(3)*nhat(2)
+    unR = pR(2)*nhat(1)+pR(3)*nhat(2)
+    pAvg = 0.5_prec*(pL(4)+pR(4))
+
+    f(1) = 0.5_prec*rhoMean*(unL+unR)
+    f(2) = 0.5_prec*f(1)*(pL(2)+pR(2))+pAvg*nhat(1)
+    f(3) = 0.5_prec*f(1)*(pL(3)+pR(3))+pAvg*nhat(2)
+    f(4) = f(1)*(0.5_prec*(pL(2)*pR(2)+pL(3)*pR(3))+invRhoPMean/(gamma-1.0_prec))+ &
+           0.5_prec*(pL(4)*unR+pR(4)*unL)
+
+  endfunction TwoPointFlux_Euler2D
+
+  subroutine ThermalBubble_Euler2D_t(this,rho0,rhoprime,Lr,P0,Eprime,Le,x0,y0)
+    !! This subroutine sets the initial condition for a weak blast wave
+    !! problem. The initial condition is given by
+    !!
+    !! \begin{equation}
+    !! \begin{aligned}
+    !! \rho &= \rho_0 + \rho' \exp\left( -\ln(2) \frac{(x-x_0)^2 + (y-y_0)^2}{L_r^2} \right) \\
+    !! u &= 0 \\
+    !! v &= 0 \\
+    !! E &= \frac{P_0}{\gamma - 1} + E' \exp\left( -\ln(2) \frac{(x-x_0)^2 + (y-y_0)^2}{L_e^2} \right)
+    !! \end{aligned}
+    !! \end{equation}
+    !!
+    implicit none
+    class(Euler2D_t),intent(inout) :: this
+    real(prec),intent(in) ::  rho0,rhoprime,Lr,P0,Eprime,Le,x0,y0
+    ! Local
+    integer :: i,j,iEl
+    real(prec) :: x,y,r
+
+    print*,__FILE__," : Configuring weak blast wave initial condition. "
+    print*,__FILE__," : rho0 = ",rho0
+    print*,__FILE__," : rhoprime = ",rhoprime
+    print*,__FILE__," : Lr = ",Lr
+    print*,__FILE__," : P0 = ",P0
+    print*,__FILE__," : Eprime = ",Eprime
+    print*,__FILE__," : Le = ",Le
+    print*,__FILE__," : x0 = ",x0
+    print*,__FILE__," : y0 = ",y0
+
+    do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
+                  iel=1:this%mesh%nElem)
+      x = this%geometry%x%interior(i,j,iEl,1,1)-x0
+      y = this%geometry%x%interior(i,j,iEl,1,2)-y0
+      r = sqrt(x**2+y**2)
+
+      this%solution%interior(i,j,iEl,1) = rho0+rhoprime*exp(-log(2.0_prec)*r**2/Lr**2)
+      this%solution%interior(i,j,iEl,2) = 0.0_prec
+      this%solution%interior(i,j,iEl,3) = 0.0_prec
+      this%solution%interior(i,j,iEl,4) = P0/(this%gamma-1.0_prec)+ &
+                                          Eprime*exp(-log(2.0_prec)*r**2/Le**2)
+
+    enddo
+
+    call this%ReportMetrics()
+    call this%solution%UpdateDevice()
+
+  endsubroutine ThermalBubble_Euler2D_t
+
+endmodule self_Euler2D_t
@@ -0,0 +1,459 @@
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+!
+! Maintainers : support@fluidnumerics.com
+! Official Repository : https://github.com/FluidNumerics/self/
+!
+! Copyright © 2024 Fluid Numerics LLC
+!
+! Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+!
+! 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+!
+! 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in
+!    the documentation and/or other materials provided with the distribution.
+!
+! 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from
+!    this software without specific prior written permission.
+!
+! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+! LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+! HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+! LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+! THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+! THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+
+module self_Euler3D_t
+!! This module defines a class that can be used to solve the compressible
+!! Euler equations in 3-D, with optional Navier-Stokes viscous and heat
+!! fluxes.
+!!
+!! The conserved variables are
+!!
+!! \begin{equation}
+!! \vec{s} = \begin{pmatrix}
+!!     \rho \\
+!!     \rho u \\
+!!     \rho v \\
+!!     \rho w \\
+!!     E
+!!  \end{pmatrix}
+!! \end{equation}
+!!
+!! with the pressure given by the ideal gas law, $p = (\gamma-1)(E - \frac{1}{2}\rho(u^2+v^2+w^2))$.
+!! The inviscid flux is
+!!
+!! \begin{equation}
+!! \overleftrightarrow{f} = \begin{pmatrix}
+!!     \rho \vec{u} \\
+!!     \rho u \vec{u} + p \hat{x} \\
+!!     \rho v \vec{u} + p \hat{y} \\
+!!     \rho w \vec{u} + p \hat{z} \\
+!!     (E+p) \vec{u}
+!!  \end{pmatrix}
+!! \end{equation}
+!!
+!! and the source terms are null.
+!!
+!! As in the 2-D model (see self_Euler2D_t), the inviscid volume integral is
+!! computed by flux differencing with the two-point flux of Ranocha (2018) on
+!! Gauss-Lobatto points. In 3-D, this costs O(N^4) operations per element, and
+!! the GPU and host backends provide dedicated kernels for it.
+!!
+!! When gradient_enabled is set, the viscous stress (kinematic viscosity nu)
+!! and the heat flux (thermal diffusivity kappa) are added through flux3d and
+!! riemannflux3d.
+!!
+
+  use self_model
+  use self_dgmodel3d
+  use self_mesh
+
+  implicit none
+
+  type,extends(dgmodel3d) :: Euler3D_t
+    ! Add any additional attributes here that are specific to your model
+    real(prec) :: gamma = 1.4_prec ! Ratio of specific heats
+    real(prec) :: nu = 0.0_prec ! Kinematic viscosity
+    real(prec) :: kappa = 0.0_prec ! Thermal diffusivity
+
+  contains
+    procedure :: AdditionalInit => AdditionalInit_Euler3D_t
+    procedure :: SetNumberOfVariables => SetNumberOfVariables_Euler3D_t
+    procedure :: SetMetadata => SetMetadata_Euler3D_t
+    procedure :: entropy_func => entropy_func_Euler3D_t
+    procedure :: maxWaveSpeed => maxWaveSpeed_Euler3D_t
+    procedure :: hbc3d_NoNormalFlow => hbc3d_NoNormalFlow_Euler3D_t
+    procedure :: hbc3d_Radiation => hbc3d_Radiation_Euler3D_t
+    procedure :: pbc3d_NoNormalFlow => pbc3d_NoNormalFlow_Euler3D_t
+    procedure :: flux3d => flux3d_Euler3D_t
+    procedure :: riemannflux3d => riemannflux3d_Euler3D_t
+    procedure :: SourceMethod => sourcemethod_Euler3D_t
+    procedure :: FluxMethod => fluxmethod_Euler3D_t
+    procedure :: FluxDivergenceVolume => FluxDivergenceVolume_Euler3D_t
+    procedure :: ThermalBubble => ThermalBubble_Euler3D_t
+
+  endtype Euler3D_t
+
+contains
+
+  subroutine AdditionalInit_Euler3D_t(this)
+    implicit none
+    class(Euler3D_t),intent(inout) :: this
+
+    if(this%solution%interp%controlNodeType /= GAUSS_LOBATTO) then
+      print*,__FILE__//" : The flux differencing volume kernel requires GAUSS_LOBATTO control points."
+      stop 1
+    endif
+
+  endsubroutine AdditionalInit_Euler3D_t
+
+  subroutine SetNumberOfVariables_Euler3D_t(this)
+    implicit none
+    class(Euler3D_t),intent(inout) :: this
+
+    this%nvar = 5
+
+  endsubroutine SetNumberOfVariables_Euler3D_t
+
+  subroutine SetMetadata_Euler3D_t(this)
+    implicit none
+    class(Euler3D_t),intent(inout) :: this
+
+    call this%solution%SetName(1,"rho") ! Density
+    call this%solution%SetUnits(1,"kg⋅m⁻³")
+
+    call this%solution%SetName(2,"rhou") ! x-momentum
+    call this%solution%SetUnits(2,"kg⋅m⁻²⋅s⁻¹")
+
+    call this%solution%SetName(3,"rhov") ! y-momentum
+    call this%solution%SetUnits(3,"kg⋅m⁻²⋅s⁻¹")
+
+    call this%solution%SetName(4,"rhow") ! z-momentum
+    call this%solution%SetUnits(4,"kg⋅m⁻²⋅s⁻¹")
+
+    call this%solution%SetName(5,"E") ! Total energy
+    call this%solution%SetUnits(5,"kg⋅m⁻¹⋅s⁻²")
+
+  endsubroutine SetMetadata_Euler3D_t
+
+  pure function entropy_func_Euler3D_t(this,s) result(e)
+    !! The mathematical entropy of the Euler equations, $e = -\rho \sigma/(\gamma - 1)$,
+    !! with the thermodynamic entropy $\sigma = \ln(p \rho^{-\gamma})$
+    class(Euler3D_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%nvar)
+    real(prec) :: e
+    ! Local
+    real(prec) :: p
+
+    p = (this%gamma-1.0_prec)*(s(5)-0.5_prec*(s(2)*s(2)+s(3)*s(3)+s(4)*s(4))/s(1))
+    e = -s(1)*(log(p)-this%gamma*log(s(1)))/(this%gamma-1.0_prec)
+
+  endfunction entropy_func_Euler3D_t
+
+  pure function maxWaveSpeed_Euler3D_t(this,s) result(c)
+    !! The fastest waves are sound waves, carried by the flow
+    class(Euler3D_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%nvar)
+    real(prec) :: c
+    ! Local
+    real(prec) :: u,v,w,p
+
+    u = s(2)/s(1)
+    v = s(3)/s(1)
+    w = s(4)/s(1)
+    p = (this%gamma-1.0_prec)*(s(5)-0.5_prec*s(1)*(u*u+v*v+w*w))
+    c = sqrt(u*u+v*v+w*w)+sqrt(this%gamma*p/s(1))
+
+  endfunction maxWaveSpeed_Euler3D_t
+
+  pure function hbc3d_NoNormalFlow_Euler3D_t(this,s,nhat) result(exts)
+    !! The external state has the normal momentum reflected
+    class(Euler3D_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%nvar)
+    real(prec),intent(in) :: nhat(1:3)
+    real(prec) :: exts(1:this%nvar)
+    ! Local
+    real(prec) :: mn
+
+    mn = s(2)*nhat(1)+s(3)*nhat(2)+s(4)*nhat(3)
+    exts(1) = s(1) ! density
+    exts(2) = s(2)-2.0_prec*mn*nhat(1) ! x-momentum
+    exts(3) = s(3)-2.0_prec*mn*nhat(2) ! y-momentum
+    exts(4) = s(4)-2.0_prec*mn*nhat(3) ! z-momentum
+    exts(5) = s(5) ! total energy
+
+  endfunction hbc3d_NoNormalFlow_Euler3D_t
+
+  pure function hbc3d_Radiation_Euler3D_t(this,s,nhat) result(exts)
+    !! The external state is set to the interior state
+    class(Euler3D_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%nvar)
+    real(prec),intent(in) :: nhat(1:3)
+    real(prec) :: exts(1:this%nvar)
+
+    exts(1:this%nvar) = s(1:this%nvar)
+
+  endfunction hbc3d_Radiation_Euler3D_t
+
+  pure function pbc3d_NoNormalFlow_Euler3D_t(this,dsdx,nhat) result(extDsdx)
+    !! The external gradient is set to the interior gradient
+    class(Euler3D_t),intent(in) :: this
+    real(prec),intent(in) :: dsdx(1:this%nvar,1:3)
+    real(prec),intent(in) :: nhat(1:3)
+    real(prec) :: extDsdx(1:this%nvar,1:3)
+
+    extDsdx(1:this%nvar,1:3) = dsdx(1:this%nvar,1:3)
+
+  endfunction pbc3d_NoNormalFlow_Euler3D_t
+
+  pure function flux3d_Euler3D_t(this,s,dsdx) result(flux)
+    !! Returns the viscous and heat fluxes; the inviscid flux is integrated by
+    !! the flux differencing kernel (see FluxDivergenceVolume)
+    class(Euler3D_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%nvar)
+    real(prec),intent(in) :: dsdx(1:this%nvar,1:3)
+    real(prec) :: flux(1:this%nvar,1:3)
+    ! Local
+    real(prec) :: vel(1:3),p,mu,divu
+    real(prec) :: dveldx(1:3,1:3),dpdx(1:3),tau(1:3,1:3)
+    integer :: a,d
+
+    vel(1:3) = s(2:4)/s(1)
+    p = (this%gamma-1.0_prec)*(s(5)-0.5_prec*s(1)*(vel(1)**2+vel(2)**2+vel(3)**2))
+    mu = this%nu*s(1)
+
+    do d = 1,3
+      do a = 1,3
+        dveldx(a,d) = (dsdx(a+1,d)-vel(a)*dsdx(1,d))/s(1)
+      enddo
+      dpdx(d) = (this%gamma-1.0_prec)*(dsdx(5,d)-vel(1)*dsdx(2,d)-vel(2)*dsdx(3,d)-vel(3)*dsdx(4,d)+ &
+                                       0.5_prec*(vel(1)**2+vel(2)**2+vel(3)**2)*dsdx(1,d))
+    enddo
+
+    divu = dveldx(1,1)+dveldx(2,2)+dveldx(3,3)
+    do d = 1,3
+      do a = 1,3
+        tau(a,d) = mu*(dveldx(a,d)+dveldx(d,a))
+      enddo
+      tau(d,d) = tau(d,d)-2.0_prec*mu*divu/3.0_prec
+    enddo
+
+    do d = 1,3
+      flux(1,d) = 0.0_prec
+      flux(2:4,d) = -tau(1:3,d)
+      flux(5,d) = -(vel(1)*tau(1,d)+vel(2)*tau(2,d)+vel(3)*tau(3,d))- &
+                  this%kappa*this%gamma/(this%gamma-1.0_prec)*(dpdx(d)-p*dsdx(1,d)/s(1))
+    enddo
+
+  endfunction flux3d_Euler3D_t
+
+  pure function riemannflux3d_Euler3D_t(this,sL,sR,dsdx,nhat) result(flux)
+    !! Uses a local Lax-Friedrichs flux for the inviscid terms and the
+    !! Bassi-Rebay flux for the viscous terms
+    class(Euler3D_t),intent(in) :: this
+    real(prec),intent(in) :: sL(1:this%nvar)
+    real(prec),intent(in) :: sR(1:this%nvar)
+    real(prec),intent(in) :: dsdx(1:this%nvar,1:3)
+    real(prec),intent(in) :: nhat(1:3)
+    real(prec) :: flux(1:this%nvar)
+    ! Local
+    real(prec) :: fL(1:this%nvar)
+    real(prec) :: fR(1:this%nvar)
+    real(prec) :: fv(1:this%nvar,1:3)
+    real(prec) :: un,p,lam
+
+    un = (sL(2)*nhat(1)+sL(3)*nhat(2)+sL(4)*nhat(3))/sL(1)
+    p = (this%gamma-1.0_prec)*(sL(5)-0.5_prec*(sL(2)*sL(2)+sL(3)*sL(3)+sL(4)*sL(4))/sL(1))
+    fL(1) = sL(1)*un ! density
+    fL(2:4) = sL(2:4)*un+p*nhat(1:3) ! momentum
+    fL(5) = (sL(5)+p)*un ! total energy
+    lam = abs(un)+sqrt(this%gamma*p/sL(1))
+
+    un = (sR(2)*nhat(1)+sR(3)*nhat(2)+sR(4)*nhat(3))/sR(1)
+    p = (this%gamma-1.0_prec)*(sR(5)-0.5_prec*(sR(2)*sR(2)+sR(3)*sR(3)+sR(4)*sR(4))/sR(1))
+    fR(1) = sR(1)*un ! density
+    fR(2:4) = sR(2:4)*un+p*nhat(1:3) ! momentum
+    fR(5) = (sR(5)+p)*un ! total energy
+    lam = max(lam,abs(un)+sqrt(this%gamma*p/sR(1)))
+
+    flux(1:5) = 0.5_prec*(fL(1:5)+fR(1:5))+0.5_prec*lam*(sL(1:5)-sR(1:5))
+
+    if(this%gradient_enabled) then
+      fv = this%flux3d(0.5_prec*(sL+sR),dsdx)
+      flux(1:5) = flux(1:5)+fv(1:5,1)*nhat(1)+fv(1:5,2)*nhat(2)+fv(1:5,3)*nhat(3)
+    endif
+
+  endfunction riemannflux3d_Euler3D_t
+
+  subroutine sourcemethod_Euler3D_t(this)
+    implicit none
+    class(Euler3D_t),intent(inout) :: this
+
+    return
+
+  endsubroutine sourcemethod_Euler3D_t
+
+  subroutine fluxmethod_Euler3D_t(this)
+    !! Only the viscous flux is stored in the flux attribute. As in 2D, flux3d is
+    !! called on this directly rather than through the dgmodel3d parent component.
+    implicit none
+    class(Euler3D_t),intent(inout) :: this
+    ! Local
+    integer :: i,j,k,iel
+    real(prec) :: s(1:this%nvar),dsdx(1:this%nvar,1:3)
+
+    if(.not. this%gradient_enabled) return
+
+    do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
+                  k=1:this%solution%N+1,iel=1:this%mesh%nElem, &
+                  this%rateLevel(iel) <= this%lts_activeLevel)
+
+      s = this%solution%interior(i,j,k,iel,1:this%nvar)
+      dsdx = this%solutionGradient%interior(i,j,k,iel,1:this%nvar,1:3)
+      this%flux%interior(i,j,k,iel,1:this%nvar,1:3) = this%flux3d(s,dsdx)
+
+    enddo
+
+  endsubroutine fluxmethod_Euler3D_t
+
+  subroutine FluxDivergenceVolume_Euler3D_t(this)
+    !! Computes the volume term of the flux divergence with the split form
+    !! $\sum_{n} 2 D_{in} \tilde{f}^{\#}_1(s_{ijk},s_{njk}) + 2 D_{jn} \tilde{f}^{\#}_2(s_{ijk},s_{ink})
+    !! + 2 D_{kn} \tilde{f}^{\#}_3(s_{ijk},s_{ijn})$, using the average of the contravariant basis
+    !! vectors of the two points. See FluxDivergenceVolume_Euler2D_t for the treatment of the
+    !! diagonal of $2D$.
+    implicit none
+    class(Euler3D_t),intent(inout) :: this
+    ! Local
+    integer :: i,j,k,n,iel,N1
+    real(prec) :: df(1:5),nhat(1:3)
+    real(prec),allocatable :: prim(:,:,:,:,:),dsplit(:,:)
+
+    if(this%gradient_enabled) then
+      call this%dgmodel3d%FluxDivergenceVolume()
+    else
+      this%fluxDivergence%interior = 0.0_prec
+    endif
+
+    N1 = this%solution%interp%N+1
+    allocate(prim(1:N1,1:N1,1:N1,1:this%mesh%nElem,1:5),dsplit(1:N1,1:N1))
+
+    ! dsplit(n,i) = 2*D(i,n), with the same (transposed) layout as dMatrix
+    dsplit = 2.0_prec*this%solution%interp%dMatrix
+    do i = 1,N1
+      dsplit(i,i) = 0.0_prec
+    enddo
+
+    do concurrent(i=1:N1,j=1:N1,k=1:N1,iel=1:this%mesh%nElem)
+      prim(i,j,k,iel,1) = this%solution%interior(i,j,k,iel,1)
+      prim(i,j,k,iel,2:4) = this%solution%interior(i,j,k,iel,2:4)/prim(i,j,k,iel,1)
+      prim(i,j,k,iel,5) = (this%gamma-1.0_prec)*(this%solution%interior(i,j,k,iel,5)- &
+                                                 0.5_prec*prim(i,j,k,iel,1)* &
+                                                 (prim(i,j,k,iel,2)**2+prim(i,j,k,iel,3)**2+prim(i,j,k,iel,4)**2))
+    enddo
+
+    do concurrent(i=1:N1,j=1:N1,k=1:N1,iel=1:this%mesh%nElem, &
+                  this%rateLevel(iel) <= this%lts_activeLevel)
+
+      df = 0.0_prec
+      do n = 1,N1
+        ! Computational direction 1
+        nhat = 0.5_prec*(this%geometry%dsdx%interior(i,j,k,iel,1,1:3,1)+ &
+                         this%geometry%dsdx%interior(n,j,k,iel,1,1:3,1))
+        df = df+dsplit(n,i)*TwoPointFlux_Euler3D(prim(i,j,k,iel,1:5),prim(n,j,k,iel,1:5),nhat,this%gamma)
+        ! Computational direction 2
+        nhat = 0.5_prec*(this%geometry%dsdx%interior(i,j,k,iel,1,1:3,2)+ &
+                         this%geometry%dsdx%interior(i,n,k,iel,1,1:3,2))
+        df = df+dsplit(n,j)*TwoPointFlux_Euler3D(prim(i,j,k,iel,1:5),prim(i,n,k,iel,1:5),nhat,this%gamma)
+        ! Computational direction 3
+        nhat = 0.5_prec*(this%geometry%dsdx%interior(i,j,k,iel,1,1:3,3)+ &
+                         this%geometry%dsdx%interior(i,j,n,iel,1,1:3,3))
+        df = df+dsplit(n,k)*TwoPointFlux_Euler3D(prim(i,j,k,iel,1:5),prim(i,j,n,iel,1:5),nhat,this%gamma)
+      enddo
+      this%fluxDivergence%interior(i,j,k,iel,1:5) = this%fluxDivergence%interior(i,j,k,iel,1:5)+df
+
+    enddo
+
+    deallocate(prim,dsplit)
+
+  endsubroutine FluxDivergenceVolume_Euler3D_t
+
+  pure function TwoPointFlux_Euler3D(pL,pR,nhat,gamma) result(f)
+    !! The entropy conserving and kinetic energy preserving flux of Ranocha (2018) in the
+    !! direction nhat, for the primitive states (rho,u,v,w,p)
+    real(prec),intent(in) :: pL(1:5)
+    real(prec),intent(in) :: pR(1:5)
+    real(prec),intent(in) :: nhat(1:3)
+    real(prec),intent(in) :: gamma
+    real(prec) :: f(1:5)
+    ! Local
+    real(prec) :: rhoMean,invRhoPMean,unL,unR,pAvg
+
+    rhoMean = LogarithmicMean(pL(1),pR(1))
+    invRhoPMean = pL(5)*pR(5)*InverseLogarithmicMean(pL(1)*pR(5),pR(1)*pL(5))
+    unL = pL(2)*nhat(1)+pL(3)*nhat(2)+pL(4)*nhat(3)
+    unR = pR(2)*nhat(1)+pR(3)*nhat(2)+pR(4)*nhat(3)
+    pAvg = 0.5_prec*(pL(5)+pR(5))
+
+    f(1) = 0.5_prec*rhoMean*(unL+unR)
+    f(2:4) = 0.5_prec*f(1)*(pL(2:4)+pR(2:4))+pAvg*nhat(1:3)
+    f(5) = f(1)*(0.5_prec*(pL(2)*pR(2)+pL(3)*pR(3)+pL(4)*pR(4))+invRhoPMean/(gamma-1.0_prec))+ &
+           0.5_prec*(pL(5)*unR+pR(5)*unL)
+
+  endfunction TwoPointFlux_Euler3D
+
+  subroutine ThermalBubble_Euler3D_t(this,rho0,rhoprime,Lr,P0,Eprime,Le,x0,y0,z0)
+    !! This subroutine sets the initial condition for a weak blast wave
+    !! problem. The initial condition is given by
+    !!
+    !! \begin{equation}
+    !! \begin{aligned}
+    !! \rho &= \rho_0 + \rho' \exp\left( -\ln(2) \frac{r^2}{L_r^2} \right) \\
+    !! u &= v = w = 0 \\
+    !! E &= \frac{P_0}{\gamma - 1} + E' \exp\left( -\ln(2) \frac{r^2}{L_e^2} \right)
+    !! \end{aligned}
+    !! \end{equation}
+    !!
+    !! where $r$ is the distance from $(x_0,y_0,z_0)$.
+    implicit none
+    class(Euler3D_t),intent(inout) :: this
+    real(prec),intent(in) ::  rho0,rhoprime,Lr,P0,Eprime,Le,x0,y0,z0
+    ! Local
+    integer :: i,j,k,iEl
+    real(prec) :: x,y,z,r
+
+    print*,__FILE__," : Configuring weak blast wave initial condition. "
+    print*,__FILE__," : rho0 = ",rho0
+    print*,__FILE__," : rhoprime = ",rhoprime
+    print*,__FILE__," : Lr = ",Lr
+    print*,__FILE__," : P0 = ",P0
+    print*,__FILE__," : Eprime = ",Eprime
+    print*,__FILE__," : Le = ",Le
+    print*,__FILE__," : x0 = ",x0
+    print*,__FILE__," : y0 = ",y0
+    print*,__FILE__," : z0 = ",z0
+
+    do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
+                  k=1:this%solution%N+1,iel=1:this%mesh%nElem)
+      x = this%geometry%x%interior(i,j,k,iEl,1,1)-x0
+      y = this%geometry%x%interior(i,j,k,iEl,1,2)-y0
+      z = this%geometry%x%interior(i,j,k,iEl,1,3)-z0
+      r = sqrt(x**2+y**2+z**2)
+
+      this%solution%interior(i,j,k,iEl,1) = rho0+rhoprime*exp(-log(2.0_prec)*r**2/Lr**2)
+      this%solution%interior(i,j,k,iEl,2) = 0.0_prec
+      this%solution%interior(i,j,k,iEl,3) = 0.0_prec
+      this%solution%interior(i,j,k,iEl,4) = 0.0_prec
+      this%solution%interior(i,j,k,iEl,5) = P0/(this%gamma-1.0_prec)+ &
+                                            Eprime*exp(-log(2.0_prec)*r**2/Le**2)
+
+    enddo
+
+    call this%ReportMetrics()
+    call this%solution%UpdateDevice()
+
+  endsubroutine ThermalBubble_Euler3D_t
+
+endmodule self_Euler3D_t
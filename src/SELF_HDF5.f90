@@ -39,6 +39,30 @@ module SELF_HDF5
 
   implicit none
 
+  integer,parameter,private :: mantissaInt = merge(int64,int32,prec == real64)
+
+  type,public :: HDF5StoragePolicy
+    !! Storage options for the real datasets written with WriteArray_HDF5. The
+    !! default policy writes contiguous, uncompressed datasets.
+    logical :: chunked = .false.
+    !! Store the datasets in chunks along their last (element) dimension
+    integer :: chunkElems = 64
+    !! Number of elements in each chunk
+    logical :: shuffle = .true.
+    !! Shuffle the bytes of each chunk before compression
+    integer :: deflateLevel = 0
+    !! gzip compression level of each chunk, from 0 (none) to 9
+    integer :: mantissaBits = 0
+    !! When positive, the data is rounded to this many explicit mantissa bits
+    !! before it is written. The zeroed low bits compress well, but this is
+    !! lossy and must not be used for data that is read back for a pickup run.
+
+  contains
+
+    procedure,public :: Lossless => Lossless_HDF5StoragePolicy
+
+  endtype HDF5StoragePolicy
+
   interface Open_HDF5
     module procedure :: Open_HDF5_serial
     module procedure :: Open_HDF5_parallel
@@ -52,6 +76,7 @@ module SELF_HDF5
 
   interface WriteAttribute_HDF5
     module procedure :: WriteAttribute_HDF5_int32
+    module procedure :: WriteAttribute_HDF5_real
   endinterface
 
   interface ReadArray_HDF5
@@ -97,7 +122,7 @@ module SELF_HDF5
     module procedure :: WriteArray_HDF5_real_r3_parallel
     module procedure :: WriteArray_HDF5_real_r4_parallel
 
-    !module procedure :: WriteArray_HDF5_int32_r3_parallel
+    module procedure :: WriteArray_HDF5_int32_r3_parallel
     !module procedure :: WriteArray_HDF5_int32_r4_parallel
 
   endinterface
@@ -107,6 +132,8 @@ module SELF_HDF5
   public :: Open_HDF5
   public :: Close_HDF5
   public :: CreateGroup_HDF5
+  public :: CreateExternalLink_HDF5
+  public :: CreateDataset_HDF5
   public :: ReadAttribute_HDF5
   public :: WriteAttribute_HDF5
   public :: ReadArray_HDF5
@@ -214,6 +241,145 @@ contains
 
   endsubroutine CreateGroup_HDF5
 
+  subroutine CreateExternalLink_HDF5(fileId,linkName,targetFile,targetName)
+    !! Creates a link, linkName, in the open file that points to the object
+    !! targetName in the file targetFile. When targetFile is a relative path,
+    !! HDF5 resolves it relative to the directory of the file holding the link.
+    implicit none
+    integer(HID_T),intent(in) :: fileId
+    character(*),intent(in) :: linkName
+    character(*),intent(in) :: targetFile
+    character(*),intent(in) :: targetName
+    ! Local
+    integer :: error
+
+    call h5lcreate_external_f(trim(targetFile),trim(targetName),fileId,trim(linkName),error)
+
+    if(error /= 0) then
+      print*,__FILE__," : Failed to create external link "//trim(linkName)// &
+        " to "//trim(targetFile)//":"//trim(targetName)
+    endif
+
+  endsubroutine CreateExternalLink_HDF5
+
+  subroutine CreateDataset_HDF5(fileId,arrayName,globalDims,fileOffset)
+    !! Creates a contiguous dataset without writing to it, and returns the offset of
+    !! its data in the file, in bytes. The storage is allocated when the dataset is
+    !! created and is not filled, so that the data can be written to the file directly
+    !! (e.g. with MPI-IO) after the file is closed.
+    implicit none
+    integer(HID_T),intent(in) :: fileId
+    character(*),intent(in) :: arrayName
+    integer(HSIZE_T),intent(in) :: globalDims(:)
+    integer(HADDR_T),intent(out) :: fileOffset
+    ! Local
+    integer(HID_T) :: plistId
+    integer(HID_T) :: dsetId
+    integer(HID_T) :: filespace
+    integer :: error
+
+    call h5screate_simple_f(size(globalDims),globalDims,filespace,error)
+
+    call h5pcreate_f(H5P_DATASET_CREATE_F,plistId,error)
+    call h5pset_layout_f(plistId,H5D_CONTIGUOUS_F,error)
+    call h5pset_alloc_time_f(plistId,H5D_ALLOC_TIME_EARLY_F,error)
+    call h5pset_fill_time_f(plistId,H5D_FILL_TIME_NEVER_F,error)
+
+    call h5dcreate_f(fileId,trim(arrayName),HDF5_IO_PREC,filespace,dsetId,error,dcpl_id=plistId)
+    if(error /= 0) then
+      print*,__FILE__," : Failed to create dataset "//trim(arrayName)
+      stop 1
+    endif
+
+    call h5dget_offset_f(dsetId,fileOffset,error)
+    if(error /= 0) then
+      print*,__FILE__," : Failed to get the file offset of dataset "//trim(arrayName)
+      stop 1
+    endif
+
+    call h5pclose_f(plistId,error)
+    call h5sclose_f(filespace,error)
+    call h5dclose_f(dsetId,error)
+
+  endsubroutine CreateDataset_HDF5
+
+  function Lossless_HDF5StoragePolicy(this) result(lossless)
+    !! Returns a copy of this policy without the mantissa rounding
+    implicit none
+    class(HDF5StoragePolicy),intent(in) :: this
+    type(HDF5StoragePolicy) :: lossless
+
+    lossless = this
+    lossless%mantissaBits = 0
+
+  endfunction Lossless_HDF5StoragePolicy
+
+  subroutine DatasetCreationProperties_HDF5(dims,plistId,storage)
+    !! Creates the dataset creation property list for a dataset of shape dims.
+    !! When the storage policy is chunked, each chunk holds all of the data of
+    !! up to storage % chunkElems consecutive elements along the last dimension.
+    implicit none
+    integer(HSIZE_T),intent(in) :: dims(:)
+    integer(HID_T),intent(out) :: plistId
+    type(HDF5StoragePolicy),optional,intent(in) :: storage
+    ! Local
+    integer(HSIZE_T) :: chunkDims(1:size(dims))
+    integer :: rank
+    integer :: error
+
+    call h5pcreate_f(H5P_DATASET_CREATE_F,plistId,error)
+    if(.not. present(storage)) return
+    if(.not. storage%chunked) return
+
+    rank = size(dims)
+    chunkDims = max(dims,1_HSIZE_T)
+    chunkDims(rank) = max(min(dims(rank),int(storage%chunkElems,HSIZE_T)),1_HSIZE_T)
+    call h5pset_chunk_f(plistId,rank,chunkDims,error)
+
+    if(storage%shuffle .and. storage%deflateLevel > 0) call h5pset_shuffle_f(plistId,error)
+    if(storage%deflateLevel > 0) call h5pset_deflate_f(plistId,min(storage%deflateLevel,9),error)
+
+    if(error /= 0) then
+      print*,__FILE__," : Failed to set the dataset storage properties"
+      stop 1
+    endif
+
+  endsubroutine DatasetCreationProperties_HDF5
+
+  logical function RoundsMantissa_HDF5(storage) result(rounds)
+    implicit none
+    type(HDF5StoragePolicy),optional,intent(in) :: storage
+
+    rounds = .false.
+    if(present(storage)) rounds = (storage%mantissaBits > 0)
+
+  endfunction RoundsMantissa_HDF5
+
+  elemental function RoundMantissa_HDF5(x,mantissaBits) result(y)
+    !! Rounds x to the nearest value with mantissaBits explicit mantissa bits, by
+    !! zeroing the low bits of its binary representation. Values that are not
+    !! finite are returned unchanged.
+    implicit none
+    real(prec),intent(in) :: x
+    integer,intent(in) :: mantissaBits
+    real(prec) :: y
+    ! Local
+    integer :: nDrop
+    integer(mantissaInt) :: bits
+
+    nDrop = digits(x)-1-mantissaBits
+    if(nDrop <= 0 .or. .not.(abs(x) <= huge(x))) then
+      y = x
+      return
+    endif
+
+    bits = transfer(x,bits)
+    bits = bits+ishft(1_mantissaInt,nDrop-1)
+    bits = iand(bits,not(ishft(1_mantissaInt,nDrop)-1_mantissaInt))
+    y = transfer(bits,y)
+
+  endfunction RoundMantissa_HDF5
+
   subroutine ReadAttribute_HDF5_int32(fileId,attributeName,attribute)
     implicit none
     integer(HID_T),intent(in) :: fileId
@@ -301,6 +467,27 @@ contains
 
   endsubroutine WriteAttribute_HDF5_int32
 
+  subroutine WriteAttribute_HDF5_real(fileId,attributeName,attribute)
+    implicit none
+    integer(HID_T),intent(in) :: fileId
+    character(*),intent(in) :: attributeName
+    real(prec),intent(in) :: attribute
+    ! Local
+    integer(HID_T) :: aspaceId
+    integer(HID_T) :: attrId
+    integer(HSIZE_T) :: dims(1:1)
+    integer :: error
+
+    dims(1) = 1
+    call h5screate_f(H5S_SCALAR_F,aspaceId,error)
+    call h5acreate_f(fileId,trim(attributeName),HDF5_IO_PREC, &
+                     aspaceId,attrId,error)
+    call h5awrite_f(attrId,HDF5_IO_PREC,attribute,dims,error)
+    call h5sclose_f(aspaceId,error)
+    call h5aclose_f(attrId,error)
+
+  endsubroutine WriteAttribute_HDF5_real
+
   subroutine WriteArray_HDF5_real_r1_serial(fileId,arrayName,hfArray)
     implicit none
     integer(HID_T),intent(in) :: fileId
@@ -351,12 +538,14 @@ contains
 
   endsubroutine WriteArray_HDF5_real_r2_serial
 
-  subroutine WriteArray_HDF5_real_r3_serial(fileId,arrayName,hfArray)
+  subroutine WriteArray_HDF5_real_r3_serial(fileId,arrayName,hfArray,storage)
     implicit none
     integer(HID_T),intent(in) :: fileId
     character(*),intent(in) :: arrayName
     real(prec),dimension(:,:,:),intent(in) :: hfArray
+    type(HDF5StoragePolicy),optional,intent(in) :: storage
     ! Local
+    integer(HID_T) :: plistId
     integer(HID_T) :: dsetId
     integer(HID_T) :: memspace
     integer(HSIZE_T) :: dims(1:3)
@@ -365,23 +554,32 @@ contains
     dims = shape(hfArray)
     call h5screate_simple_f(3,dims,memspace,error)
 
+    call DatasetCreationProperties_HDF5(dims,plistId,storage)
     call h5dcreate_f(fileId,trim(arrayName),HDF5_IO_PREC,memspace, &
-                     dsetId,error)
+                     dsetId,error,dcpl_id=plistId)
 
-    call h5dwrite_f(dsetId,HDF5_IO_PREC, &
-                    hfArray,dims,error)
+    if(RoundsMantissa_HDF5(storage)) then
+      call h5dwrite_f(dsetId,HDF5_IO_PREC, &
+                      RoundMantissa_HDF5(hfArray,storage%mantissaBits),dims,error)
+    else
+      call h5dwrite_f(dsetId,HDF5_IO_PREC, &
+                      hfArray,dims,error)
+    endif
 
+    call h5pclose_f(plistId,error)
     call h5dclose_f(dSetId,error)
     call h5sclose_f(memspace,error)
 
   endsubroutine WriteArray_HDF5_real_r3_serial
 
-  subroutine WriteArray_HDF5_real_r4_serial(fileId,arrayName,hfArray)
+  subroutine WriteArray_HDF5_real_r4_serial(fileId,arrayName,hfArray,storage)
     implicit none
     integer(HID_T),intent(in) :: fileId
     character(*),intent(in) :: arrayName
     real(prec),dimension(:,:,:,:),intent(in) :: hfArray
+    type(HDF5StoragePolicy),optional,intent(in) :: storage
     ! Local
+    integer(HID_T) :: plistId
     integer(HID_T) :: dsetId
     integer(HID_T) :: memspace
     integer(HSIZE_T) :: dims(1:4)
@@ -391,12 +589,19 @@ contains
 
     call h5screate_simple_f(4,dims,memspace,error)
 
+    call DatasetCreationProperties_HDF5(dims,plistId,storage)
     call h5dcreate_f(fileId,trim(arrayName),HDF5_IO_PREC,memspace, &
-                     dsetId,error)
+                     dsetId,error,dcpl_id=plistId)
 
-    call h5dwrite_f(dsetId,HDF5_IO_PREC, &
-                    hfArray,dims,error)
+    if(RoundsMantissa_HDF5(storage)) then
+      call h5dwrite_f(dsetId,HDF5_IO_PREC, &
+                      RoundMantissa_HDF5(hfArray,storage%mantissaBits),dims,error)
+    else
+      call h5dwrite_f(dsetId,HDF5_IO_PREC, &
+                      hfArray,dims,error)
+    endif
 
+    call h5pclose_f(plistId,error)
     call h5dclose_f(dSetId,error)
     call h5sclose_f(memspace,error)
 
@@ -550,14 +755,16 @@ contains
 
   endsubroutine WriteArray_HDF5_int32_r4_serial
 
-  subroutine WriteArray_HDF5_real_r3_parallel(fileId,arrayName,hfArray,offset,globalDims)
+  subroutine WriteArray_HDF5_real_r3_parallel(fileId,arrayName,hfArray,offset,globalDims,storage)
     implicit none
     integer(HID_T),intent(in) :: fileId
     character(*),intent(in) :: arrayName
     integer(HID_T),intent(in) :: offset(1:3)
     real(prec),dimension(:,:,:),intent(in) :: hfArray
     integer(HID_T),intent(in) :: globalDims(1:3)
+    type(HDF5StoragePolicy),optional,intent(in) :: storage
     ! Local
+    integer(HID_T) :: dcplId
     integer(HID_T) :: plistId
     integer(HID_T) :: dsetId
     integer(HID_T) :: filespace
@@ -570,7 +777,9 @@ contains
     call h5screate_simple_f(3,globalDims,filespace,error)
     call h5screate_simple_f(3,dims,memspace,error)
 
-    call h5dcreate_f(fileId,trim(arrayName),HDF5_IO_PREC,filespace,dsetId,error)
+    call DatasetCreationProperties_HDF5(globalDims,dcplId,storage)
+    call h5dcreate_f(fileId,trim(arrayName),HDF5_IO_PREC,filespace,dsetId,error,dcpl_id=dcplId)
+    call h5pclose_f(dcplId,error)
 
     call h5sselect_hyperslab_f(filespace, &
                                H5S_SELECT_SET_F, &
@@ -580,8 +789,13 @@ contains
 
     call h5pcreate_f(H5P_DATASET_XFER_F,plistId,error)
     call h5pset_dxpl_mpio_f(plistId,H5FD_MPIO_COLLECTIVE_F,error)
-    call h5dwrite_f(dsetId,HDF5_IO_PREC,hfArray,dims,error, &
-                    mem_space_id=memspace,file_space_id=filespace,xfer_prp=plistId)
+    if(RoundsMantissa_HDF5(storage)) then
+      call h5dwrite_f(dsetId,HDF5_IO_PREC,RoundMantissa_HDF5(hfArray,storage%mantissaBits),dims,error, &
+                      mem_space_id=memspace,file_space_id=filespace,xfer_prp=plistId)
+    else
+      call h5dwrite_f(dsetId,HDF5_IO_PREC,hfArray,dims,error, &
+                      mem_space_id=memspace,file_space_id=filespace,xfer_prp=plistId)
+    endif
 
     if(error /= 0) then
       print*,'Failure to write dataset'
@@ -595,15 +809,17 @@ contains
 
   endsubroutine WriteArray_HDF5_real_r3_parallel
 
-  subroutine WriteArray_HDF5_real_r4_parallel(fileId,arrayName,hfArray,offset,globalDims)
+  subroutine WriteArray_HDF5_real_r4_parallel(fileId,arrayName,hfArray,offset,globalDims,storage)
     implicit none
     integer(HID_T),intent(in) :: fileId
     character(*),intent(in) :: arrayName
     integer(HID_T),intent(in) :: offset(1:4)
     real(prec),dimension(:,:,:,:),intent(in) :: hfArray
     integer(HID_T),intent(in) :: globalDims(1:4)
+    type(HDF5StoragePolicy),optional,intent(in) :: storage
 
     ! Local
+    integer(HID_T) :: dcplId
     integer(HID_T) :: plistId
     integer(HID_T) :: dsetId
     integer(HID_T) :: filespace
@@ -615,7 +831,9 @@ contains
     call h5screate_simple_f(4,globalDims,filespace,error)
     call h5screate_simple_f(4,dims,memspace,error)
 
-    call h5dcreate_f(fileId,trim(arrayName),HDF5_IO_PREC,filespace,dsetId,error)
+    call DatasetCreationProperties_HDF5(globalDims,dcplId,storage)
+    call h5dcreate_f(fileId,trim(arrayName),HDF5_IO_PREC,filespace,dsetId,error,dcpl_id=dcplId)
+    call h5pclose_f(dcplId,error)
 
     call h5sselect_hyperslab_f(filespace, &
                                H5S_SELECT_SET_F, &
@@ -625,8 +843,13 @@ contains
 
     call h5pcreate_f(H5P_DATASET_XFER_F,plistId,error)
     call h5pset_dxpl_mpio_f(plistId,H5FD_MPIO_COLLECTIVE_F,error)
-    call h5dwrite_f(dsetId,HDF5_IO_PREC,hfArray,dims,error, &
-                    mem_space_id=memspace,file_space_id=filespace,xfer_prp=plistId)
+    if(RoundsMantissa_HDF5(storage)) then
+      call h5dwrite_f(dsetId,HDF5_IO_PREC,RoundMantissa_HDF5(hfArray,storage%mantissaBits),dims,error, &
+                      mem_space_id=memspace,file_space_id=filespace,xfer_prp=plistId)
+    else
+      call h5dwrite_f(dsetId,HDF5_IO_PREC,hfArray,dims,error, &
+                      mem_space_id=memspace,file_space_id=filespace,xfer_prp=plistId)
+    endif
 
     if(error /= 0) then
       print*,'Failure to write dataset'
@@ -639,50 +862,50 @@ contains
     call h5sclose_f(memspace,error)
   endsubroutine WriteArray_HDF5_real_r4_parallel
 
-  ! subroutine WriteArray_HDF5_int32_r3_parallel(fileId,arrayName,hfArray,offset,globalDims)
-  !   implicit none
-  !   integer(HID_T),intent(in) :: fileId
-  !   character(*),intent(in) :: arrayName
-  !   integer(HID_T),intent(in) :: offset(1:3)
-  !   integer(int32),dimension(:,:,:),intent(in) :: hfArray
-  !   integer(HID_T),intent(in) :: globalDims(1:3)
-  !   ! Local
-  !   integer(HID_T) :: plistId
-  !   integer(HID_T) :: dsetId
-  !   integer(HID_T) :: filespace
-  !   integer(HID_T) :: memspace
-  !   integer(HSIZE_T) :: dims(1:3)
-  !   integer :: error
+  subroutine WriteArray_HDF5_int32_r3_parallel(fileId,arrayName,hfArray,offset,globalDims)
+    implicit none
+    integer(HID_T),intent(in) :: fileId
+    character(*),intent(in) :: arrayName
+    integer(HID_T),intent(in) :: offset(1:3)
+    integer(int32),dimension(:,:,:),intent(in) :: hfArray
+    integer(HID_T),intent(in) :: globalDims(1:3)
+    ! Local
+    integer(HID_T) :: plistId
+    integer(HID_T) :: dsetId
+    integer(HID_T) :: filespace
+    integer(HID_T) :: memspace
+    integer(HSIZE_T) :: dims(1:3)
+    integer :: error
 
-  !   dims = shape(hfArray)
+    dims = shape(hfArray)
 
-  !   call h5screate_simple_f(3,globalDims,filespace,error)
-  !   call h5screate_simple_f(3,dims,memspace,error)
+    call h5screate_simple_f(3,globalDims,filespace,error)
+    call h5screate_simple_f(3,dims,memspace,error)
 
-  !   call h5dcreate_f(fileId,trim(arrayName),HDF5_IO_PREC,filespace,dsetId,error)
+    call h5dcreate_f(fileId,trim(arrayName),H5T_STD_I32LE,filespace,dsetId,error)
 
-  !   call h5sselect_hyperslab_f(filespace, &
-  !                              H5S_SELECT_SET_F, &
-  !                              offset, &
-  !                              dims, &
-  !                              error)
+    call h5sselect_hyperslab_f(filespace, &
+                               H5S_SELECT_SET_F, &
+                               offset, &
+                               dims, &
+                               error)
 
-  !   call h5pcreate_f(H5P_DATASET_XFER_F,plistId,error)
-  !   call h5pset_dxpl_mpio_f(plistId,H5FD_MPIO_COLLECTIVE_F,error)
-  !   call h5dwrite_f(dsetId,H5T_STD_I32LE,hfArray,dims,error, &
-  !                   mem_space_id=memspace,file_space_id=filespace,xfer_prp=plistId)
+    call h5pcreate_f(H5P_DATASET_XFER_F,plistId,error)
+    call h5pset_dxpl_mpio_f(plistId,H5FD_MPIO_COLLECTIVE_F,error)
+    call h5dwrite_f(dsetId,H5T_STD_I32LE,hfArray,dims,error, &
+                    mem_space_id=memspace,file_space_id=filespace,xfer_prp=plistId)
 
-  !   if(error /= 0) then
-  !     print*,'Failure to write dataset'
-  !     stop 1
-  !   endif
+    if(error /= 0) then
+      print*,'Failure to write dataset'
+      stop 1
+    endif
 
-  !   call h5pclose_f(plistId,error)
-  !   call h5sclose_f(filespace,error)
-  !   call h5dclose_f(dSetId,error)
-  !   call h5sclose_f(memspace,error)
+    call h5pclose_f(plistId,error)
+    call h5sclose_f(filespace,error)
+    call h5dclose_f(dSetId,error)
+    call h5sclose_f(memspace,error)
 
-  ! endsubroutine WriteArray_HDF5_int32_r3_parallel
+  endsubroutine WriteArray_HDF5_int32_r3_parallel
 
   ! subroutine WriteArray_HDF5_int32_r4_parallel(fileId,arrayName,hfArray,offset,globalDims)
   !   implicit none
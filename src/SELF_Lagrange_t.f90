@@ -100,6 +100,13 @@ module SELF_Lagrange_t
     real(prec),pointer,contiguous,dimension(:,:) :: bMatrix
       !! The boundary interpolation matrix that is used to map a grid of nodal values at the control points to the element boundaries.
 
+    real(prec),pointer,contiguous,dimension(:) :: interpWork1 => null()
+      !! Scratch space for the first pass of the sum-factorized grid interpolation. It is allocated on the
+      !! first call to GridInterp_2D or GridInterp_3D and is only reallocated when a larger batch is interpolated.
+
+    real(prec),pointer,contiguous,dimension(:) :: interpWork2 => null()
+      !! Scratch space for the second pass of the sum-factorized grid interpolation in three dimensions.
+
   contains
 
     procedure,public :: Init => Init_Lagrange_t
@@ -107,6 +114,9 @@ module SELF_Lagrange_t
 
     procedure,public :: WriteHDF5 => WriteHDF5_Lagrange_t
 
+    procedure,public :: GridInterp_2D => GridInterp_2D_Lagrange_t
+    procedure,public :: GridInterp_3D => GridInterp_3D_Lagrange_t
+
     procedure,public :: CalculateBarycentricWeights
     procedure,public :: CalculateInterpolationMatrix
     procedure,public :: CalculateDerivativeMatrix
@@ -208,6 +218,8 @@ contains
     deallocate(this%dMatrix)
     deallocate(this%dgMatrix)
     deallocate(this%bMatrix)
+    if(associated(this%interpWork1)) deallocate(this%interpWork1)
+    if(associated(this%interpWork2)) deallocate(this%interpWork2)
 
   endsubroutine Free_Lagrange_t
 
@@ -456,6 +468,111 @@ contains
 
   endfunction CalculateLagrangePolynomials
 
+  subroutine ReserveInterpWork(work,n)
+    !! Ensures that the scratch array work holds at least n values. Existing storage is
+    !! kept when it is large enough so that repeated interpolations do not reallocate.
+    implicit none
+    real(prec),pointer,contiguous,intent(inout) :: work(:)
+    integer,intent(in) :: n
+
+    if(associated(work)) then
+      if(size(work) >= n) return
+      deallocate(work)
+    endif
+    allocate(work(1:n))
+
+  endsubroutine ReserveInterpWork
+
+  subroutine GridInterp_2D_Lagrange_t(this,f,fTarget,nblocks)
+    !! Interpolates nblocks two-dimensional blocks of nodal values from the control grid to the target grid.
+    !! The tensor-product interpolant is applied one direction at a time (sum-factorization), which costs
+    !! O(M N^2 + M^2 N) per block instead of the O(M^2 N^2) of evaluating the full interpolant at every
+    !! target point. Callers pass their interior data with the element, variable and direction dimensions
+    !! collapsed into nblocks.
+    implicit none
+    class(Lagrange_t),intent(inout) :: this
+    integer,intent(in) :: nblocks
+    !! The number of (N+1)x(N+1) blocks to interpolate
+    real(prec),intent(in) :: f(1:this%N+1,1:this%N+1,1:nblocks)
+    !! (Input) Nodal values on the control grid
+    real(prec),intent(out) :: fTarget(1:this%M+1,1:this%M+1,1:nblocks)
+    !! (Output) Nodal values on the target grid
+    ! Local
+    real(prec),pointer,contiguous :: work(:,:,:)
+    integer :: i,j,ii,jj,iblock
+    real(prec) :: fi,fij
+
+    call ReserveInterpWork(this%interpWork1,(this%M+1)*(this%N+1)*nblocks)
+    work(1:this%M+1,1:this%N+1,1:nblocks) => this%interpWork1
+
+    do concurrent(i=1:this%M+1,jj=1:this%N+1,iblock=1:nblocks)
+      fi = 0.0_prec
+      do ii = 1,this%N+1
+        fi = fi+f(ii,jj,iblock)*this%iMatrix(ii,i)
+      enddo
+      work(i,jj,iblock) = fi
+    enddo
+
+    do concurrent(i=1:this%M+1,j=1:this%M+1,iblock=1:nblocks)
+      fij = 0.0_prec
+      do jj = 1,this%N+1
+        fij = fij+work(i,jj,iblock)*this%iMatrix(jj,j)
+      enddo
+      fTarget(i,j,iblock) = fij
+    enddo
+
+  endsubroutine GridInterp_2D_Lagrange_t
+
+  subroutine GridInterp_3D_Lagrange_t(this,f,fTarget,nblocks)
+    !! Interpolates nblocks three-dimensional blocks of nodal values from the control grid to the target grid.
+    !! The interpolation is done in three passes, one per computational direction, so that the cost per block
+    !! is O(M N^3 + M^2 N^2 + M^3 N) instead of O(M^3 N^3). The results of the first two passes are kept in
+    !! interpWork1 and interpWork2.
+    implicit none
+    class(Lagrange_t),intent(inout) :: this
+    integer,intent(in) :: nblocks
+    !! The number of (N+1)x(N+1)x(N+1) blocks to interpolate
+    real(prec),intent(in) :: f(1:this%N+1,1:this%N+1,1:this%N+1,1:nblocks)
+    !! (Input) Nodal values on the control grid
+    real(prec),intent(out) :: fTarget(1:this%M+1,1:this%M+1,1:this%M+1,1:nblocks)
+    !! (Output) Nodal values on the target grid
+    ! Local
+    real(prec),pointer,contiguous :: work1(:,:,:,:)
+    real(prec),pointer,contiguous :: work2(:,:,:,:)
+    integer :: i,j,k,ii,jj,kk,iblock
+    real(prec) :: fi,fij,fijk
+
+    call ReserveInterpWork(this%interpWork1,(this%M+1)*(this%N+1)*(this%N+1)*nblocks)
+    call ReserveInterpWork(this%interpWork2,(this%M+1)*(this%M+1)*(this%N+1)*nblocks)
+    work1(1:this%M+1,1:this%N+1,1:this%N+1,1:nblocks) => this%interpWork1
+    work2(1:this%M+1,1:this%M+1,1:this%N+1,1:nblocks) => this%interpWork2
+
+    do concurrent(i=1:this%M+1,jj=1:this%N+1,kk=1:this%N+1,iblock=1:nblocks)
+      fi = 0.0_prec
+      do ii = 1,this%N+1
+        fi = fi+f(ii,jj,kk,iblock)*this%iMatrix(ii,i)
+      enddo
+      work1(i,jj,kk,iblock) = fi
+    enddo
+
+    do concurrent(i=1:this%M+1,j=1:this%M+1,kk=1:this%N+1,iblock=1:nblocks)
+      fij = 0.0_prec
+      do jj = 1,this%N+1
+        fij = fij+work1(i,jj,kk,iblock)*this%iMatrix(jj,j)
+      enddo
+      work2(i,j,kk,iblock) = fij
+    enddo
+
+    do concurrent(i=1:this%M+1,j=1:this%M+1,k=1:this%M+1,iblock=1:nblocks)
+      fijk = 0.0_prec
+      do kk = 1,this%N+1
+        fijk = fijk+work2(i,j,kk,iblock)*this%iMatrix(kk,k)
+      enddo
+      fTarget(i,j,k,iblock) = fijk
+    enddo
+
+  endsubroutine GridInterp_3D_Lagrange_t
+
   subroutine WriteHDF5_Lagrange_t(this,fileId)
     implicit none
     class(Lagrange_t),intent(in) :: this
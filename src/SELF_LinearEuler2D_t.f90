@@ -70,9 +70,12 @@ module self_LinearEuler2D_t
     procedure :: SetNumberOfVariables => SetNumberOfVariables_LinearEuler2D_t
     procedure :: SetMetadata => SetMetadata_LinearEuler2D_t
     procedure :: entropy_func => entropy_func_LinearEuler2D_t
+    procedure :: maxWaveSpeed => maxWaveSpeed_LinearEuler2D_t
     procedure :: hbc2d_NoNormalFlow => hbc2d_NoNormalFlow_LinearEuler2D_t
     procedure :: flux2d => flux2d_LinearEuler2D_t
     procedure :: riemannflux2d => riemannflux2d_LinearEuler2D_t
+    procedure :: flux2d_batch => flux2d_batch_LinearEuler2D_t
+    procedure :: riemannflux2d_batch => riemannflux2d_batch_LinearEuler2D_t
     !procedure :: source2d => source2d_LinearEuler2D_t
     procedure :: SphericalSoundWave => SphericalSoundWave_LinearEuler2D_t
 
@@ -121,6 +124,16 @@ contains
 
   endfunction entropy_func_LinearEuler2D_t
 
+  pure function maxWaveSpeed_LinearEuler2D_t(this,s) result(c)
+    !! Sound waves are the fastest waves in the linear model
+    class(LinearEuler2D_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%nvar)
+    real(prec) :: c
+
+    c = this%c
+
+  endfunction maxWaveSpeed_LinearEuler2D_t
+
   pure function hbc2d_NoNormalFlow_LinearEuler2D_t(this,s,nhat) result(exts)
     class(LinearEuler2D_t),intent(in) :: this
     real(prec),intent(in) :: s(1:this%nvar)
@@ -235,4 +248,50 @@ contains
 
   endsubroutine SphericalSoundWave_LinearEuler2D_t
 
+  pure subroutine flux2d_batch_LinearEuler2D_t(this,s,dsdx,flux)
+    class(LinearEuler2D_t),intent(in) :: this
+    real(prec),intent(in) :: s(:,:)
+    real(prec),intent(in) :: dsdx(:,:,:)
+    real(prec),intent(out) :: flux(:,:,:)
+    ! Local
+    integer :: n
+
+    do concurrent(n=1:size(s,1))
+      flux(n,1,1) = this%rho0*s(n,2) ! density, x flux ; rho0*u
+      flux(n,1,2) = this%rho0*s(n,3) ! density, y flux ; rho0*v
+      flux(n,2,1) = s(n,4)/this%rho0 ! x-velocity, x flux; p/rho0
+      flux(n,2,2) = 0.0_prec ! x-velocity, y flux; 0
+      flux(n,3,1) = 0.0_prec ! y-velocity, x flux; 0
+      flux(n,3,2) = s(n,4)/this%rho0 ! y-velocity, y flux; p/rho0
+      flux(n,4,1) = this%c*this%c*this%rho0*s(n,2) ! pressure, x flux : rho0*c^2*u
+      flux(n,4,2) = this%c*this%c*this%rho0*s(n,3) ! pressure, y flux : rho0*c^2*v
+    enddo
+
+  endsubroutine flux2d_batch_LinearEuler2D_t
+
+  pure subroutine riemannflux2d_batch_LinearEuler2D_t(this,sL,sR,dsdx,nhat,flux)
+    !! Local lax-friedrich's upwind flux, as in riemannflux2d
+    class(LinearEuler2D_t),intent(in) :: this
+    real(prec),intent(in) :: sL(:,:)
+    real(prec),intent(in) :: sR(:,:)
+    real(prec),intent(in) :: dsdx(:,:,:)
+    real(prec),intent(in) :: nhat(:,:)
+    real(prec),intent(out) :: flux(:,:)
+    ! Local
+    integer :: n
+    real(prec) :: unL,unR,c,rho0
+
+    rho0 = this%rho0
+    c = this%c
+    do concurrent(n=1:size(sL,1))
+      unL = sL(n,2)*nhat(n,1)+sL(n,3)*nhat(n,2)
+      unR = sR(n,2)*nhat(n,1)+sR(n,3)*nhat(n,2)
+      flux(n,1) = 0.5_prec*rho0*(unL+unR)+c*(sL(n,1)-sR(n,1)) ! density
+      flux(n,2) = 0.5_prec*(sL(n,4)+sR(n,4))*nhat(n,1)/rho0+c*(sL(n,2)-sR(n,2)) ! u
+      flux(n,3) = 0.5_prec*(sL(n,4)+sR(n,4))*nhat(n,2)/rho0+c*(sL(n,3)-sR(n,3)) ! v
+      flux(n,4) = 0.5_prec*rho0*c*c*(unL+unR)+c*(sL(n,4)-sR(n,4)) ! pressure
+    enddo
+
+  endsubroutine riemannflux2d_batch_LinearEuler2D_t
+
 endmodule self_LinearEuler2D_t
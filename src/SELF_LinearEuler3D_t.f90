@@ -73,9 +73,12 @@ module self_LinearEuler3D_t
     procedure :: SetNumberOfVariables => SetNumberOfVariables_LinearEuler3D_t
     procedure :: SetMetadata => SetMetadata_LinearEuler3D_t
     procedure :: entropy_func => entropy_func_LinearEuler3D_t
+    procedure :: maxWaveSpeed => maxWaveSpeed_LinearEuler3D_t
     !procedure :: hbc3D_NoNormalFlow => hbc3D_NoNormalFlow_LinearEuler3D_t
     procedure :: flux3D => flux3D_LinearEuler3D_t
     procedure :: riemannflux3D => riemannflux3D_LinearEuler3D_t
+    procedure :: flux3D_batch => flux3D_batch_LinearEuler3D_t
+    procedure :: riemannflux3D_batch => riemannflux3D_batch_LinearEuler3D_t
     procedure :: SphericalSoundWave => SphericalSoundWave_LinearEuler3D_t
 
   endtype LinearEuler3D_t
@@ -126,6 +129,16 @@ contains
 
   endfunction entropy_func_LinearEuler3D_t
 
+  pure function maxWaveSpeed_LinearEuler3D_t(this,s) result(c)
+    !! Sound waves are the fastest waves in the linear model
+    class(LinearEuler3D_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%nvar)
+    real(prec) :: c
+
+    c = this%c
+
+  endfunction maxWaveSpeed_LinearEuler3D_t
+
   ! pure function hbc3D_NoNormalFlow_LinearEuler3D_t(this,s,nhat) result(exts)
   !   class(LinearEuler3D_t),intent(in) :: this
   !   real(prec),intent(in) :: s(1:this%nvar)
@@ -266,4 +279,62 @@ contains
 
   endsubroutine SphericalSoundWave_LinearEuler3D_t
 
+  pure subroutine flux3D_batch_LinearEuler3D_t(this,s,dsdx,flux)
+    class(LinearEuler3D_t),intent(in) :: this
+    real(prec),intent(in) :: s(:,:)
+    real(prec),intent(in) :: dsdx(:,:,:)
+    real(prec),intent(out) :: flux(:,:,:)
+    ! Local
+    integer :: n
+
+    do concurrent(n=1:size(s,1))
+      flux(n,1,1) = this%rho0*s(n,2) ! density, x flux ; rho0*u
+      flux(n,1,2) = this%rho0*s(n,3) ! density, y flux ; rho0*v
+      flux(n,1,3) = this%rho0*s(n,4) ! density, z flux ; rho0*w
+
+      flux(n,2,1) = s(n,5)/this%rho0 ! x-velocity, x flux; p/rho0
+      flux(n,2,2) = 0.0_prec ! x-velocity, y flux; 0
+      flux(n,2,3) = 0.0_prec ! x-velocity, z flux; 0
+
+      flux(n,3,1) = 0.0_prec ! y-velocity, x flux; 0
+      flux(n,3,2) = s(n,5)/this%rho0 ! y-velocity, y flux; p/rho0
+      flux(n,3,3) = 0.0_prec ! y-velocity, z flux; 0
+
+      flux(n,4,1) = 0.0_prec ! z-velocity, x flux; 0
+      flux(n,4,2) = 0.0_prec ! z-velocity, y flux; 0
+      flux(n,4,3) = s(n,5)/this%rho0 ! z-velocity, z flux; p/rho0
+
+      flux(n,5,1) = this%c*this%c*this%rho0*s(n,2) ! pressure, x flux : rho0*c^2*u
+      flux(n,5,2) = this%c*this%c*this%rho0*s(n,3) ! pressure, y flux : rho0*c^2*v
+      flux(n,5,3) = this%c*this%c*this%rho0*s(n,4) ! pressure, z flux : rho0*c^2*w
+    enddo
+
+  endsubroutine flux3D_batch_LinearEuler3D_t
+
+  pure subroutine riemannflux3D_batch_LinearEuler3D_t(this,sL,sR,dsdx,nhat,flux)
+    !! Local lax-friedrich's upwind flux, as in riemannflux3D
+    class(LinearEuler3D_t),intent(in) :: this
+    real(prec),intent(in) :: sL(:,:)
+    real(prec),intent(in) :: sR(:,:)
+    real(prec),intent(in) :: dsdx(:,:,:)
+    real(prec),intent(in) :: nhat(:,:)
+    real(prec),intent(out) :: flux(:,:)
+    ! Local
+    integer :: n
+    real(prec) :: unL,unR,c,rho0
+
+    rho0 = this%rho0
+    c = this%c
+    do concurrent(n=1:size(sL,1))
+      unL = sL(n,2)*nhat(n,1)+sL(n,3)*nhat(n,2)+sL(n,4)*nhat(n,3)
+      unR = sR(n,2)*nhat(n,1)+sR(n,3)*nhat(n,2)+sR(n,4)*nhat(n,3)
+      flux(n,1) = 0.5_prec*rho0*(unL+unR)+c*(sL(n,1)-sR(n,1)) ! density
+      flux(n,2) = 0.5_prec*(sL(n,5)+sR(n,5))*nhat(n,1)/rho0+c*(sL(n,2)-sR(n,2)) ! u
+      flux(n,3) = 0.5_prec*(sL(n,5)+sR(n,5))*nhat(n,2)/rho0+c*(sL(n,3)-sR(n,3)) ! v
+      flux(n,4) = 0.5_prec*(sL(n,5)+sR(n,5))*nhat(n,3)/rho0+c*(sL(n,4)-sR(n,4)) ! w
+      flux(n,5) = 0.5_prec*rho0*c*c*(unL+unR)+c*(sL(n,5)-sR(n,5)) ! pressure
+    enddo
+
+  endsubroutine riemannflux3D_batch_LinearEuler3D_t
+
 endmodule self_LinearEuler3D_t
@@ -43,8 +43,11 @@ module self_LinearShallowWater2D_t
     procedure :: SetNumberOfVariables => SetNumberOfVariables_LinearShallowWater2D_t
     procedure :: SetMetadata => SetMetadata_LinearShallowWater2D_t
     procedure :: entropy_func => entropy_func_LinearShallowWater2D_t
+    procedure :: maxWaveSpeed => maxWaveSpeed_LinearShallowWater2D_t
     procedure :: flux2d => flux2d_LinearShallowWater2D_t
     procedure :: riemannflux2d => riemannflux2d_LinearShallowWater2D_t
+    procedure :: flux2d_batch => flux2d_batch_LinearShallowWater2D_t
+    procedure :: riemannflux2d_batch => riemannflux2d_batch_LinearShallowWater2D_t
     procedure :: hbc2d_NoNormalFlow => hbc2d_NoNormalFlow_LinearShallowWater2D_t
     procedure :: sourcemethod => sourcemethod_LinearShallowWater2D_t
     ! Custom methods
@@ -181,6 +184,16 @@ contains
 
   endfunction entropy_func_LinearShallowWater2D_t
 
+  pure function maxWaveSpeed_LinearShallowWater2D_t(this,s) result(c)
+    !! Gravity waves travel at the shallow water wave speed, sqrt(g*H)
+    class(LinearShallowWater2D_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%solution%nvar)
+    real(prec) :: c
+
+    c = sqrt(this%g*this%H)
+
+  endfunction maxWaveSpeed_LinearShallowWater2D_t
+
   pure function flux2d_LinearShallowWater2D_t(this,s,dsdx) result(flux)
     class(LinearShallowWater2D_t),intent(in) :: this
     real(prec),intent(in) :: s(1:this%solution%nvar)
@@ -254,4 +267,47 @@ contains
 
   endsubroutine sourcemethod_LinearShallowWater2D_t
 
+  pure subroutine flux2d_batch_LinearShallowWater2D_t(this,s,dsdx,flux)
+    class(LinearShallowWater2D_t),intent(in) :: this
+    real(prec),intent(in) :: s(:,:)
+    real(prec),intent(in) :: dsdx(:,:,:)
+    real(prec),intent(out) :: flux(:,:,:)
+    ! Local
+    integer :: n
+
+    do concurrent(n=1:size(s,1))
+      flux(n,1,1) = this%g*s(n,3)
+      flux(n,1,2) = 0.0_prec
+      flux(n,2,1) = 0.0_prec
+      flux(n,2,2) = this%g*s(n,3)
+      flux(n,3,1) = this%H*s(n,1)
+      flux(n,3,2) = this%H*s(n,2)
+    enddo
+
+  endsubroutine flux2d_batch_LinearShallowWater2D_t
+
+  pure subroutine riemannflux2d_batch_LinearShallowWater2D_t(this,sL,sR,dsdx,nhat,flux)
+    class(LinearShallowWater2D_t),intent(in) :: this
+    real(prec),intent(in) :: sL(:,:)
+    real(prec),intent(in) :: sR(:,:)
+    real(prec),intent(in) :: dsdx(:,:,:)
+    real(prec),intent(in) :: nhat(:,:)
+    real(prec),intent(out) :: flux(:,:)
+    ! Local
+    integer :: n
+    real(prec) :: c,unL,unR
+
+    c = sqrt(this%g*this%H)
+
+    do concurrent(n=1:size(sL,1))
+      unL = sL(n,1)*nhat(n,1)+sL(n,2)*nhat(n,2)
+      unR = sR(n,1)*nhat(n,1)+sR(n,2)*nhat(n,2)
+
+      flux(n,1) = 0.5_prec*(this%g*(sL(n,3)+sR(n,3))+c*(unL-unR))*nhat(n,1)
+      flux(n,2) = 0.5_prec*(this%g*(sL(n,3)+sR(n,3))+c*(unL-unR))*nhat(n,2)
+      flux(n,3) = 0.5_prec*(this%H*(unL+unR)+c*(sL(n,3)-sR(n,3)))
+    enddo
+
+  endsubroutine riemannflux2d_batch_LinearShallowWater2D_t
+
 endmodule self_LinearShallowWater2D_t
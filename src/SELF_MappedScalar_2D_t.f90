@@ -48,6 +48,8 @@ module SELF_MappedScalar_2D_t
     procedure,public :: DissociateGeometry => DissociateGeometry_MappedScalar2D_t
 
     procedure,public :: SideExchange => SideExchange_MappedScalar2D_t
+    procedure,public :: SideExchangeBegin => SideExchangeBegin_MappedScalar2D_t
+    procedure,public :: SideExchangeEnd => SideExchangeEnd_MappedScalar2D_t
 
     generic,public :: MappedGradient => MappedGradient_MappedScalar2D_t
     procedure,private :: MappedGradient_MappedScalar2D_t
@@ -56,7 +58,6 @@ module SELF_MappedScalar_2D_t
     procedure,private :: MappedDGGradient_MappedScalar2D_t
 
     procedure,private :: MPIExchangeAsync => MPIExchangeAsync_MappedScalar2D_t
-    procedure,private :: ApplyFlip => ApplyFlip_MappedScalar2D_t
 
     procedure,public :: SetInteriorFromEquation => SetInteriorFromEquation_MappedScalar2D_t
 
@@ -119,107 +120,31 @@ contains
   endsubroutine SetInteriorFromEquation_MappedScalar2D_t
 
   subroutine MPIExchangeAsync_MappedScalar2D_t(this,mesh)
+    !! Packs the boundary data of the sides shared with other ranks and posts one
+    !! message per neighbor rank.
     implicit none
     class(MappedScalar2D_t),intent(inout) :: this
     type(Mesh2D),intent(inout) :: mesh
-    ! Local
-    integer :: e1,s1,e2,s2,ivar
-    integer :: globalSideId,r2,tag
-    integer :: iError
-    integer :: msgCount
-
-    msgCount = 0
-
-    do ivar = 1,this%nvar
-      do e1 = 1,this%nElem
-        do s1 = 1,4
-
-          e2 = mesh%sideInfo(3,s1,e1) ! Neighbor Element
-          if(e2 > 0) then
-            r2 = mesh%decomp%elemToRank(e2) ! Neighbor Rank
-
-            if(r2 /= mesh%decomp%rankId) then
-
-              s2 = mesh%sideInfo(4,s1,e1)/10
-              globalSideId = abs(mesh%sideInfo(2,s1,e1))
-              ! create unique tag for each side and each variable
-              tag = globalsideid+mesh%nUniqueSides*(ivar-1)
-
-              msgCount = msgCount+1
-              call MPI_IRECV(this%extBoundary(:,s1,e1,ivar), &
-                             (this%interp%N+1), &
-                             mesh%decomp%mpiPrec, &
-                             r2,tag, &
-                             mesh%decomp%mpiComm, &
-                             mesh%decomp%requests(msgCount),iError)
-
-              msgCount = msgCount+1
-              call MPI_ISEND(this%boundary(:,s1,e1,ivar), &
-                             (this%interp%N+1), &
-                             mesh%decomp%mpiPrec, &
-                             r2,tag, &
-                             mesh%decomp%mpiComm, &
-                             mesh%decomp%requests(msgCount),iError)
-            endif
-          endif
-
-        enddo
-      enddo
-    enddo
 
-    mesh%decomp%msgCount = msgCount
+    call mesh%decomp%PackHalo2D(this%boundary,this%interp%N,this%nvar,this%nelem)
+    call mesh%decomp%HaloExchangeAsync((this%interp%N+1)*this%nvar)
 
   endsubroutine MPIExchangeAsync_MappedScalar2D_t
 
-  subroutine ApplyFlip_MappedScalar2D_t(this,mesh)
-    ! Apply side flips to sides where MPI exchanges took place.
+  subroutine SideExchange_MappedScalar2D_t(this,mesh)
     implicit none
     class(MappedScalar2D_t),intent(inout) :: this
-    type(Mesh2D),intent(in) :: mesh
-    ! Local
-    integer :: e1,s1,e2,s2
-    integer :: i,i2
-    integer :: r2,flip,ivar
-    integer :: globalSideId
-    real(prec) :: extBuff(1:this%interp%N+1)
-
-    do ivar = 1,this%nvar
-      do e1 = 1,this%nElem
-        do s1 = 1,4
-
-          e2 = mesh%sideInfo(3,s1,e1) ! Neighbor Element (global id)
-
-          if(e2 > 0) then ! Interior Element
-            r2 = mesh%decomp%elemToRank(e2) ! Neighbor Rank
-
-            if(r2 /= mesh%decomp%rankId) then
-
-              s2 = mesh%sideInfo(4,s1,e1)/10
-              flip = mesh%sideInfo(4,s1,e1)-s2*10
-
-              ! Need to update extBoundary with flip applied
-              if(flip == 1) then
-
-                do i = 1,this%interp%N+1
-                  i2 = this%interp%N+2-i
-                  extBuff(i) = this%extBoundary(i2,s1,e1,ivar)
-                enddo
-                do i = 1,this%interp%N+1
-                  this%extBoundary(i,s1,e1,ivar) = extBuff(i)
-                enddo
-
-              endif
-            endif
-
-          endif
+    type(Mesh2D),intent(inout) :: mesh
 
-        enddo
-      enddo
-    enddo
+    call this%SideExchangeBegin(mesh)
+    call this%SideExchangeEnd(mesh)
 
-  endsubroutine ApplyFlip_MappedScalar2D_t
+  endsubroutine SideExchange_MappedScalar2D_t
 
-  subroutine SideExchange_MappedScalar2D_t(this,mesh)
+  subroutine SideExchangeBegin_MappedScalar2D_t(this,mesh)
+    !! Posts the halo messages to the neighboring ranks and fills extBoundary on the
+    !! sides shared by elements of this rank. The side exchange is complete once
+    !! SideExchangeEnd returns; work that does not read extBoundary can be done in between.
     implicit none
     class(MappedScalar2D_t),intent(inout) :: this
     type(Mesh2D),intent(inout) :: mesh
@@ -274,13 +199,22 @@ contains
       endif
     enddo
 
+  endsubroutine SideExchangeBegin_MappedScalar2D_t
+
+  subroutine SideExchangeEnd_MappedScalar2D_t(this,mesh)
+    !! Waits for the halo messages posted by SideExchangeBegin and copies the
+    !! received data into extBoundary
+    implicit none
+    class(MappedScalar2D_t),intent(inout) :: this
+    type(Mesh2D),intent(inout) :: mesh
+
     if(mesh%decomp%mpiEnabled) then
       call mesh%decomp%FinalizeMPIExchangeAsync()
-      ! Apply side flips for data exchanged with MPI
-      call this%ApplyFlip(mesh)
+      ! Copy the data exchanged with MPI to extBoundary, with the side flips applied
+      call mesh%decomp%UnpackHalo2D(this%extBoundary,this%interp%N,this%nvar,this%nelem)
     endif
 
-  endsubroutine SideExchange_MappedScalar2D_t
+  endsubroutine SideExchangeEnd_MappedScalar2D_t
 
   subroutine MappedGradient_MappedScalar2D_t(this,df)
   !! Calculates the gradient of a function using the strong form of the gradient
@@ -48,14 +48,21 @@ module SELF_MappedVector_2D_t
 
     procedure,public :: SideExchange => SideExchange_MappedVector2D_t
 
+    procedure,public :: ContravariantProjection => ContravariantProjection_MappedVector2D_t
+
     generic,public :: MappedDivergence => MappedDivergence_MappedVector2D_t
     procedure,private :: MappedDivergence_MappedVector2D_t
 
     generic,public :: MappedDGDivergence => MappedDGDivergence_MappedVector2D_t
     procedure,private :: MappedDGDivergence_MappedVector2D_t
 
+    generic,public :: MappedDGDivergenceVolume => MappedDGDivergenceVolume_MappedVector2D_t
+    procedure,private :: MappedDGDivergenceVolume_MappedVector2D_t
+
+    generic,public :: MappedDGDivergenceSurface => MappedDGDivergenceSurface_MappedVector2D_t
+    procedure,private :: MappedDGDivergenceSurface_MappedVector2D_t
+
     procedure,private :: MPIExchangeAsync => MPIExchangeAsync_MappedVector2D_t
-    procedure,private :: ApplyFlip => ApplyFlip_MappedVector2D_t
 
     procedure,public :: SetInteriorFromEquation => SetInteriorFromEquation_MappedVector2D_t
 
@@ -121,109 +128,17 @@ contains
   endsubroutine SetInteriorFromEquation_MappedVector2D_t
 
   subroutine MPIExchangeAsync_MappedVector2D_t(this,mesh)
+    !! Packs the boundary data of the sides shared with other ranks and posts one
+    !! message per neighbor rank.
     implicit none
     class(MappedVector2D_t),intent(inout) :: this
     type(Mesh2D),intent(inout) :: mesh
-    ! Local
-    integer :: e1,s1,e2,s2,ivar,idir
-    integer :: globalSideId,r2,tag
-    integer :: iError
-    integer :: msgCount
-
-    msgCount = 0
-
-    do idir = 1,2
-      do ivar = 1,this%nvar
-        do e1 = 1,this%nElem
-          do s1 = 1,4
-
-            e2 = mesh%sideInfo(3,s1,e1) ! Neighbor Element
-            if(e2 > 0) then
-              r2 = mesh%decomp%elemToRank(e2) ! Neighbor Rank
-
-              if(r2 /= mesh%decomp%rankId) then
-
-                s2 = mesh%sideInfo(4,s1,e1)/10
-                globalSideId = abs(mesh%sideInfo(2,s1,e1))
-                ! create unique tag for each side and each variable
-                tag = globalsideid+mesh%nUniqueSides*(ivar-1+this%nvar*(idir-1))
-
-                msgCount = msgCount+1
-                call MPI_IRECV(this%extBoundary(:,s1,e1,ivar,idir), &
-                               (this%interp%N+1), &
-                               mesh%decomp%mpiPrec, &
-                               r2,tag, &
-                               mesh%decomp%mpiComm, &
-                               mesh%decomp%requests(msgCount),iError)
-
-                msgCount = msgCount+1
-                call MPI_ISEND(this%boundary(:,s1,e1,ivar,idir), &
-                               (this%interp%N+1), &
-                               mesh%decomp%mpiPrec, &
-                               r2,tag, &
-                               mesh%decomp%mpiComm, &
-                               mesh%decomp%requests(msgCount),iError)
-              endif
-            endif
 
-          enddo
-        enddo
-      enddo
-    enddo
-
-    mesh%decomp%msgCount = msgCount
+    call mesh%decomp%PackHalo2D(this%boundary,this%interp%N,2*this%nvar,this%nelem)
+    call mesh%decomp%HaloExchangeAsync((this%interp%N+1)*2*this%nvar)
 
   endsubroutine MPIExchangeAsync_MappedVector2D_t
 
-  subroutine ApplyFlip_MappedVector2D_t(this,mesh)
-    ! Apply side flips to sides where MPI exchanges took place.
-    implicit none
-    class(MappedVector2D_t),intent(inout) :: this
-    type(Mesh2D),intent(in) :: mesh
-    ! Local
-    integer :: e1,s1,e2,s2
-    integer :: i,i2
-    integer :: r2,flip,ivar,idir
-    real(prec) :: extBuff(1:this%interp%N+1)
-
-    do idir = 1,2
-      do ivar = 1,this%nvar
-        do e1 = 1,this%nElem
-          do s1 = 1,4
-
-            e2 = mesh%sideInfo(3,s1,e1) ! Neighbor Element (global id)
-
-            if(e2 > 0) then ! Interior Element
-              r2 = mesh%decomp%elemToRank(e2) ! Neighbor Rank
-
-              if(r2 /= mesh%decomp%rankId) then
-
-                s2 = mesh%sideInfo(4,s1,e1)/10
-                flip = mesh%sideInfo(4,s1,e1)-s2*10
-
-                ! Need to update extBoundary with flip applied
-                if(flip == 1) then
-
-                  do i = 1,this%interp%N+1
-                    i2 = this%interp%N+2-i
-                    extBuff(i) = this%extBoundary(i2,s1,e1,ivar,idir)
-                  enddo
-                  do i = 1,this%interp%N+1
-                    this%extBoundary(i,s1,e1,ivar,idir) = extBuff(i)
-                  enddo
-
-                endif
-              endif
-
-            endif
-
-          enddo
-        enddo
-      enddo
-    enddo
-
-  endsubroutine ApplyFlip_MappedVector2D_t
-
   subroutine SideExchange_MappedVector2D_t(this,mesh)
     implicit none
     class(MappedVector2D_t),intent(inout) :: this
@@ -287,12 +202,38 @@ contains
 
     if(mesh%decomp%mpiEnabled) then
       call mesh%decomp%FinalizeMPIExchangeAsync()
-      ! Apply side flips for data exchanged with MPI
-      call this%ApplyFlip(mesh)
+      ! Copy the data exchanged with MPI to extBoundary, with the side flips applied
+      call mesh%decomp%UnpackHalo2D(this%extBoundary,this%interp%N,2*this%nvar,this%nelem)
     endif
 
   endsubroutine SideExchange_MappedVector2D_t
 
+  subroutine ContravariantProjection_MappedVector2D_t(this,fc)
+    !! Projects the physical components of the vector onto the contravariant
+    !! basis vectors (scaled by the jacobian), once per quadrature point.
+    !! The result is stored in fc with the same layout as this % interior, so
+    !! that the divergence operators can apply the 1-D derivative sweeps
+    !! directly to the contravariant components.
+    implicit none
+    class(MappedVector2D_t),intent(in) :: this
+    real(prec),intent(out) :: fc(1:this%N+1,1:this%N+1,1:this%nelem,1:this%nvar,1:2)
+    ! Local
+    integer :: iEl,iVar,i,j,d
+    real(prec) :: Fx,Fy
+
+    do concurrent(i=1:this%N+1,j=1:this%N+1,iel=1:this%nElem,ivar=1:this%nVar)
+
+      Fx = this%interior(i,j,iEl,iVar,1)
+      Fy = this%interior(i,j,iEl,iVar,2)
+      do d = 1,2
+        fc(i,j,iEl,iVar,d) = this%geometry%dsdx%interior(i,j,iEl,1,1,d)*Fx+ &
+                             this%geometry%dsdx%interior(i,j,iEl,1,2,d)*Fy
+      enddo
+
+    enddo
+
+  endsubroutine ContravariantProjection_MappedVector2D_t
+
   subroutine MappedDivergence_MappedVector2D_t(this,df)
     ! Strong Form Operator
     !    !
@@ -301,38 +242,27 @@ contains
     real(prec),intent(out) :: df(1:this%N+1,1:this%N+1,1:this%nelem,1:this%nvar)
     ! Local
     integer :: iEl,iVar,i,j,ii
-    real(prec) :: dfLoc,Fx,Fy,Fc
-
-    do concurrent(i=1:this%N+1,j=1:this%N+1,iel=1:this%nElem,ivar=1:this%nVar)
+    real(prec) :: dfLoc
+    real(prec),allocatable :: fc(:,:,:,:,:)
 
-      dfLoc = 0.0_prec
-      do ii = 1,this%N+1
-        ! Convert from physical to computational space
-        Fx = this%interior(ii,j,iEl,iVar,1)
-        Fy = this%interior(ii,j,iEl,iVar,2)
-        Fc = this%geometry%dsdx%interior(ii,j,iEl,1,1,1)*Fx+ &
-             this%geometry%dsdx%interior(ii,j,iEl,1,2,1)*Fy
-        dfLoc = dfLoc+this%interp%dMatrix(ii,i)*Fc
-      enddo
-      dF(i,j,iel,ivar) = dfLoc
+    allocate(fc(1:this%N+1,1:this%N+1,1:this%nelem,1:this%nvar,1:2))
 
-    enddo
+    ! Convert from physical to computational space
+    call this%ContravariantProjection(fc)
 
     do concurrent(i=1:this%N+1,j=1:this%N+1,iel=1:this%nElem,ivar=1:this%nVar)
 
       dfLoc = 0.0_prec
       do ii = 1,this%N+1
-        ! Convert from physical to computational space
-        Fx = this%interior(i,ii,iEl,iVar,1)
-        Fy = this%interior(i,ii,iEl,iVar,2)
-        Fc = this%geometry%dsdx%interior(i,ii,iEl,1,1,2)*Fx+ &
-             this%geometry%dsdx%interior(i,ii,iEl,1,2,2)*Fy
-        dfLoc = dfLoc+this%interp%dMatrix(ii,j)*Fc
+        dfLoc = dfLoc+this%interp%dMatrix(ii,i)*fc(ii,j,iEl,iVar,1)+ &
+                this%interp%dMatrix(ii,j)*fc(i,ii,iEl,iVar,2)
       enddo
-      dF(i,j,iel,ivar) = (dF(i,j,iel,ivar)+dfLoc)/this%geometry%J%interior(i,j,iEl,1)
+      dF(i,j,iel,ivar) = dfLoc/this%geometry%J%interior(i,j,iEl,1)
 
     enddo
 
+    deallocate(fc)
+
   endsubroutine MappedDivergence_MappedVector2D_t
 
   subroutine MappedDGDivergence_MappedVector2D_t(this,df)
@@ -346,46 +276,93 @@ contains
     real(prec) :: df(1:this%N+1,1:this%N+1,1:this%nelem,1:this%nvar)
     ! Local
     integer :: iEl,iVar,i,j,ii
-    real(prec) :: dfLoc,Fx,Fy,Fc
+    real(prec) :: dfLoc
+    real(prec),allocatable :: fc(:,:,:,:,:)
+
+    allocate(fc(1:this%N+1,1:this%N+1,1:this%nelem,1:this%nvar,1:2))
+
+    ! Convert from physical to computational space
+    call this%ContravariantProjection(fc)
 
     do concurrent(i=1:this%N+1,j=1:this%N+1,iel=1:this%nElem,ivar=1:this%nVar)
 
       dfLoc = 0.0_prec
       do ii = 1,this%N+1
-        ! Convert from physical to computational space
-        Fx = this%interior(ii,j,iEl,iVar,1)
-        Fy = this%interior(ii,j,iEl,iVar,2)
-        Fc = this%geometry%dsdx%interior(ii,j,iEl,1,1,1)*Fx+ &
-             this%geometry%dsdx%interior(ii,j,iEl,1,2,1)*Fy
-        dfLoc = dfLoc+this%interp%dgMatrix(ii,i)*Fc
+        dfLoc = dfLoc+this%interp%dgMatrix(ii,i)*fc(ii,j,iEl,iVar,1)+ &
+                this%interp%dgMatrix(ii,j)*fc(i,ii,iEl,iVar,2)
       enddo
-      dF(i,j,iel,ivar) = dfLoc+ &
-                         (this%interp%bMatrix(i,2)*this%boundaryNormal(j,2,iel,ivar)+ &
-                          this%interp%bMatrix(i,1)*this%boundaryNormal(j,4,iel,ivar))/ &
-                         this%interp%qweights(i)
+      dfLoc = dfLoc+ &
+              (this%interp%bMatrix(i,2)*this%boundaryNormal(j,2,iel,ivar)+ &
+               this%interp%bMatrix(i,1)*this%boundaryNormal(j,4,iel,ivar))/ &
+              this%interp%qweights(i)+ &
+              (this%interp%bMatrix(j,2)*this%boundaryNormal(i,3,iel,ivar)+ &
+               this%interp%bMatrix(j,1)*this%boundaryNormal(i,1,iel,ivar))/ &
+              this%interp%qweights(j)
+
+      dF(i,j,iel,ivar) = dfLoc/this%geometry%J%interior(i,j,iEl,1)
 
     enddo
 
+    deallocate(fc)
+
+  endsubroutine MappedDGDivergence_MappedVector2D_t
+
+  subroutine MappedDGDivergenceVolume_MappedVector2D_t(this,df)
+    !! Computes the volume term of the weak form divergence, which only needs the
+    !! interior values of the vector. On output, df is not yet divided by the
+    !! Jacobian; MappedDGDivergenceSurface adds the boundary terms and completes it.
+    !! Together, the two are equivalent to MappedDGDivergence.
+    implicit none
+    class(MappedVector2D_t),intent(in) :: this
+    real(prec) :: df(1:this%N+1,1:this%N+1,1:this%nelem,1:this%nvar)
+    ! Local
+    integer :: iEl,iVar,i,j,ii
+    real(prec) :: dfLoc
+    real(prec),allocatable :: fc(:,:,:,:,:)
+
+    allocate(fc(1:this%N+1,1:this%N+1,1:this%nelem,1:this%nvar,1:2))
+
+    ! Convert from physical to computational space
+    call this%ContravariantProjection(fc)
+
     do concurrent(i=1:this%N+1,j=1:this%N+1,iel=1:this%nElem,ivar=1:this%nVar)
 
       dfLoc = 0.0_prec
       do ii = 1,this%N+1
-        ! Convert from physical to computational space
-        Fx = this%interior(i,ii,iEl,iVar,1)
-        Fy = this%interior(i,ii,iEl,iVar,2)
-        Fc = this%geometry%dsdx%interior(i,ii,iEl,1,1,2)*Fx+ &
-             this%geometry%dsdx%interior(i,ii,iEl,1,2,2)*Fy
-        dfLoc = dfLoc+this%interp%dgMatrix(ii,j)*Fc
+        dfLoc = dfLoc+this%interp%dgMatrix(ii,i)*fc(ii,j,iEl,iVar,1)+ &
+                this%interp%dgMatrix(ii,j)*fc(i,ii,iEl,iVar,2)
       enddo
-      dfLoc = dfLoc+ &
-              (this%interp%bMatrix(j,2)*this%boundaryNormal(i,3,iel,ivar)+ &
-               this%interp%bMatrix(j,1)*this%boundaryNormal(i,1,iel,ivar))/ &
-              this%interp%qweights(j)
+      dF(i,j,iel,ivar) = dfLoc
+
+    enddo
 
-      dF(i,j,iel,ivar) = (dF(i,j,iel,ivar)+dfLoc)/this%geometry%J%interior(i,j,iEl,1)
+    deallocate(fc)
+
+  endsubroutine MappedDGDivergenceVolume_MappedVector2D_t
+
+  subroutine MappedDGDivergenceSurface_MappedVector2D_t(this,df)
+    !! Adds the boundary terms of the weak form divergence to the volume term
+    !! computed by MappedDGDivergenceVolume and applies the Jacobian weighting.
+    !! The boundaryNormal attribute must be set on input.
+    implicit none
+    class(MappedVector2D_t),intent(in) :: this
+    real(prec) :: df(1:this%N+1,1:this%N+1,1:this%nelem,1:this%nvar)
+    ! Local
+    integer :: iEl,iVar,i,j
+
+    do concurrent(i=1:this%N+1,j=1:this%N+1,iel=1:this%nElem,ivar=1:this%nVar)
+
+      dF(i,j,iel,ivar) = (dF(i,j,iel,ivar)+ &
+                          (this%interp%bMatrix(i,2)*this%boundaryNormal(j,2,iel,ivar)+ &
+                           this%interp%bMatrix(i,1)*this%boundaryNormal(j,4,iel,ivar))/ &
+                          this%interp%qweights(i)+ &
+                          (this%interp%bMatrix(j,2)*this%boundaryNormal(i,3,iel,ivar)+ &
+                           this%interp%bMatrix(j,1)*this%boundaryNormal(i,1,iel,ivar))/ &
+                          this%interp%qweights(j))/ &
+                         this%geometry%J%interior(i,j,iEl,1)
 
     enddo
 
-  endsubroutine MappedDGDivergence_MappedVector2D_t
+  endsubroutine MappedDGDivergenceSurface_MappedVector2D_t
 
 endmodule SELF_MappedVector_2D_t
@@ -46,14 +46,21 @@ module SELF_MappedVector_3D_t
 
     procedure,public :: SideExchange => SideExchange_MappedVector3D_t
 
+    procedure,public :: ContravariantProjection => ContravariantProjection_MappedVector3D_t
+
     generic,public :: MappedDivergence => MappedDivergence_MappedVector3D_t
     procedure,private :: MappedDivergence_MappedVector3D_t
 
     generic,public :: MappedDGDivergence => MappedDGDivergence_MappedVector3D_t
     procedure,private :: MappedDGDivergence_MappedVector3D_t
 
+    generic,public :: MappedDGDivergenceVolume => MappedDGDivergenceVolume_MappedVector3D_t
+    procedure,private :: MappedDGDivergenceVolume_MappedVector3D_t
+
+    generic,public :: MappedDGDivergenceSurface => MappedDGDivergenceSurface_MappedVector3D_t
+    procedure,private :: MappedDGDivergenceSurface_MappedVector3D_t
+
     procedure,private :: MPIExchangeAsync => MPIExchangeAsync_MappedVector3D_t
-    procedure,private :: ApplyFlip => ApplyFlip_MappedVector3D_t
 
     procedure,public :: SetInteriorFromEquation => SetInteriorFromEquation_MappedVector3D_t
 
@@ -128,182 +135,17 @@ contains
   endsubroutine SetInteriorFromEquation_MappedVector3D_t
 
   subroutine MPIExchangeAsync_MappedVector3D_t(this,mesh)
+    !! Packs the boundary data of the sides shared with other ranks and posts one
+    !! message per neighbor rank.
     implicit none
     class(MappedVector3D_t),intent(inout) :: this
     type(Mesh3D),intent(inout) :: mesh
-    ! Local
-    integer :: e1,s1,e2,s2,ivar,idir
-    integer :: globalSideId,r2,tag
-    integer :: iError
-    integer :: msgCount
-
-    msgCount = 0
-
-    do idir = 1,3
-      do ivar = 1,this%nvar
-        do e1 = 1,this%nElem
-          do s1 = 1,6
-
-            e2 = mesh%sideInfo(3,s1,e1) ! Neighbor Element
-            if(e2 > 0) then
-              r2 = mesh%decomp%elemToRank(e2) ! Neighbor Rank
-
-              if(r2 /= mesh%decomp%rankId) then
-
-                s2 = mesh%sideInfo(4,s1,e1)/10
-                globalSideId = abs(mesh%sideInfo(2,s1,e1))
-                tag = globalsideid+mesh%nUniqueSides*(ivar-1+this%nvar*(idir-1))
-
-                msgCount = msgCount+1
-                call MPI_IRECV(this%extBoundary(:,:,s1,e1,ivar,idir), &
-                               (this%interp%N+1)*(this%interp%N+1), &
-                               mesh%decomp%mpiPrec, &
-                               r2,globalSideId, &
-                               mesh%decomp%mpiComm, &
-                               mesh%decomp%requests(msgCount),iError)
-
-                msgCount = msgCount+1
-                call MPI_ISEND(this%boundary(:,:,s1,e1,ivar,idir), &
-                               (this%interp%N+1)*(this%interp%N+1), &
-                               mesh%decomp%mpiPrec, &
-                               r2,globalSideId, &
-                               mesh%decomp%mpiComm, &
-                               mesh%decomp%requests(msgCount),iError)
-              endif
-            endif
-
-          enddo
-        enddo
-      enddo
-    enddo
 
-    mesh%decomp%msgCount = msgCount
+    call mesh%decomp%PackHalo3D(this%boundary,this%interp%N,3*this%nvar,this%nelem)
+    call mesh%decomp%HaloExchangeAsync((this%interp%N+1)*(this%interp%N+1)*3*this%nvar)
 
   endsubroutine MPIExchangeAsync_MappedVector3D_t
 
-  subroutine ApplyFlip_MappedVector3D_t(this,mesh)
-    ! Apply side flips to sides where MPI exchanges took place.
-    implicit none
-    class(MappedVector3D_t),intent(inout) :: this
-    type(Mesh3D),intent(inout) :: mesh
-    ! Local
-    integer :: e1,s1,e2,s2,idir
-    integer :: i,i2,j,j2
-    integer :: r2,flip,ivar
-    integer :: bcid
-    real(prec) :: extBuff(1:this%interp%N+1,1:this%interp%N+1)
-
-    do idir = 1,3
-      do ivar = 1,this%nvar
-        do e1 = 1,this%nElem
-          do s1 = 1,6
-
-            e2 = mesh%sideInfo(3,s1,e1) ! Neighbor Element
-            s2 = mesh%sideInfo(4,s1,e1)/10
-            bcid = mesh%sideInfo(5,s1,e1)
-            if(e2 > 0) then ! Interior Element
-              r2 = mesh%decomp%elemToRank(e2) ! Neighbor Rank
-
-              if(r2 /= mesh%decomp%rankId) then
-
-                flip = mesh%sideInfo(4,s1,e1)-s2*10
-
-                ! Need to update extBoundary with flip applied
-                if(flip == 0) then
-
-                  do j = 1,this%interp%N+1
-                    do i = 1,this%interp%N+1
-                      extBuff(i,j) = this%extBoundary(i,j,s1,e1,ivar,idir)
-                    enddo
-                  enddo
-
-                else if(flip == 1) then
-
-                  do j = 1,this%interp%N+1
-                    do i = 1,this%interp%N+1
-                      i2 = this%interp%N+2-i
-                      j2 = j
-                      extBuff(i,j) = this%extBoundary(i2,j2,s1,e1,ivar,idir)
-                    enddo
-                  enddo
-
-                else if(flip == 2) then
-
-                  do j = 1,this%interp%N+1
-                    do i = 1,this%interp%N+1
-                      i2 = this%interp%N+2-i
-                      j2 = this%interp%N+2-j
-                      extBuff(i,j) = this%extBoundary(i2,j2,s1,e1,ivar,idir)
-                    enddo
-                  enddo
-
-                else if(flip == 3) then
-
-                  do j = 1,this%interp%N+1
-                    do i = 1,this%interp%N+1
-                      i2 = i
-                      j2 = this%interp%N+2-j
-                      extBuff(i,j) = this%extBoundary(i2,j2,s1,e1,ivar,idir)
-                    enddo
-                  enddo
-
-                else if(flip == 4) then
-
-                  do j = 1,this%interp%N+1
-                    do i = 1,this%interp%N+1
-                      extBuff(i,j) = this%extBoundary(j,i,s1,e1,ivar,idir)
-                    enddo
-                  enddo
-
-                else if(flip == 5) then
-
-                  do j = 1,this%interp%N+1
-                    do i = 1,this%interp%N+1
-                      i2 = this%interp%N+2-j
-                      j2 = i
-                      extBuff(i,j) = this%extBoundary(i2,j2,s1,e1,ivar,idir)
-                    enddo
-                  enddo
-
-                else if(flip == 6) then
-
-                  do j = 1,this%interp%N+1
-                    do i = 1,this%interp%N+1
-                      i2 = this%interp%N+2-j
-                      j2 = this%interp%N+2-i
-                      extBuff(i,j) = this%extBoundary(i2,j2,s1,e1,ivar,idir)
-                    enddo
-                  enddo
-
-                else if(flip == 7) then
-
-                  do j = 1,this%interp%N+1
-                    do i = 1,this%interp%N+1
-                      i2 = j
-                      j2 = this%interp%N+2-i
-                      extBuff(i,j) = this%extBoundary(i2,j2,s1,e1,ivar,idir)
-                    enddo
-                  enddo
-
-                endif
-
-                do j = 1,this%interp%N+1
-                  do i = 1,this%interp%N+1
-                    this%extBoundary(i,j,s1,e1,ivar,idir) = extBuff(i,j)
-                  enddo
-                enddo
-
-              endif
-
-            endif
-
-          enddo
-        enddo
-      enddo
-    enddo
-
-  endsubroutine ApplyFlip_MappedVector3D_t
-
   subroutine SideExchange_MappedVector3D_t(this,mesh)
     implicit none
     class(MappedVector3D_t),intent(inout) :: this
@@ -428,76 +270,72 @@ contains
 
     if(mesh%decomp%mpiEnabled) then
       call mesh%decomp%FinalizeMPIExchangeAsync()
-      ! Apply side flips for data exchanged with MPI
-      call this%ApplyFlip(mesh)
+      ! Copy the data exchanged with MPI to extBoundary, with the side flips applied
+      call mesh%decomp%UnpackHalo3D(this%extBoundary,this%interp%N,3*this%nvar,this%nelem)
     endif
 
   endsubroutine SideExchange_MappedVector3D_t
 
-  subroutine MappedDivergence_MappedVector3D_t(this,df)
-    ! Strong Form Operator
-    !    !
+  subroutine ContravariantProjection_MappedVector3D_t(this,fc)
+    !! Projects the physical components of the vector onto the contravariant
+    !! basis vectors (scaled by the jacobian), once per quadrature point.
+    !! The result is stored in fc with the same layout as this % interior, so
+    !! that the divergence operators can apply the 1-D derivative sweeps
+    !! directly to the contravariant components.
     implicit none
     class(MappedVector3D_t),intent(in) :: this
-    real(prec),intent(out) :: df(1:this%N+1,1:this%N+1,1:this%N+1,1:this%nelem,1:this%nvar)
+    real(prec),intent(out) :: fc(1:this%N+1,1:this%N+1,1:this%N+1,1:this%nelem,1:this%nvar,1:3)
     ! Local
-    integer :: iEl,iVar,i,j,k,ii
-    real(prec) :: dfLoc,Fx,Fy,Fz,Fc
+    integer :: iEl,iVar,i,j,k,d
+    real(prec) :: Fx,Fy,Fz
 
     do concurrent(i=1:this%N+1,j=1:this%N+1, &
                   k=1:this%N+1,iel=1:this%nelem,ivar=1:this%nvar)
 
-      dfLoc = 0.0_prec
-      do ii = 1,this%N+1
-        ! Convert from physical to computational space
-        Fx = this%interior(ii,j,k,iEl,iVar,1)
-        Fy = this%interior(ii,j,k,iEl,iVar,2)
-        Fz = this%interior(ii,j,k,iEl,iVar,3)
-        Fc = this%geometry%dsdx%interior(ii,j,k,iEl,1,1,1)*Fx+ &
-             this%geometry%dsdx%interior(ii,j,k,iEl,1,2,1)*Fy+ &
-             this%geometry%dsdx%interior(ii,j,k,iEl,1,3,1)*Fz
-        dfLoc = dfLoc+this%interp%dMatrix(ii,i)*Fc
+      Fx = this%interior(i,j,k,iEl,iVar,1)
+      Fy = this%interior(i,j,k,iEl,iVar,2)
+      Fz = this%interior(i,j,k,iEl,iVar,3)
+      do d = 1,3
+        fc(i,j,k,iEl,iVar,d) = this%geometry%dsdx%interior(i,j,k,iEl,1,1,d)*Fx+ &
+                               this%geometry%dsdx%interior(i,j,k,iEl,1,2,d)*Fy+ &
+                               this%geometry%dsdx%interior(i,j,k,iEl,1,3,d)*Fz
       enddo
-      dF(i,j,k,iel,ivar) = dfLoc
 
     enddo
 
-    do concurrent(i=1:this%N+1,j=1:this%N+1, &
-                  k=1:this%N+1,iel=1:this%nelem,ivar=1:this%nvar)
+  endsubroutine ContravariantProjection_MappedVector3D_t
 
-      dfLoc = 0.0_prec
-      do ii = 1,this%N+1
-        ! Convert from physical to computational space
-        Fx = this%interior(i,ii,k,iEl,iVar,1)
-        Fy = this%interior(i,ii,k,iEl,iVar,2)
-        Fz = this%interior(i,ii,k,iEl,iVar,3)
-        Fc = this%geometry%dsdx%interior(i,ii,k,iEl,1,1,2)*Fx+ &
-             this%geometry%dsdx%interior(i,ii,k,iEl,1,2,2)*Fy+ &
-             this%geometry%dsdx%interior(i,ii,k,iEl,1,3,2)*Fz
-        dfLoc = dfLoc+this%interp%dMatrix(ii,j)*Fc
-      enddo
-      dF(i,j,k,iel,ivar) = (dF(i,j,k,iel,ivar)+dfLoc)
+  subroutine MappedDivergence_MappedVector3D_t(this,df)
+    ! Strong Form Operator
+    !    !
+    implicit none
+    class(MappedVector3D_t),intent(in) :: this
+    real(prec),intent(out) :: df(1:this%N+1,1:this%N+1,1:this%N+1,1:this%nelem,1:this%nvar)
+    ! Local
+    integer :: iEl,iVar,i,j,k,ii
+    real(prec) :: dfLoc
+    real(prec),allocatable :: fc(:,:,:,:,:,:)
 
-    enddo
+    allocate(fc(1:this%N+1,1:this%N+1,1:this%N+1,1:this%nelem,1:this%nvar,1:3))
+
+    ! Convert from physical to computational space
+    call this%ContravariantProjection(fc)
 
     do concurrent(i=1:this%N+1,j=1:this%N+1, &
                   k=1:this%N+1,iel=1:this%nelem,ivar=1:this%nvar)
 
       dfLoc = 0.0_prec
       do ii = 1,this%N+1
-        ! Convert from physical to computational space
-        Fx = this%interior(i,j,ii,iEl,iVar,1)
-        Fy = this%interior(i,j,ii,iEl,iVar,2)
-        Fz = this%interior(i,j,ii,iEl,iVar,3)
-        Fc = this%geometry%dsdx%interior(i,j,ii,iEl,1,1,3)*Fx+ &
-             this%geometry%dsdx%interior(i,j,ii,iEl,1,2,3)*Fy+ &
-             this%geometry%dsdx%interior(i,j,ii,iEl,1,3,3)*Fz
-        dfLoc = dfLoc+this%interp%dMatrix(ii,k)*Fc
+        dfLoc = dfLoc+this%interp%dMatrix(ii,i)*fc(ii,j,k,iEl,iVar,1)+ &
+                this%interp%dMatrix(ii,j)*fc(i,ii,k,iEl,iVar,2)+ &
+                this%interp%dMatrix(ii,k)*fc(i,j,ii,iEl,iVar,3)
       enddo
-      dF(i,j,k,iel,ivar) = (dF(i,j,k,iel,ivar)+dfLoc)/this%geometry%J%interior(i,j,k,iEl,1)
+      dF(i,j,k,iel,ivar) = dfLoc/this%geometry%J%interior(i,j,k,iEl,1)
 
     enddo
 
+    deallocate(fc)
+
   endsubroutine MappedDivergence_MappedVector3D_t
 
   subroutine MappedDGDivergence_MappedVector3D_t(this,df)
@@ -511,75 +349,104 @@ contains
     real(prec),intent(out) :: df(1:this%N+1,1:this%N+1,1:this%N+1,1:this%nelem,1:this%nvar)
     ! Local
     integer :: iEl,iVar,i,j,k,ii
-    real(prec) :: dfLoc,Fx,Fy,Fz,Fc
+    real(prec) :: dfLoc
+    real(prec),allocatable :: fc(:,:,:,:,:,:)
+
+    allocate(fc(1:this%N+1,1:this%N+1,1:this%N+1,1:this%nelem,1:this%nvar,1:3))
+
+    ! Convert from physical to computational space
+    call this%ContravariantProjection(fc)
 
     do concurrent(i=1:this%N+1,j=1:this%N+1, &
                   k=1:this%N+1,iel=1:this%nelem,ivar=1:this%nvar)
 
       dfLoc = 0.0_prec
       do ii = 1,this%N+1
-        ! Convert from physical to computational space
-        Fx = this%interior(ii,j,k,iEl,iVar,1)
-        Fy = this%interior(ii,j,k,iEl,iVar,2)
-        Fz = this%interior(ii,j,k,iEl,iVar,3)
-        Fc = this%geometry%dsdx%interior(ii,j,k,iEl,1,1,1)*Fx+ &
-             this%geometry%dsdx%interior(ii,j,k,iEl,1,2,1)*Fy+ &
-             this%geometry%dsdx%interior(ii,j,k,iEl,1,3,1)*Fz
-        dfLoc = dfLoc+this%interp%dgMatrix(ii,i)*Fc
+        dfLoc = dfLoc+this%interp%dgMatrix(ii,i)*fc(ii,j,k,iEl,iVar,1)+ &
+                this%interp%dgMatrix(ii,j)*fc(i,ii,k,iEl,iVar,2)+ &
+                this%interp%dgMatrix(ii,k)*fc(i,j,ii,iEl,iVar,3)
       enddo
       dfLoc = dfLoc+ &
               (this%interp%bMatrix(i,2)*this%boundaryNormal(j,k,3,iel,ivar)+ & ! east
                this%interp%bMatrix(i,1)*this%boundaryNormal(j,k,5,iel,ivar))/ & ! west
-              this%interp%qweights(i)
-      dF(i,j,k,iel,ivar) = dfLoc
+              this%interp%qweights(i)+ &
+              (this%interp%bMatrix(j,2)*this%boundaryNormal(i,k,4,iel,ivar)+ & ! north
+               this%interp%bMatrix(j,1)*this%boundaryNormal(i,k,2,iel,ivar))/ & ! south
+              this%interp%qweights(j)+ &
+              (this%interp%bMatrix(k,2)*this%boundaryNormal(i,j,6,iel,ivar)+ & ! top
+               this%interp%bMatrix(k,1)*this%boundaryNormal(i,j,1,iel,ivar))/ & ! bottom
+              this%interp%qweights(k)
+      dF(i,j,k,iel,ivar) = dfLoc/this%geometry%J%interior(i,j,k,iEl,1)
 
     enddo
 
+    deallocate(fc)
+
+  endsubroutine MappedDGDivergence_MappedVector3D_t
+
+  subroutine MappedDGDivergenceVolume_MappedVector3D_t(this,df)
+    !! Computes the volume term of the weak form divergence, which only needs the
+    !! interior values of the vector. On output, df is not yet divided by the
+    !! Jacobian; MappedDGDivergenceSurface adds the boundary terms and completes it.
+    !! Together, the two are equivalent to MappedDGDivergence.
+    implicit none
+    class(MappedVector3D_t),intent(in) :: this
+    real(prec),intent(out) :: df(1:this%N+1,1:this%N+1,1:this%N+1,1:this%nelem,1:this%nvar)
+    ! Local
+    integer :: iEl,iVar,i,j,k,ii
+    real(prec) :: dfLoc
+    real(prec),allocatable :: fc(:,:,:,:,:,:)
+
+    allocate(fc(1:this%N+1,1:this%N+1,1:this%N+1,1:this%nelem,1:this%nvar,1:3))
+
+    ! Convert from physical to computational space
+    call this%ContravariantProjection(fc)
+
     do concurrent(i=1:this%N+1,j=1:this%N+1, &
                   k=1:this%N+1,iel=1:this%nelem,ivar=1:this%nvar)
 
       dfLoc = 0.0_prec
       do ii = 1,this%N+1
-        ! Convert from physical to computational space
-        Fx = this%interior(i,ii,k,iEl,iVar,1)
-        Fy = this%interior(i,ii,k,iEl,iVar,2)
-        Fz = this%interior(i,ii,k,iEl,iVar,3)
-        Fc = this%geometry%dsdx%interior(i,ii,k,iEl,1,1,2)*Fx+ &
-             this%geometry%dsdx%interior(i,ii,k,iEl,1,2,2)*Fy+ &
-             this%geometry%dsdx%interior(i,ii,k,iEl,1,3,2)*Fz
-        dfLoc = dfLoc+this%interp%dgMatrix(ii,j)*Fc
+        dfLoc = dfLoc+this%interp%dgMatrix(ii,i)*fc(ii,j,k,iEl,iVar,1)+ &
+                this%interp%dgMatrix(ii,j)*fc(i,ii,k,iEl,iVar,2)+ &
+                this%interp%dgMatrix(ii,k)*fc(i,j,ii,iEl,iVar,3)
       enddo
-      dfLoc = +dfLoc+ &
-              (this%interp%bMatrix(j,2)*this%boundaryNormal(i,k,4,iel,ivar)+ & ! north
-               this%interp%bMatrix(j,1)*this%boundaryNormal(i,k,2,iel,ivar))/ & ! south
-              this%interp%qweights(j)
-      dF(i,j,k,iel,ivar) = (dF(i,j,k,iel,ivar)+dfLoc)
+      dF(i,j,k,iel,ivar) = dfLoc
 
     enddo
 
+    deallocate(fc)
+
+  endsubroutine MappedDGDivergenceVolume_MappedVector3D_t
+
+  subroutine MappedDGDivergenceSurface_MappedVector3D_t(this,df)
+    !! Adds the boundary terms of the weak form divergence to the volume term
+    !! computed by MappedDGDivergenceVolume and applies the Jacobian weighting.
+    !! The boundaryNormal attribute must be set on input.
+    implicit none
+    class(MappedVector3D_t),intent(in) :: this
+    real(prec),intent(inout) :: df(1:this%N+1,1:this%N+1,1:this%N+1,1:this%nelem,1:this%nvar)
+    ! Local
+    integer :: iEl,iVar,i,j,k
+
     do concurrent(i=1:this%N+1,j=1:this%N+1, &
                   k=1:this%N+1,iel=1:this%nelem,ivar=1:this%nvar)
 
-      dfLoc = 0.0_prec
-      do ii = 1,this%N+1
-        ! Convert from physical to computational space
-        Fx = this%interior(i,j,ii,iEl,iVar,1)
-        Fy = this%interior(i,j,ii,iEl,iVar,2)
-        Fz = this%interior(i,j,ii,iEl,iVar,3)
-        Fc = this%geometry%dsdx%interior(i,j,ii,iEl,1,1,3)*Fx+ &
-             this%geometry%dsdx%interior(i,j,ii,iEl,1,2,3)*Fy+ &
-             this%geometry%dsdx%interior(i,j,ii,iEl,1,3,3)*Fz
-        dfLoc = dfLoc+this%interp%dgMatrix(ii,k)*Fc
-      enddo
-      dfLoc = dfLoc+ &
-              (this%interp%bMatrix(k,2)*this%boundaryNormal(i,j,6,iel,ivar)+ & ! top
-               this%interp%bMatrix(k,1)*this%boundaryNormal(i,j,1,iel,ivar))/ & ! bottom
-              this%interp%qweights(k)
-      dF(i,j,k,iel,ivar) = (dF(i,j,k,iel,ivar)+dfLoc)/this%geometry%J%interior(i,j,k,iEl,1)
+      dF(i,j,k,iel,ivar) = (dF(i,j,k,iel,ivar)+ &
+                            (this%interp%bMatrix(i,2)*this%boundaryNormal(j,k,3,iel,ivar)+ & ! east
+                             this%interp%bMatrix(i,1)*this%boundaryNormal(j,k,5,iel,ivar))/ & ! west
+                            this%interp%qweights(i)+ &
+                            (this%interp%bMatrix(j,2)*this%boundaryNormal(i,k,4,iel,ivar)+ & ! north
+                             this%interp%bMatrix(j,1)*this%boundaryNormal(i,k,2,iel,ivar))/ & ! south
+                            this%interp%qweights(j)+ &
+                            (this%interp%bMatrix(k,2)*this%boundaryNormal(i,j,6,iel,ivar)+ & ! top
+                             this%interp%bMatrix(k,1)*this%boundaryNormal(i,j,1,iel,ivar))/ & ! bottom
+                            this%interp%qweights(k))/ &
+                           this%geometry%J%interior(i,j,k,iEl,1)
 
     enddo
 
-  endsubroutine MappedDGDivergence_MappedVector3D_t
+  endsubroutine MappedDGDivergenceSurface_MappedVector3D_t
 
   ! subroutine WriteTecplot_MappedVector3D_t(this,geometry,filename)
   !   implicit none
@@ -28,6 +28,8 @@ module SELF_Mesh
 
   use SELF_Constants
   use SELF_DomainDecomposition
+  use SELF_HDF5
+  use HDF5
   use iso_c_binding
 
   implicit none
@@ -89,4 +91,100 @@ module SELF_Mesh
   integer,parameter :: SELF_BC_PRESCRIBED_STRESS = 200
   integer,parameter :: SELF_BC_NOSTRESS = 201
 
+contains
+
+  subroutine ReadPartitioned_HOPr(fileId,decomp,nGlobalElem,nDim,elemInfo,nodeCoords,globalNodeIDs,sideInfo)
+    !! Reads the elements of a HOPr mesh file that the decomposition's partitioner
+    !! assigns to this rank. Every rank reads the full ElemInfo, NodeCoords and SideInfo
+    !! arrays so that all ranks compute the same partition from the element centroids
+    !! without communication.
+    !!
+    !! The elements are renumbered so that each rank owns a contiguous range of element
+    !! ids (see PartitionElements) and the neighbor element ids in sideInfo are given in
+    !! the new numbering. On output, the arrays hold the local elements in the same layout
+    !! as the contiguous reads in Read_HOPr; elemInfo keeps the mesh file offsets.
+    implicit none
+    integer(HID_T),intent(in) :: fileId
+    type(DomainDecomposition),intent(inout) :: decomp
+    integer,intent(in) :: nGlobalElem
+    integer,intent(in) :: nDim
+    !! The number of coordinates used for the element centroids
+    integer,allocatable,intent(out) :: elemInfo(:,:)
+    real(prec),allocatable,intent(out) :: nodeCoords(:,:)
+    integer,allocatable,intent(out) :: globalNodeIDs(:)
+    integer,allocatable,intent(out) :: sideInfo(:,:)
+    ! Local
+    integer(HID_T) :: offset(1:2),gOffset(1)
+    integer :: nGlobalNodes,nGlobalSides
+    integer :: nLocalElems,nLocalNodes,nLocalSides
+    integer :: iel,eid,iside,n,firstNode,lastNode,firstSide,lastSide
+    integer,allocatable :: allElemInfo(:,:),allSideInfo(:,:),allGlobalNodeIDs(:),newElemId(:)
+    real(prec),allocatable :: allNodeCoords(:,:),centroid(:,:)
+
+    allocate(allElemInfo(1:6,1:nGlobalElem))
+    offset(:) = 0
+    call ReadArray_HDF5(fileId,'ElemInfo',allElemInfo,offset)
+
+    nGlobalNodes = allElemInfo(6,nGlobalElem)
+    nGlobalSides = allElemInfo(4,nGlobalElem)
+    allocate(allNodeCoords(1:3,1:nGlobalNodes),allGlobalNodeIDs(1:nGlobalNodes), &
+             allSideInfo(1:5,1:nGlobalSides))
+    call ReadArray_HDF5(fileId,'NodeCoords',allNodeCoords,offset)
+    gOffset = 0
+    call ReadArray_HDF5(fileId,'GlobalNodeIDs',allGlobalNodeIDs,gOffset)
+    call ReadArray_HDF5(fileId,'SideInfo',allSideInfo,offset)
+
+    allocate(centroid(1:nDim,1:nGlobalElem),newElemId(1:nGlobalElem))
+    do eid = 1,nGlobalElem
+      firstNode = allElemInfo(5,eid)+1
+      lastNode = allElemInfo(6,eid)
+      centroid(1:nDim,eid) = sum(allNodeCoords(1:nDim,firstNode:lastNode),dim=2)/ &
+                             real(lastNode-firstNode+1,prec)
+    enddo
+
+    call decomp%PartitionElements(centroid,newElemId)
+
+    nLocalElems = size(decomp%localToGlobal)
+    nLocalNodes = 0
+    nLocalSides = 0
+    do iel = 1,nLocalElems
+      eid = decomp%localToGlobal(iel)
+      nLocalNodes = nLocalNodes+allElemInfo(6,eid)-allElemInfo(5,eid)
+      nLocalSides = nLocalSides+allElemInfo(4,eid)-allElemInfo(3,eid)
+    enddo
+
+    allocate(elemInfo(1:6,1:nLocalElems),nodeCoords(1:3,1:nLocalNodes), &
+             globalNodeIDs(1:nLocalNodes),sideInfo(1:5,1:nLocalSides))
+
+    nLocalNodes = 0
+    nLocalSides = 0
+    do iel = 1,nLocalElems
+      eid = decomp%localToGlobal(iel)
+      elemInfo(1:6,iel) = allElemInfo(1:6,eid)
+
+      firstNode = allElemInfo(5,eid)+1
+      lastNode = allElemInfo(6,eid)
+      n = lastNode-firstNode+1
+      nodeCoords(1:3,nLocalNodes+1:nLocalNodes+n) = allNodeCoords(1:3,firstNode:lastNode)
+      globalNodeIDs(nLocalNodes+1:nLocalNodes+n) = allGlobalNodeIDs(firstNode:lastNode)
+      nLocalNodes = nLocalNodes+n
+
+      firstSide = allElemInfo(3,eid)+1
+      lastSide = allElemInfo(4,eid)
+      n = lastSide-firstSide+1
+      sideInfo(1:5,nLocalSides+1:nLocalSides+n) = allSideInfo(1:5,firstSide:lastSide)
+      nLocalSides = nLocalSides+n
+    enddo
+
+    ! Neighbor element ids are given in the partitioned numbering
+    do iside = 1,nLocalSides
+      if(sideInfo(3,iside) > 0) then
+        sideInfo(3,iside) = newElemId(sideInfo(3,iside))
+      endif
+    enddo
+
+    deallocate(allElemInfo,allNodeCoords,allGlobalNodeIDs,allSideInfo,centroid,newElemId)
+
+  endsubroutine ReadPartitioned_HOPr
+
 endmodule SELF_Mesh
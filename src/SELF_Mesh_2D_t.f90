@@ -235,6 +235,10 @@ contains
   !! The mesh is created in tiles of size (tnx,tny). Tiling is used to determine
   !! the element ordering.
   !!
+  !! Each rank generates only the elements it owns; the node coordinates, neighbor
+  !! element ids, and global side ids are computed directly from the element and
+  !! tile indices, so that the memory and time needed here scale with the local
+  !! number of elements.
   !!
   !!  Input
   !!    - this : Fresh/empty mesh2d_t object
@@ -269,18 +273,13 @@ contains
     integer :: nX,nY,nGeo,nBCs
     integer :: nGlobalElem
     integer :: nUniqueSides
-    integer :: nUniqueNodes
     integer :: nLocalElems
     integer :: nLocalSides
     integer :: nLocalNodes
-    real(prec),allocatable :: nodeCoords(:,:,:,:)
-    integer,allocatable :: globalNodeIDs(:,:,:)
-    integer,allocatable :: sideInfo(:,:,:)
     integer :: i,j,ti,tj
-    integer :: ix,iy,iel
+    integer :: ix,iy,iel,lel
     integer :: ni,nj
     integer :: e1,e2
-    integer :: nedges
 
     call this%decomp%init()
 
@@ -291,149 +290,10 @@ contains
 
     nGlobalElem = nX*nY
     nUniqueSides = (nX+1)*nY+(nY+1)*nX
-    nUniqueNodes = (nX+1)*(nY+1)
-
-    allocate(nodeCoords(1:2,1:nGeo+1,1:nGeo+1,1:nGlobalElem))
-    allocate(globalNodeIDs(1:nGeo+1,1:nGeo+1,1:nGlobalElem))
-    allocate(sideInfo(1:5,1:4,1:nGlobalElem))
-
-    do tj = 1,nTileY
-      do ti = 1,nTileX
-        do j = 1,nyPerTile
-          iy = j+nyPerTile*(tj-1)
-          do i = 1,nxPerTile
-            iel = i+nxPerTile*(j-1+nyPerTile*(ti-1+nTilex*(tj-1)))
-            ix = i+nxPerTile*(ti-1) ! nxpertile + nxpertile*(nTileX-1) = nxperTile*nTilex = 1
-            do nj = 1,nGeo+1
-              do ni = 1,nGeo+1
-                nodeCoords(1,ni,nj,iel) = real(ni-1+ix-1,prec)*dx
-                nodeCoords(2,ni,nj,iel) = real(nj-1+iy-1,prec)*dy
-                globalNodeIDs(ni,nj,iel) = ni-1+i+(nxPerTile+1)*( &
-                                           nj-1+j-1+(nyPerTile+1)*( &
-                                           ti-1+nTileX*(tj-1)))
-              enddo
-            enddo
-          enddo
-        enddo
-      enddo
-    enddo
-
-    ! Fill in edge information
-    !  sideInfo(1:5,iSide,iEl)
-    !    1 - Side Type (currently unused in SELF)
-    !    2 - Global Side ID (Used for message passing. Don't need to change)
-    !    3 - Neighbor Element ID (Can stay the same)
-    !    4 - 10*( neighbor local side )  + flip (Need to recalculate flip)
-    !    5 - Boundary Condition ID (Can stay the same)
-    nedges = 0
-    do tj = 1,nTileY
-      do ti = 1,nTileX
-        do j = 1,nyPerTile
-          do i = 1,nxPerTile
-            iel = i+nxPerTile*(j-1+nyPerTile*(ti-1+nTilex*(tj-1)))
-
-            ! south, iside=1
-            ! Get the corner node ids for this edge
-            ! sideInfo(2,1,iel) = (nc1+nc2)*(nc1+nc2+1)/2 + nc2
-            if(j == 1) then ! southern most part of the tile
-              if(tj == 1) then ! southern most tile
-                nedges = nedges+1
-                sideinfo(2,1,iel) = nedges
-                sideinfo(3,1,iel) = 0 ! Neigbor element (null, boundary condition)
-                sideinfo(4,1,iel) = 0 ! Neighbor side id (null, boundary condition)
-                sideinfo(5,1,iel) = bcids(1) ! Boundary condition id; set from the user input
-              else ! interior tile, but souther most edge of the tile
-                e2 = i+nxPerTile*(nyPerTile-1+nyPerTile*(ti-1+nTilex*(tj-2))) ! Neigbor element, northernmost element, in tile to the south
-                sideinfo(2,1,iel) = sideInfo(2,3,e2) ! Copy the edge id from neighbor's north edge
-                sideinfo(3,1,iel) = e2
-                sideinfo(4,1,iel) = 10*3 ! Neighbor side id - neighbor to the south, north side (3)
-                sideinfo(5,1,iel) = 0 ! Boundary condition id; (null, interior edge)
-              endif
-            else ! interior to the tile
-              e2 = i+nxPerTile*(j-2+nyPerTile*(ti-1+nTilex*(tj-1))) ! Neigbor element, inside same tile, to the south
-              sideinfo(2,1,iel) = sideInfo(2,3,e2) ! Copy the edge id from neighbor's north edge
-              sideinfo(3,1,iel) = e2
-              sideinfo(4,1,iel) = 10*3 ! Neighbor side id - neighbor to the south, north side (3)
-              sideinfo(5,1,iel) = 0 ! Boundary condition id; (null, interior edge)
-            endif
-
-            ! east, iside=2
-            ! Get the corner node ids for this edge
-            ! East edges are always new edges, due to the way we are traversing the grid
-            nedges = nedges+1
-            sideinfo(2,2,iel) = nedges
-            if(i == nxPerTile) then ! eastern most part of the tile
-              if(ti == nTileX) then ! eastern most tile
-                sideinfo(3,2,iel) = 0 ! Neigbor element (null, boundary condition)
-                sideinfo(4,2,iel) = 0 ! Neighbor side id (null, boundary condition)
-                sideinfo(5,2,iel) = bcids(2) ! Boundary condition id; eastern boundary set from the user input
-              else ! interior tile, but eastern most edge of the tile
-                sideinfo(3,2,iel) = 1+nxPerTile*(j-1+nyPerTile*(ti+nTilex*(tj-1))) ! Neigbor element, westernnmost element, in tile to the east
-                sideinfo(4,2,iel) = 10*4 ! Neighbor side id - neighbor to the east, west side (4)
-                sideinfo(5,2,iel) = 0 ! Boundary condition id; (null, interior edge)
-              endif
-            else ! interior to the tile
-              sideinfo(3,2,iel) = i+1+nxPerTile*(j-1+nyPerTile*(ti-1+nTilex*(tj-1))) ! Neigbor element, inside same tile, to the east
-              sideinfo(4,2,iel) = 10*4 ! Neighbor side id - neighbor to the east, west side (4)
-              sideinfo(5,2,iel) = 0 ! Boundary condition id; (null, interior edge)
-            endif
-
-            ! north, iside=3
-            ! Get the corner node ids for this edge
-            ! East edges are always new edges, due to the way we are traversing the grid
-            nedges = nedges+1
-            sideinfo(2,3,iel) = nedges
-            if(j == nyPerTile) then ! northern most part of the tile
-              if(tj == nTileY) then ! northern most tile
-                sideinfo(3,3,iel) = 0 ! Neigbor element (null, boundary condition)
-                sideinfo(4,3,iel) = 0 ! Neighbor side id (null, boundary condition)
-                sideinfo(5,3,iel) = bcids(3) ! Boundary condition id; set from the user input
-              else ! interior tile, but northern most edge of the tile
-                sideinfo(3,3,iel) = i+nxPerTile*(nyPerTile*(ti-1+nTilex*(tj))) ! Neigbor element, southernmost element in tile to the north
-                sideinfo(4,3,iel) = 10*1 ! Neighbor side id - neighbor to the north, south side (1)
-                sideinfo(5,3,iel) = 0 ! Boundary condition id; (null, interior edge)
-              endif
-            else ! interior to the tile
-              sideinfo(3,3,iel) = i+nxPerTile*(j+nyPerTile*(ti-1+nTilex*(tj-1))) ! Neigbor element, inside same tile, to the north
-              sideinfo(4,3,iel) = 10*1 ! Neighbor side id - neighbor to the north, south side (1)
-              sideinfo(5,3,iel) = 0 ! Boundary condition id; (null, interior edge)
-            endif
-
-            ! west, iside=4
-            ! Get the corner node ids for this edge
-            ! n1 = globalNodeIds(this%CGNSCornerMap(1,1),this%CGNSCornerMap(2,1),iel)
-            ! n2 = globalNodeIds(this%CGNSCornerMap(1,4),this%CGNSCornerMap(2,4),iel)
-            ! nc1 = min(n1,n2)
-            ! nc2 = max(n1,n2)
-            ! sideInfo(2,1,iel) = (nc1+nc2)*(nc1+nc2+1)/2 + nc2
-            if(i == 1) then ! western most part of the tile
-              if(ti == 1) then ! western most tile
-                nedges = nedges+1
-                sideinfo(2,4,iel) = nedges
-                sideinfo(3,4,iel) = 0 ! Neigbor element (null, boundary condition)
-                sideinfo(4,4,iel) = 0 ! Neighbor side id (null, boundary condition)
-                sideinfo(5,4,iel) = bcids(4) ! Boundary condition id; eastern boundary set from the user input
-              else ! interior tile, but western most edge of the tile
-                e2 = nxPerTile+nxPerTile*(j-1+nyPerTile*(ti-2+nTilex*(tj-1))) ! Neigbor element, easternnmost element in tile to the west
-                sideinfo(3,4,iel) = sideInfo(2,2,e2) ! Copy the edge id from neighbor's east edge
-                sideinfo(3,4,iel) = e2
-                sideinfo(4,4,iel) = 10*2 ! Neighbor side id - neighbor to the west, east side (2)
-                sideinfo(5,4,iel) = 0 ! Boundary condition id; (null, interior edge)
-              endif
-            else ! interior to the tile
-              e2 = i-1+nxPerTile*(j-1+nyPerTile*(ti-1+nTilex*(tj-1))) ! Neigbor element, inside same tile, to the west
-              sideinfo(3,4,iel) = sideInfo(2,2,e2) ! Copy the edge id from neighbor's east edge
-              sideinfo(3,4,iel) = e2
-              sideinfo(4,4,iel) = 10*2 ! Neighbor side id - neighbor to the west, east side (2)
-              sideinfo(5,4,iel) = 0 ! Boundary condition id; (null, interior edge)
-            endif
-
-          enddo
-        enddo
-      enddo
-    enddo
 
-    call this%decomp%GenerateDecomposition(nGlobalElem,nUniqueSides)
+    ! Each rank exchanges at most the sides of its own elements
+    call this%decomp%GenerateDecomposition(nGlobalElem, &
+                                           4*((nGlobalElem+this%decomp%nRanks-1)/this%decomp%nRanks))
 
     e1 = this%decomp%offsetElem(this%decomp%rankId+1)+1
     e2 = this%decomp%offsetElem(this%decomp%rankId+2)
@@ -445,24 +305,130 @@ contains
     this%nUniqueSides = nUniqueSides
     this%quadrature = UNIFORM
 
-    this%nodeCoords(1:2,1:nGeo+1,1:nGeo+1,1:nLocalElems) = nodeCoords(1:2,1:nGeo+1,1:nGeo+1,e1:e2)
-    this%globalNodeIDs(1:nGeo+1,1:nGeo+1,1:nLocalElems) = globalNodeIDs(1:nGeo+1,1:nGeo+1,e1:e2)
-    this%sideInfo(1:5,1:4,1:nLocalElems) = sideInfo(1:5,1:4,e1:e2)
+    ! Fill in edge information
+    !  sideInfo(1:5,iSide,iEl)
+    !    1 - Side Type (currently unused in SELF)
+    !    2 - Global Side ID (Used for message passing. Don't need to change)
+    !    3 - Neighbor Element ID (Can stay the same)
+    !    4 - 10*( neighbor local side )  + flip (Need to recalculate flip)
+    !    5 - Boundary Condition ID (Can stay the same)
+    !
+    ! The global side ids number the x-normal edges (west and east sides) on the
+    ! (nX+1)*nY lattice first, followed by the y-normal edges (south and north sides)
+    ! on the nX*(nY+1) lattice.
+    this%sideInfo = 0
+    do lel = 1,nLocalElems
+      iel = e1+lel-1
+
+      ! Recover the element and tile indices from the global element id,
+      ! iel = i+nxPerTile*(j-1+nyPerTile*(ti-1+nTilex*(tj-1)))
+      i = mod(iel-1,nxPerTile)+1
+      j = mod((iel-1)/nxPerTile,nyPerTile)+1
+      ti = mod((iel-1)/(nxPerTile*nyPerTile),nTileX)+1
+      tj = (iel-1)/(nxPerTile*nyPerTile*nTileX)+1
+      ix = i+nxPerTile*(ti-1)
+      iy = j+nyPerTile*(tj-1)
+
+      do nj = 1,nGeo+1
+        do ni = 1,nGeo+1
+          this%nodeCoords(1,ni,nj,lel) = real(ni-1+ix-1,prec)*dx
+          this%nodeCoords(2,ni,nj,lel) = real(nj-1+iy-1,prec)*dy
+          this%globalNodeIDs(ni,nj,lel) = ni-1+i+(nxPerTile+1)*( &
+                                          nj-1+j-1+(nyPerTile+1)*( &
+                                          ti-1+nTileX*(tj-1)))
+        enddo
+      enddo
 
-    deallocate(nodeCoords)
-    deallocate(globalNodeIDs)
-    deallocate(sideInfo)
+      ! south, iside=1
+      this%sideInfo(2,1,lel) = (nX+1)*nY+ix+nX*(iy-1)
+      if(j == 1) then ! southern most part of the tile
+        if(tj == 1) then ! southern most tile
+          this%sideInfo(3,1,lel) = 0 ! Neigbor element (null, boundary condition)
+          this%sideInfo(4,1,lel) = 0 ! Neighbor side id (null, boundary condition)
+          this%sideInfo(5,1,lel) = bcids(1) ! Boundary condition id; set from the user input
+        else ! interior tile, but souther most edge of the tile
+          this%sideInfo(3,1,lel) = i+nxPerTile*(nyPerTile-1+nyPerTile*(ti-1+nTilex*(tj-2))) ! Neigbor element, northernmost element, in tile to the south
+          this%sideInfo(4,1,lel) = 10*3 ! Neighbor side id - neighbor to the south, north side (3)
+          this%sideInfo(5,1,lel) = 0 ! Boundary condition id; (null, interior edge)
+        endif
+      else ! interior to the tile
+        this%sideInfo(3,1,lel) = i+nxPerTile*(j-2+nyPerTile*(ti-1+nTilex*(tj-1))) ! Neigbor element, inside same tile, to the south
+        this%sideInfo(4,1,lel) = 10*3 ! Neighbor side id - neighbor to the south, north side (3)
+        this%sideInfo(5,1,lel) = 0 ! Boundary condition id; (null, interior edge)
+      endif
+
+      ! east, iside=2
+      this%sideInfo(2,2,lel) = ix+1+(nX+1)*(iy-1)
+      if(i == nxPerTile) then ! eastern most part of the tile
+        if(ti == nTileX) then ! eastern most tile
+          this%sideInfo(3,2,lel) = 0 ! Neigbor element (null, boundary condition)
+          this%sideInfo(4,2,lel) = 0 ! Neighbor side id (null, boundary condition)
+          this%sideInfo(5,2,lel) = bcids(2) ! Boundary condition id; eastern boundary set from the user input
+        else ! interior tile, but eastern most edge of the tile
+          this%sideInfo(3,2,lel) = 1+nxPerTile*(j-1+nyPerTile*(ti+nTilex*(tj-1))) ! Neigbor element, westernnmost element, in tile to the east
+          this%sideInfo(4,2,lel) = 10*4 ! Neighbor side id - neighbor to the east, west side (4)
+          this%sideInfo(5,2,lel) = 0 ! Boundary condition id; (null, interior edge)
+        endif
+      else ! interior to the tile
+        this%sideInfo(3,2,lel) = i+1+nxPerTile*(j-1+nyPerTile*(ti-1+nTilex*(tj-1))) ! Neigbor element, inside same tile, to the east
+        this%sideInfo(4,2,lel) = 10*4 ! Neighbor side id - neighbor to the east, west side (4)
+        this%sideInfo(5,2,lel) = 0 ! Boundary condition id; (null, interior edge)
+      endif
+
+      ! north, iside=3
+      this%sideInfo(2,3,lel) = (nX+1)*nY+ix+nX*iy
+      if(j == nyPerTile) then ! northern most part of the tile
+        if(tj == nTileY) then ! northern most tile
+          this%sideInfo(3,3,lel) = 0 ! Neigbor element (null, boundary condition)
+          this%sideInfo(4,3,lel) = 0 ! Neighbor side id (null, boundary condition)
+          this%sideInfo(5,3,lel) = bcids(3) ! Boundary condition id; set from the user input
+        else ! interior tile, but northern most edge of the tile
+          this%sideInfo(3,3,lel) = i+nxPerTile*(nyPerTile*(ti-1+nTilex*(tj))) ! Neigbor element, southernmost element in tile to the north
+          this%sideInfo(4,3,lel) = 10*1 ! Neighbor side id - neighbor to the north, south side (1)
+          this%sideInfo(5,3,lel) = 0 ! Boundary condition id; (null, interior edge)
+        endif
+      else ! interior to the tile
+        this%sideInfo(3,3,lel) = i+nxPerTile*(j+nyPerTile*(ti-1+nTilex*(tj-1))) ! Neigbor element, inside same tile, to the north
+        this%sideInfo(4,3,lel) = 10*1 ! Neighbor side id - neighbor to the north, south side (1)
+        this%sideInfo(5,3,lel) = 0 ! Boundary condition id; (null, interior edge)
+      endif
+
+      ! west, iside=4
+      this%sideInfo(2,4,lel) = ix+(nX+1)*(iy-1)
+      if(i == 1) then ! western most part of the tile
+        if(ti == 1) then ! western most tile
+          this%sideInfo(3,4,lel) = 0 ! Neigbor element (null, boundary condition)
+          this%sideInfo(4,4,lel) = 0 ! Neighbor side id (null, boundary condition)
+          this%sideInfo(5,4,lel) = bcids(4) ! Boundary condition id; eastern boundary set from the user input
+        else ! interior tile, but western most edge of the tile
+          this%sideInfo(3,4,lel) = nxPerTile+nxPerTile*(j-1+nyPerTile*(ti-2+nTilex*(tj-1))) ! Neigbor element, easternnmost element in tile to the west
+          this%sideInfo(4,4,lel) = 10*2 ! Neighbor side id - neighbor to the west, east side (2)
+          this%sideInfo(5,4,lel) = 0 ! Boundary condition id; (null, interior edge)
+        endif
+      else ! interior to the tile
+        this%sideInfo(3,4,lel) = i-1+nxPerTile*(j-1+nyPerTile*(ti-1+nTilex*(tj-1))) ! Neigbor element, inside same tile, to the west
+        this%sideInfo(4,4,lel) = 10*2 ! Neighbor side id - neighbor to the west, east side (2)
+        this%sideInfo(5,4,lel) = 0 ! Boundary condition id; (null, interior edge)
+      endif
+
+    enddo
 
+    call this%decomp%SetupHaloExchange(this%sideInfo)
     call this%UpdateDevice()
 
   endsubroutine UniformStructuredMesh_Mesh2D_t
 
-  subroutine Read_HOPr_Mesh2D_t(this,meshFile)
+  subroutine Read_HOPr_Mesh2D_t(this,meshFile,partitioner)
     ! From https://www.hopr-project.org/externals/Meshformat.pdf, Algorithm 6
     ! Adapted for 2D Mesh : Note that HOPR does not have 2D mesh output.
+    !
+    ! When a partitioner other than "contiguous" is given and MPI is enabled, the
+    ! elements are assigned to ranks from their centroids (see DomainDecomposition_t %
+    ! SetPartitioner) and renumbered so that each rank owns a contiguous range of ids.
     implicit none
     class(Mesh2D_t),intent(out) :: this
     character(*),intent(in) :: meshFile
+    character(*),intent(in),optional :: partitioner
     ! Local
     integer(HID_T) :: fileId
     integer(HID_T) :: offset(1:2),gOffset(1)
@@ -487,6 +453,7 @@ contains
     integer,dimension(:,:),allocatable :: bcType
 
     call this%decomp%init()
+    if(present(partitioner)) call this%decomp%SetPartitioner(partitioner)
 
     print*,__FILE__//' : Reading HOPr mesh from'//trim(meshfile)
     if(this%decomp%mpiEnabled) then
@@ -519,52 +486,64 @@ contains
     print*,__FILE__//' : Generating Domain Decomposition'
     call this%decomp%GenerateDecomposition(nGlobalElem,nUniqueSides3D)
 
-    firstElem = this%decomp%offsetElem(this%decomp%rankId+1)+1
-    nLocalElems = this%decomp%offsetElem(this%decomp%rankId+2)- &
-                  this%decomp%offsetElem(this%decomp%rankId+1)
-
-    print*,__FILE__//' : Rank ',this%decomp%rankId+1,' : element offset = ',firstElem
-    print*,__FILE__//' : Rank ',this%decomp%rankId+1,' : n_elements = ',nLocalElems
+    if(this%decomp%mpiEnabled .and. this%decomp%partitioner /= SELF_PARTITION_CONTIGUOUS) then
 
-    ! Allocate Space for hopr_elemInfo!
-    allocate(hopr_elemInfo(1:6,1:nLocalElems))
+      call ReadPartitioned_HOPr(fileId,this%decomp,nGlobalElem,2, &
+                                hopr_elemInfo,hopr_nodeCoords,hopr_globalNodeIDs,hopr_sideInfo)
+      nLocalElems = size(hopr_elemInfo,2)
+      nLocalNodes3D = size(hopr_nodeCoords,2)
+      nLocalSides3D = size(hopr_sideInfo,2)
 
-    if(this%decomp%mpiEnabled) then
-      offset = (/0,firstElem-1/)
-      call ReadArray_HDF5(fileId,'ElemInfo',hopr_elemInfo,offset)
-    else
-      call ReadArray_HDF5(fileId,'ElemInfo',hopr_elemInfo)
-    endif
-
-    ! Read local subarray of NodeCoords and GlobalNodeIDs
-    firstNode = hopr_elemInfo(5,1)+1
-    nLocalNodes3D = hopr_elemInfo(6,nLocalElems)-hopr_elemInfo(5,1)
-
-    ! Allocate Space for hopr_nodeCoords and hopr_globalNodeIDs !
-    allocate(hopr_nodeCoords(1:3,nLocalNodes3D),hopr_globalNodeIDs(1:nLocalNodes3D))
-
-    if(this%decomp%mpiEnabled) then
-      offset = (/0,firstNode-1/)
-      call ReadArray_HDF5(fileId,'NodeCoords',hopr_nodeCoords,offset)
-      gOffset = (/firstNode-1/)
-      call ReadArray_HDF5(fileId,'GlobalNodeIDs',hopr_globalNodeIDs,gOffset)
     else
-      call ReadArray_HDF5(fileId,'NodeCoords',hopr_nodeCoords)
-      call ReadArray_HDF5(fileId,'GlobalNodeIDs',hopr_globalNodeIDs)
-    endif
 
-    ! Read local subarray of SideInfo
-    firstSide = hopr_elemInfo(3,1)+1
-    nLocalSides3D = hopr_elemInfo(4,nLocalElems)-hopr_elemInfo(3,1)
+      firstElem = this%decomp%offsetElem(this%decomp%rankId+1)+1
+      nLocalElems = this%decomp%offsetElem(this%decomp%rankId+2)- &
+                    this%decomp%offsetElem(this%decomp%rankId+1)
+
+      print*,__FILE__//' : Rank ',this%decomp%rankId+1,' : element offset = ',firstElem
+      print*,__FILE__//' : Rank ',this%decomp%rankId+1,' : n_elements = ',nLocalElems
+
+      ! Allocate Space for hopr_elemInfo!
+      allocate(hopr_elemInfo(1:6,1:nLocalElems))
+
+      if(this%decomp%mpiEnabled) then
+        offset = (/0,firstElem-1/)
+        call ReadArray_HDF5(fileId,'ElemInfo',hopr_elemInfo,offset)
+      else
+        call ReadArray_HDF5(fileId,'ElemInfo',hopr_elemInfo)
+      endif
+
+      ! Read local subarray of NodeCoords and GlobalNodeIDs
+      firstNode = hopr_elemInfo(5,1)+1
+      nLocalNodes3D = hopr_elemInfo(6,nLocalElems)-hopr_elemInfo(5,1)
+
+      ! Allocate Space for hopr_nodeCoords and hopr_globalNodeIDs !
+      allocate(hopr_nodeCoords(1:3,nLocalNodes3D),hopr_globalNodeIDs(1:nLocalNodes3D))
+
+      if(this%decomp%mpiEnabled) then
+        offset = (/0,firstNode-1/)
+        call ReadArray_HDF5(fileId,'NodeCoords',hopr_nodeCoords,offset)
+        gOffset = (/firstNode-1/)
+        call ReadArray_HDF5(fileId,'GlobalNodeIDs',hopr_globalNodeIDs,gOffset)
+      else
+        call ReadArray_HDF5(fileId,'NodeCoords',hopr_nodeCoords)
+        call ReadArray_HDF5(fileId,'GlobalNodeIDs',hopr_globalNodeIDs)
+      endif
+
+      ! Read local subarray of SideInfo
+      firstSide = hopr_elemInfo(3,1)+1
+      nLocalSides3D = hopr_elemInfo(4,nLocalElems)-hopr_elemInfo(3,1)
+
+      ! Allocate space for hopr_sideInfo
+      allocate(hopr_sideInfo(1:5,1:nLocalSides3D))
+      if(this%decomp%mpiEnabled) then
+        offset = (/0,firstSide-1/)
+        print*,__FILE__//' : Rank ',this%decomp%rankId+1,' Reading side information'
+        call ReadArray_HDF5(fileId,'SideInfo',hopr_sideInfo,offset)
+      else
+        call ReadArray_HDF5(fileId,'SideInfo',hopr_sideInfo)
+      endif
 
-    ! Allocate space for hopr_sideInfo
-    allocate(hopr_sideInfo(1:5,1:nLocalSides3D))
-    if(this%decomp%mpiEnabled) then
-      offset = (/0,firstSide-1/)
-      print*,__FILE__//' : Rank ',this%decomp%rankId+1,' Reading side information'
-      call ReadArray_HDF5(fileId,'SideInfo',hopr_sideInfo,offset)
-    else
-      call ReadArray_HDF5(fileId,'SideInfo',hopr_sideInfo)
     endif
 
     call Close_HDF5(fileID)
@@ -623,6 +602,7 @@ contains
 
     deallocate(hopr_elemInfo,hopr_nodeCoords,hopr_globalNodeIDs,hopr_sideInfo)
 
+    call this%decomp%SetupHaloExchange(this%sideInfo)
     call this%UpdateDevice()
 
   endsubroutine Read_HOPr_Mesh2D_t
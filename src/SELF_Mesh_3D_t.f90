@@ -353,6 +353,10 @@ contains
   !! The mesh is created in tiles of size (tnx,tny,tnz). Tiling is used to determine
   !! the element ordering.
   !!
+  !! Each rank generates only the elements it owns; the node coordinates, neighbor
+  !! element ids, and global side ids are computed directly from the element and
+  !! tile indices, so that the memory and time needed here scale with the local
+  !! number of elements.
   !!
   !!  Input
   !!    - this : Fresh/empty mesh2d_t object
@@ -393,18 +397,14 @@ contains
     integer :: nX,nY,nZ,nGeo,nBCs
     integer :: nGlobalElem
     integer :: nUniqueSides
-    integer :: nUniqueNodes
     integer :: nLocalElems
     integer :: nLocalSides
     integer :: nLocalNodes
-    real(prec),allocatable :: nodeCoords(:,:,:,:,:)
-    integer,allocatable :: globalNodeIDs(:,:,:,:)
-    integer,allocatable :: sideInfo(:,:,:)
     integer :: i,j,k,ti,tj,tk
-    integer :: ix,iy,iz,iel
+    integer :: ix,iy,iz,iel,lel
     integer :: ni,nj,nk
     integer :: e1,e2,s1,s2
-    integer :: nfaces
+    integer :: nxFaces,nyFaces
 
     call this%decomp%init()
 
@@ -416,263 +416,12 @@ contains
 
     nGlobalElem = nX*nY*nZ
     nUniqueSides = (nX+1)*nY*nZ+(nY+1)*nX*nZ+(nZ+1)*nX*nY
-    nUniqueNodes = (nX+1)*(nY+1)*(nZ+1)
-
-    allocate(nodeCoords(1:3,1:nGeo+1,1:nGeo+1,1:nGeo+1,1:nGlobalElem))
-    allocate(globalNodeIDs(1:nGeo+1,1:nGeo+1,1:nGeo+1,1:nGlobalElem))
-    allocate(sideInfo(1:5,1:6,1:nGlobalElem))
-
-    do tk = 1,nTileZ
-      do tj = 1,nTileY
-        do ti = 1,nTileX
-          do k = 1,nzPerTile
-            iz = k+nzPerTile*(tk-1)
-            do j = 1,nyPerTile
-              iy = j+nyPerTile*(tj-1)
-              do i = 1,nxPerTile
-
-                iel = elementid(i,j,k,ti,tj,tk, &
-                                nxpertile,nypertile,nzpertile, &
-                                ntilex,ntiley,ntilez)
-                ix = i+nxPerTile*(ti-1)
-
-                do nk = 1,nGeo+1
-                  do nj = 1,nGeo+1
-                    do ni = 1,nGeo+1
-                      nodeCoords(1,ni,nj,nk,iel) = real(ni-1+ix-1,prec)*dx
-                      nodeCoords(2,ni,nj,nk,iel) = real(nj-1+iy-1,prec)*dy
-                      nodeCoords(3,ni,nj,nk,iel) = real(nk-1+iz-1,prec)*dz
-                      globalNodeIDs(ni,nj,nk,iel) = ni-1+i+(nxPerTile+1)*( &
-                                                    nj-1+j-1+(nyPerTile+1)*( &
-                                                    nk-1+k-1+(nzPerTile+1)*( &
-                                                    (ti-1+nTileX*( &
-                                                     tj-1+nTileY*(tk-1))))))
-                    enddo
-                  enddo
-                enddo
-
-              enddo
-            enddo
-          enddo
-        enddo
-      enddo
-    enddo
-
-    ! Fill in face information
-    !  sideInfo(1:5,iSide,iEl)
-    !    1 - Side Type (currently unused in SELF)
-    !    2 - Global Side ID (Used for message passing)
-    !    3 - Neighbor Element ID
-    !    4 - 10*( neighbor local side )  + flip
-    !    5 - Boundary Condition ID
-    nfaces = 0
-    do tk = 1,nTileZ
-      do tj = 1,nTileY
-        do ti = 1,nTileX
-          do k = 1,nzPerTile
-            do j = 1,nyPerTile
-              do i = 1,nxPerTile
-
-                iel = elementid(i,j,k,ti,tj,tk, &
-                                nxpertile,nypertile,nzpertile, &
-                                ntilex,ntiley,ntilez)
-                ! bottom, iside=1
-                s1 = 1
-                s2 = 6
-                if(k == 1) then ! bottom most part of the tile
-                  if(tk == 1) then ! bottom most tile
-                    nfaces = nfaces+1
-                    sideinfo(2,s1,iel) = nfaces
-                    sideinfo(3,s1,iel) = 0 ! Neigbor element (null, boundary condition)
-                    sideinfo(4,s1,iel) = 0 ! Neighbor side id (null, boundary condition)
-                    sideinfo(5,s1,iel) = bcids(s1) ! Boundary condition id; set from the user input
-                  else ! interior tile
-                    !neighbor element is the top most element in the tile beneath
-                    e2 = elementid(i,j,nzpertile,ti,tj,tk-1, &
-                                   nxpertile,nypertile,nzpertile, &
-                                   ntilex,ntiley,ntilez)
-
-                    sideinfo(2,s1,iel) = sideInfo(2,s2,e2) ! Copy the face id from neighbor
-                    sideinfo(3,s1,iel) = e2
-                    sideinfo(4,s1,iel) = 10*s2 ! Neighbor side id
-                    sideinfo(5,s1,iel) = 0 ! Boundary condition id; (null, interior face)
-                  endif
-                else ! interior to the tile
-                  !neighbor element is in the same tile, but beneath
-                  e2 = elementid(i,j,k-1,ti,tj,tk, &
-                                 nxpertile,nypertile,nzpertile, &
-                                 ntilex,ntiley,ntilez)
-
-                  sideinfo(2,s1,iel) = sideInfo(2,s2,e2) ! Copy the face id from neighbor
-                  sideinfo(3,s1,iel) = e2
-                  sideinfo(4,s1,iel) = 10*s2 ! Neighbor side id
-                  sideinfo(5,s1,iel) = 0 ! Boundary condition id; (null, interior face)
-                endif
-
-                ! south, iside=2
-                s1 = 2
-                s2 = 4 ! Neighbor side is north (4)
-                if(j == 1) then ! southern  most part of the tile
-                  if(tj == 1) then ! southern most tile
-                    nfaces = nfaces+1
-                    sideinfo(2,s1,iel) = nfaces
-                    sideinfo(3,s1,iel) = 0 ! Neigbor element (null, boundary condition)
-                    sideinfo(4,s1,iel) = 0 ! Neighbor side id (null, boundary condition)
-                    sideinfo(5,s1,iel) = bcids(s1) ! Boundary condition id; eastern boundary set from the user input
-                  else ! interior tile
-                    !neighbor element is northernmost element in the tile to the south
-                    e2 = elementid(i,nypertile,k,ti,tj-1,tk, &
-                                   nxpertile,nypertile,nzpertile, &
-                                   ntilex,ntiley,ntilez)
-
-                    sideinfo(2,s1,iel) = sideInfo(2,s2,e2) ! Copy the face id from neighbor
-                    sideinfo(3,s1,iel) = e2 ! Neigbor element
-                    sideinfo(4,s1,iel) = 10*s2 ! Neighbor side id
-                    sideinfo(5,s1,iel) = 0 ! Boundary condition id; (null, interior face)
-                  endif
-                else ! interior to the tile
-                  !neighbor element is in the same tile, to the south
-                  e2 = elementid(i,j-1,k,ti,tj,tk, &
-                                 nxpertile,nypertile,nzpertile, &
-                                 ntilex,ntiley,ntilez)
-
-                  sideinfo(2,s1,iel) = sideInfo(2,s2,e2) ! Copy the face id from neighbor
-                  sideinfo(3,s1,iel) = e2 ! Neigbor element
-                  sideinfo(4,s1,iel) = 10*s2 ! Neighbor side id
-                  sideinfo(5,s1,iel) = 0 ! Boundary condition id; (null, interior face)
-                endif
-
-                ! east, iside=3
-                s1 = 3
-                s2 = 5 ! neighbor side id is west (5)
-                ! East faces are always new faces, due to the way we are traversing the grid
-                nfaces = nfaces+1
-                sideinfo(2,s1,iel) = nfaces
-                if(i == nxPerTile) then ! eastern most part of the tile
-                  if(ti == nTileX) then ! eastern most tile
-                    sideinfo(3,s1,iel) = 0 ! Neigbor element (null, boundary condition)
-                    sideinfo(4,s1,iel) = 0 ! Neighbor side id (null, boundary condition)
-                    sideinfo(5,s1,iel) = bcids(s1) ! Boundary condition id;
-                  else ! interior tile
-                    !neighbor element is westernmost element in tile to the east
-                    e2 = elementid(1,j,k,ti+1,tj,tk, &
-                                   nxpertile,nypertile,nzpertile, &
-                                   ntilex,ntiley,ntilez)
-                    sideinfo(3,s1,iel) = e2 ! Neigbor element
-                    sideinfo(4,s1,iel) = 10*s2 ! Neighbor side id
-                    sideinfo(5,s1,iel) = 0 ! Boundary condition id; (null, interior face)
-                  endif
-                else ! interior to the tile
-                  !neighbor element is in the same tile, to the east
-                  e2 = elementid(i+1,j,k,ti,tj,tk, &
-                                 nxpertile,nypertile,nzpertile, &
-                                 ntilex,ntiley,ntilez)
-                  sideinfo(3,s1,iel) = e2 ! Neigbor element
-                  sideinfo(4,s1,iel) = 10*s2 ! Neighbor side id
-                  sideinfo(5,s1,iel) = 0 ! Boundary condition id; (null, interior face)
-                endif
-
-                ! north, iside=4
-                s1 = 4
-                s2 = 2 ! neighbor side is south (2)
-                ! North faces are always new faces, due to the way we are traversing the grid
-                nfaces = nfaces+1
-                sideinfo(2,s1,iel) = nfaces
-                if(j == nyPerTile) then ! northern most part of the tile
-                  if(tj == nTileY) then ! northern most tile
-                    sideinfo(3,s1,iel) = 0 ! Neigbor element (null, boundary condition)
-                    sideinfo(4,s1,iel) = 0 ! Neighbor side id (null, boundary condition)
-                    sideinfo(5,s1,iel) = bcids(s1) ! Boundary condition id; set from the user input
-                  else ! interior tile, but northern most face of the tile
-                    !neighbor element is the southernmost element in the tile to the north
-                    e2 = elementid(i,1,k,ti,tj+1,tk, &
-                                   nxpertile,nypertile,nzpertile, &
-                                   ntilex,ntiley,ntilez)
-                    sideinfo(3,s1,iel) = e2 ! Neigbor element
-                    sideinfo(4,s1,iel) = 10*s2 ! Neighbor side id
-                    sideinfo(5,s1,iel) = 0 ! Boundary condition id; (null, interior face)
-                  endif
-                else ! interior to the tile
-                  !neighbor element is the tile to the north
-                  e2 = elementid(i,j+1,k,ti,tj,tk, &
-                                 nxpertile,nypertile,nzpertile, &
-                                 ntilex,ntiley,ntilez)
-                  sideinfo(3,s1,iel) = e2 ! Neigbor element
-                  sideinfo(4,s1,iel) = 10*s2 ! Neighbor side id
-                  sideinfo(5,s1,iel) = 0 ! Boundary condition id; (null, interior face)
-                endif
-
-                ! west, iside=5
-                s1 = 5
-                s2 = 3 ! neighbor side id is east (3)
-                if(i == 1) then ! western most part of the tile
-                  if(ti == 1) then ! western most tile
-                    nfaces = nfaces+1
-                    sideinfo(2,s1,iel) = nfaces
-                    sideinfo(3,s1,iel) = 0 ! Neigbor element (null, boundary condition)
-                    sideinfo(4,s1,iel) = 0 ! Neighbor side id (null, boundary condition)
-                    sideinfo(5,s1,iel) = bcids(s1) ! Boundary condition id
-                  else ! interior tile, but western most face of the tile
-                    !neighbor element is the easternmost element in the tile to the west
-                    e2 = elementid(nxperTile,j,k,ti-1,tj,tk, &
-                                   nxpertile,nypertile,nzpertile, &
-                                   ntilex,ntiley,ntilez)
-
-                    sideinfo(2,s1,iel) = sideInfo(2,s2,e2) ! Copy the face id from neighbor's east face
-                    sideinfo(3,s1,iel) = e2
-                    sideinfo(4,s1,iel) = 10*s2 ! Neighbor side id - neighbor to the west, east side (2)
-                    sideinfo(5,s1,iel) = 0 ! Boundary condition id; (null, interior face)
-                  endif
-                else ! interior to the tile
-                  !neighbor element is the element to the west in the same tile
-                  e2 = elementid(i-1,j,k,ti,tj,tk, &
-                                 nxpertile,nypertile,nzpertile, &
-                                 ntilex,ntiley,ntilez)
-
-                  sideinfo(2,s1,iel) = sideInfo(2,s2,e2) ! Copy the face id from neighbor's east face
-                  sideinfo(3,s1,iel) = e2
-                  sideinfo(4,s1,iel) = 10*s2 ! Neighbor side id - neighbor to the west, east side (2)
-                  sideinfo(5,s1,iel) = 0 ! Boundary condition id; (null, interior face)
-                endif
-
-                ! top, iside=6
-                s1 = 6
-                s2 = 1 ! neighbor side is bottom (1)
-                ! Top faces are always new faces, due to the way we are traversing the grid
-                nfaces = nfaces+1
-                sideinfo(2,s1,iel) = nfaces
-                if(k == nzPerTile) then ! top most part of the tile
-                  if(tk == nTileZ) then ! top most tile
-                    sideinfo(3,s1,iel) = 0 ! Neigbor element (null, boundary condition)
-                    sideinfo(4,s1,iel) = 0 ! Neighbor side id (null, boundary condition)
-                    sideinfo(5,s1,iel) = bcids(s1) ! Boundary condition id; set from the user input
-                  else ! interior tile, but top most face of the tile
-                    !neighbor element is the bottom-most element in the tile above
-                    e2 = elementid(i,j,1,ti,tj,tk+1, &
-                                   nxpertile,nypertile,nzpertile, &
-                                   ntilex,ntiley,ntilez)
-                    sideinfo(3,s1,iel) = e2 ! Neigbor element
-                    sideinfo(4,s1,iel) = 10*s2 ! Neighbor side id
-                    sideinfo(5,s1,iel) = 0 ! Boundary condition id; (null, interior face)
-                  endif
-                else ! interior to the tile
-                  !neighbor element is the tile above
-                  e2 = elementid(i,j,k+1,ti,tj,tk, &
-                                 nxpertile,nypertile,nzpertile, &
-                                 ntilex,ntiley,ntilez)
-                  sideinfo(3,s1,iel) = e2 ! Neigbor element, inside same tile, to the north
-                  sideinfo(4,s1,iel) = 10*s2 ! Neighbor side id - neighbor to the north, south side (1)
-                  sideinfo(5,s1,iel) = 0 ! Boundary condition id; (null, interior face)
-                endif
-
-              enddo
-            enddo
-          enddo
-        enddo
-      enddo
-    enddo
+    nxFaces = (nX+1)*nY*nZ
+    nyFaces = nX*(nY+1)*nZ
 
-    call this%decomp%GenerateDecomposition(nGlobalElem,nUniqueSides)
+    ! Each rank exchanges at most the sides of its own elements
+    call this%decomp%GenerateDecomposition(nGlobalElem, &
+                                           6*((nGlobalElem+this%decomp%nRanks-1)/this%decomp%nRanks))
 
     e1 = this%decomp%offsetElem(this%decomp%rankId+1)+1
     e2 = this%decomp%offsetElem(this%decomp%rankId+2)
@@ -684,23 +433,221 @@ contains
     this%nUniqueSides = nUniqueSides
     this%quadrature = UNIFORM
 
-    this%nodeCoords(1:3,1:nGeo+1,1:nGeo+1,1:nGeo+1,1:nLocalElems) = nodeCoords(1:3,1:nGeo+1,1:nGeo+1,1:nGeo+1,e1:e2)
-    this%globalNodeIDs(1:nGeo+1,1:nGeo+1,1:nGeo+1,1:nLocalElems) = globalNodeIDs(1:nGeo+1,1:nGeo+1,1:nGeo+1,e1:e2)
-    this%sideInfo(1:5,1:6,1:nLocalElems) = sideInfo(1:5,1:6,e1:e2)
+    ! Fill in face information
+    !  sideInfo(1:5,iSide,iEl)
+    !    1 - Side Type (currently unused in SELF)
+    !    2 - Global Side ID (Used for message passing)
+    !    3 - Neighbor Element ID
+    !    4 - 10*( neighbor local side )  + flip
+    !    5 - Boundary Condition ID
+    !
+    ! The global side ids number the x-normal faces (west and east sides) on the
+    ! (nX+1)*nY*nZ lattice first, followed by the y-normal faces (south and north sides)
+    ! on the nX*(nY+1)*nZ lattice, and the z-normal faces (bottom and top sides)
+    ! on the nX*nY*(nZ+1) lattice.
+    this%sideInfo = 0
+    do lel = 1,nLocalElems
+      iel = e1+lel-1
+
+      ! Recover the element and tile indices from the global element id (see elementid)
+      i = mod(iel-1,nxPerTile)+1
+      j = mod((iel-1)/nxPerTile,nyPerTile)+1
+      k = mod((iel-1)/(nxPerTile*nyPerTile),nzPerTile)+1
+      ti = mod((iel-1)/(nxPerTile*nyPerTile*nzPerTile),nTileX)+1
+      tj = mod((iel-1)/(nxPerTile*nyPerTile*nzPerTile*nTileX),nTileY)+1
+      tk = (iel-1)/(nxPerTile*nyPerTile*nzPerTile*nTileX*nTileY)+1
+      ix = i+nxPerTile*(ti-1)
+      iy = j+nyPerTile*(tj-1)
+      iz = k+nzPerTile*(tk-1)
+
+      do nk = 1,nGeo+1
+        do nj = 1,nGeo+1
+          do ni = 1,nGeo+1
+            this%nodeCoords(1,ni,nj,nk,lel) = real(ni-1+ix-1,prec)*dx
+            this%nodeCoords(2,ni,nj,nk,lel) = real(nj-1+iy-1,prec)*dy
+            this%nodeCoords(3,ni,nj,nk,lel) = real(nk-1+iz-1,prec)*dz
+            this%globalNodeIDs(ni,nj,nk,lel) = ni-1+i+(nxPerTile+1)*( &
+                                               nj-1+j-1+(nyPerTile+1)*( &
+                                               nk-1+k-1+(nzPerTile+1)*( &
+                                               (ti-1+nTileX*( &
+                                                tj-1+nTileY*(tk-1))))))
+          enddo
+        enddo
+      enddo
+
+      ! bottom, iside=1
+      s1 = 1
+      s2 = 6
+      this%sideInfo(2,s1,lel) = nxFaces+nyFaces+ix+nX*(iy-1+nY*(iz-1))
+      if(k == 1) then ! bottom most part of the tile
+        if(tk == 1) then ! bottom most tile
+          this%sideInfo(3,s1,lel) = 0 ! Neigbor element (null, boundary condition)
+          this%sideInfo(4,s1,lel) = 0 ! Neighbor side id (null, boundary condition)
+          this%sideInfo(5,s1,lel) = bcids(s1) ! Boundary condition id; set from the user input
+        else ! interior tile
+          !neighbor element is the top most element in the tile beneath
+          this%sideInfo(3,s1,lel) = elementid(i,j,nzpertile,ti,tj,tk-1, &
+                                              nxpertile,nypertile,nzpertile, &
+                                              ntilex,ntiley,ntilez)
+          this%sideInfo(4,s1,lel) = 10*s2 ! Neighbor side id
+          this%sideInfo(5,s1,lel) = 0 ! Boundary condition id; (null, interior face)
+        endif
+      else ! interior to the tile
+        !neighbor element is in the same tile, but beneath
+        this%sideInfo(3,s1,lel) = elementid(i,j,k-1,ti,tj,tk, &
+                                            nxpertile,nypertile,nzpertile, &
+                                            ntilex,ntiley,ntilez)
+        this%sideInfo(4,s1,lel) = 10*s2 ! Neighbor side id
+        this%sideInfo(5,s1,lel) = 0 ! Boundary condition id; (null, interior face)
+      endif
+
+      ! south, iside=2
+      s1 = 2
+      s2 = 4 ! Neighbor side is north (4)
+      this%sideInfo(2,s1,lel) = nxFaces+ix+nX*(iy-1+(nY+1)*(iz-1))
+      if(j == 1) then ! southern  most part of the tile
+        if(tj == 1) then ! southern most tile
+          this%sideInfo(3,s1,lel) = 0 ! Neigbor element (null, boundary condition)
+          this%sideInfo(4,s1,lel) = 0 ! Neighbor side id (null, boundary condition)
+          this%sideInfo(5,s1,lel) = bcids(s1) ! Boundary condition id; eastern boundary set from the user input
+        else ! interior tile
+          !neighbor element is northernmost element in the tile to the south
+          this%sideInfo(3,s1,lel) = elementid(i,nypertile,k,ti,tj-1,tk, &
+                                              nxpertile,nypertile,nzpertile, &
+                                              ntilex,ntiley,ntilez)
+          this%sideInfo(4,s1,lel) = 10*s2 ! Neighbor side id
+          this%sideInfo(5,s1,lel) = 0 ! Boundary condition id; (null, interior face)
+        endif
+      else ! interior to the tile
+        !neighbor element is in the same tile, to the south
+        this%sideInfo(3,s1,lel) = elementid(i,j-1,k,ti,tj,tk, &
+                                            nxpertile,nypertile,nzpertile, &
+                                            ntilex,ntiley,ntilez)
+        this%sideInfo(4,s1,lel) = 10*s2 ! Neighbor side id
+        this%sideInfo(5,s1,lel) = 0 ! Boundary condition id; (null, interior face)
+      endif
+
+      ! east, iside=3
+      s1 = 3
+      s2 = 5 ! neighbor side id is west (5)
+      this%sideInfo(2,s1,lel) = ix+1+(nX+1)*(iy-1+nY*(iz-1))
+      if(i == nxPerTile) then ! eastern most part of the tile
+        if(ti == nTileX) then ! eastern most tile
+          this%sideInfo(3,s1,lel) = 0 ! Neigbor element (null, boundary condition)
+          this%sideInfo(4,s1,lel) = 0 ! Neighbor side id (null, boundary condition)
+          this%sideInfo(5,s1,lel) = bcids(s1) ! Boundary condition id;
+        else ! interior tile
+          !neighbor element is westernmost element in tile to the east
+          this%sideInfo(3,s1,lel) = elementid(1,j,k,ti+1,tj,tk, &
+                                              nxpertile,nypertile,nzpertile, &
+                                              ntilex,ntiley,ntilez)
+          this%sideInfo(4,s1,lel) = 10*s2 ! Neighbor side id
+          this%sideInfo(5,s1,lel) = 0 ! Boundary condition id; (null, interior face)
+        endif
+      else ! interior to the tile
+        !neighbor element is in the same tile, to the east
+        this%sideInfo(3,s1,lel) = elementid(i+1,j,k,ti,tj,tk, &
+                                            nxpertile,nypertile,nzpertile, &
+                                            ntilex,ntiley,ntilez)
+        this%sideInfo(4,s1,lel) = 10*s2 ! Neighbor side id
+        this%sideInfo(5,s1,lel) = 0 ! Boundary condition id; (null, interior face)
+      endif
+
+      ! north, iside=4
+      s1 = 4
+      s2 = 2 ! neighbor side is south (2)
+      this%sideInfo(2,s1,lel) = nxFaces+ix+nX*(iy+(nY+1)*(iz-1))
+      if(j == nyPerTile) then ! northern most part of the tile
+        if(tj == nTileY) then ! northern most tile
+          this%sideInfo(3,s1,lel) = 0 ! Neigbor element (null, boundary condition)
+          this%sideInfo(4,s1,lel) = 0 ! Neighbor side id (null, boundary condition)
+          this%sideInfo(5,s1,lel) = bcids(s1) ! Boundary condition id; set from the user input
+        else ! interior tile, but northern most face of the tile
+          !neighbor element is the southernmost element in the tile to the north
+          this%sideInfo(3,s1,lel) = elementid(i,1,k,ti,tj+1,tk, &
+                                              nxpertile,nypertile,nzpertile, &
+                                              ntilex,ntiley,ntilez)
+          this%sideInfo(4,s1,lel) = 10*s2 ! Neighbor side id
+          this%sideInfo(5,s1,lel) = 0 ! Boundary condition id; (null, interior face)
+        endif
+      else ! interior to the tile
+        !neighbor element is the tile to the north
+        this%sideInfo(3,s1,lel) = elementid(i,j+1,k,ti,tj,tk, &
+                                            nxpertile,nypertile,nzpertile, &
+                                            ntilex,ntiley,ntilez)
+        this%sideInfo(4,s1,lel) = 10*s2 ! Neighbor side id
+        this%sideInfo(5,s1,lel) = 0 ! Boundary condition id; (null, interior face)
+      endif
+
+      ! west, iside=5
+      s1 = 5
+      s2 = 3 ! neighbor side id is east (3)
+      this%sideInfo(2,s1,lel) = ix+(nX+1)*(iy-1+nY*(iz-1))
+      if(i == 1) then ! western most part of the tile
+        if(ti == 1) then ! western most tile
+          this%sideInfo(3,s1,lel) = 0 ! Neigbor element (null, boundary condition)
+          this%sideInfo(4,s1,lel) = 0 ! Neighbor side id (null, boundary condition)
+          this%sideInfo(5,s1,lel) = bcids(s1) ! Boundary condition id
+        else ! interior tile, but western most face of the tile
+          !neighbor element is the easternmost element in the tile to the west
+          this%sideInfo(3,s1,lel) = elementid(nxperTile,j,k,ti-1,tj,tk, &
+                                              nxpertile,nypertile,nzpertile, &
+                                              ntilex,ntiley,ntilez)
+          this%sideInfo(4,s1,lel) = 10*s2 ! Neighbor side id - neighbor to the west, east side (2)
+          this%sideInfo(5,s1,lel) = 0 ! Boundary condition id; (null, interior face)
+        endif
+      else ! interior to the tile
+        !neighbor element is the element to the west in the same tile
+        this%sideInfo(3,s1,lel) = elementid(i-1,j,k,ti,tj,tk, &
+                                            nxpertile,nypertile,nzpertile, &
+                                            ntilex,ntiley,ntilez)
+        this%sideInfo(4,s1,lel) = 10*s2 ! Neighbor side id - neighbor to the west, east side (2)
+        this%sideInfo(5,s1,lel) = 0 ! Boundary condition id; (null, interior face)
+      endif
+
+      ! top, iside=6
+      s1 = 6
+      s2 = 1 ! neighbor side is bottom (1)
+      this%sideInfo(2,s1,lel) = nxFaces+nyFaces+ix+nX*(iy-1+nY*iz)
+      if(k == nzPerTile) then ! top most part of the tile
+        if(tk == nTileZ) then ! top most tile
+          this%sideInfo(3,s1,lel) = 0 ! Neigbor element (null, boundary condition)
+          this%sideInfo(4,s1,lel) = 0 ! Neighbor side id (null, boundary condition)
+          this%sideInfo(5,s1,lel) = bcids(s1) ! Boundary condition id; set from the user input
+        else ! interior tile, but top most face of the tile
+          !neighbor element is the bottom-most element in the tile above
+          this%sideInfo(3,s1,lel) = elementid(i,j,1,ti,tj,tk+1, &
+                                              nxpertile,nypertile,nzpertile, &
+                                              ntilex,ntiley,ntilez)
+          this%sideInfo(4,s1,lel) = 10*s2 ! Neighbor side id
+          this%sideInfo(5,s1,lel) = 0 ! Boundary condition id; (null, interior face)
+        endif
+      else ! interior to the tile
+        !neighbor element is the tile above
+        this%sideInfo(3,s1,lel) = elementid(i,j,k+1,ti,tj,tk, &
+                                            nxpertile,nypertile,nzpertile, &
+                                            ntilex,ntiley,ntilez)
+        this%sideInfo(4,s1,lel) = 10*s2 ! Neighbor side id - neighbor to the north, south side (1)
+        this%sideInfo(5,s1,lel) = 0 ! Boundary condition id; (null, interior face)
+      endif
 
-    deallocate(nodeCoords)
-    deallocate(globalNodeIDs)
-    deallocate(sideInfo)
+    enddo
 
+    call this%decomp%SetupHaloExchange(this%sideInfo)
     call this%UpdateDevice()
 
   endsubroutine UniformStructuredMesh_Mesh3D_t
 
-  subroutine Read_HOPr_Mesh3D_t(this,meshFile)
+  subroutine Read_HOPr_Mesh3D_t(this,meshFile,partitioner)
     ! From https://www.hopr-project.org/externals/Meshformat.pdf, Algorithm 6
+    !
+    ! When a partitioner other than "contiguous" is given and MPI is enabled, the
+    ! elements are assigned to ranks from their centroids (see DomainDecomposition_t %
+    ! SetPartitioner) and renumbered so that each rank owns a contiguous range of ids.
     implicit none
     class(Mesh3D_t),intent(out) :: this
     character(*),intent(in) :: meshFile
+    character(*),intent(in),optional :: partitioner
     ! Local
     integer(HID_T) :: fileId
     integer(HID_T) :: offset(1:2),gOffset(1)
@@ -722,6 +669,7 @@ contains
     integer,dimension(:,:),allocatable :: bcType
 
     call this%decomp%init()
+    if(present(partitioner)) call this%decomp%SetPartitioner(partitioner)
 
     if(this%decomp%mpiEnabled) then
       call Open_HDF5(meshFile,H5F_ACC_RDONLY_F,fileId,this%decomp%mpiComm)
@@ -746,48 +694,60 @@ contains
     ! Read local subarray of ElemInfo
     call this%decomp%GenerateDecomposition(nGlobalElem,nUniqueSides)
 
-    firstElem = this%decomp%offsetElem(this%decomp%rankId+1)+1
-    nLocalElems = this%decomp%offsetElem(this%decomp%rankId+2)- &
-                  this%decomp%offsetElem(this%decomp%rankId+1)
+    if(this%decomp%mpiEnabled .and. this%decomp%partitioner /= SELF_PARTITION_CONTIGUOUS) then
 
-    ! Allocate Space for hopr_elemInfo!
-    allocate(hopr_elemInfo(1:6,1:nLocalElems))
-    if(this%decomp%mpiEnabled) then
-      offset = (/0,firstElem-1/)
-      call ReadArray_HDF5(fileId,'ElemInfo',hopr_elemInfo,offset)
-    else
-      call ReadArray_HDF5(fileId,'ElemInfo',hopr_elemInfo)
-    endif
-
-    ! Read local subarray of NodeCoords and GlobalNodeIDs
-    firstNode = hopr_elemInfo(5,1)+1
-    nLocalNodes = hopr_elemInfo(6,nLocalElems)-hopr_elemInfo(5,1)
-
-    ! Allocate Space for hopr_nodeCoords and hopr_globalNodeIDs !
-    allocate(hopr_nodeCoords(1:3,1:nLocalNodes),hopr_globalNodeIDs(1:nLocalNodes))
+      call ReadPartitioned_HOPr(fileId,this%decomp,nGlobalElem,3, &
+                                hopr_elemInfo,hopr_nodeCoords,hopr_globalNodeIDs,hopr_sideInfo)
+      nLocalElems = size(hopr_elemInfo,2)
+      nLocalNodes = size(hopr_nodeCoords,2)
+      nLocalSides = size(hopr_sideInfo,2)
 
-    if(this%decomp%mpiEnabled) then
-      offset = (/0,firstNode-1/)
-      call ReadArray_HDF5(fileId,'NodeCoords',hopr_nodeCoords,offset)
-      gOffset = (/firstNode-1/)
-      call ReadArray_HDF5(fileId,'GlobalNodeIDs',hopr_globalNodeIDs,gOffset)
     else
-      call ReadArray_HDF5(fileId,'NodeCoords',hopr_nodeCoords)
-      call ReadArray_HDF5(fileId,'GlobalNodeIDs',hopr_globalNodeIDs)
-    endif
-
-    ! Read local subarray of SideInfo
-    firstSide = hopr_elemInfo(3,1)+1
-    nLocalSides = hopr_elemInfo(4,nLocalElems)-hopr_elemInfo(3,1)
 
-    ! Allocate space for hopr_sideInfo
-    allocate(hopr_sideInfo(1:5,1:nLocalSides))
+      firstElem = this%decomp%offsetElem(this%decomp%rankId+1)+1
+      nLocalElems = this%decomp%offsetElem(this%decomp%rankId+2)- &
+                    this%decomp%offsetElem(this%decomp%rankId+1)
+
+      ! Allocate Space for hopr_elemInfo!
+      allocate(hopr_elemInfo(1:6,1:nLocalElems))
+      if(this%decomp%mpiEnabled) then
+        offset = (/0,firstElem-1/)
+        call ReadArray_HDF5(fileId,'ElemInfo',hopr_elemInfo,offset)
+      else
+        call ReadArray_HDF5(fileId,'ElemInfo',hopr_elemInfo)
+      endif
+
+      ! Read local subarray of NodeCoords and GlobalNodeIDs
+      firstNode = hopr_elemInfo(5,1)+1
+      nLocalNodes = hopr_elemInfo(6,nLocalElems)-hopr_elemInfo(5,1)
+
+      ! Allocate Space for hopr_nodeCoords and hopr_globalNodeIDs !
+      allocate(hopr_nodeCoords(1:3,1:nLocalNodes),hopr_globalNodeIDs(1:nLocalNodes))
+
+      if(this%decomp%mpiEnabled) then
+        offset = (/0,firstNode-1/)
+        call ReadArray_HDF5(fileId,'NodeCoords',hopr_nodeCoords,offset)
+        gOffset = (/firstNode-1/)
+        call ReadArray_HDF5(fileId,'GlobalNodeIDs',hopr_globalNodeIDs,gOffset)
+      else
+        call ReadArray_HDF5(fileId,'NodeCoords',hopr_nodeCoords)
+        call ReadArray_HDF5(fileId,'GlobalNodeIDs',hopr_globalNodeIDs)
+      endif
+
+      ! Read local subarray of SideInfo
+      firstSide = hopr_elemInfo(3,1)+1
+      nLocalSides = hopr_elemInfo(4,nLocalElems)-hopr_elemInfo(3,1)
+
+      ! Allocate space for hopr_sideInfo
+      allocate(hopr_sideInfo(1:5,1:nLocalSides))
+
+      if(this%decomp%mpiEnabled) then
+        offset = (/0,firstSide-1/)
+        call ReadArray_HDF5(fileId,'SideInfo',hopr_sideInfo,offset)
+      else
+        call ReadArray_HDF5(fileId,'SideInfo',hopr_sideInfo)
+      endif
 
-    if(this%decomp%mpiEnabled) then
-      offset = (/0,firstSide-1/)
-      call ReadArray_HDF5(fileId,'SideInfo',hopr_sideInfo,offset)
-    else
-      call ReadArray_HDF5(fileId,'SideInfo',hopr_sideInfo)
     endif
 
     call Close_HDF5(fileID)
@@ -826,6 +786,7 @@ contains
 
     deallocate(hopr_elemInfo,hopr_nodeCoords,hopr_globalNodeIDs,hopr_sideInfo)
 
+    call this%decomp%SetupHaloExchange(this%sideInfo)
     call this%UpdateDevice()
 
   endsubroutine Read_HOPr_Mesh3D_t
@@ -29,6 +29,7 @@ module SELF_Model
   use SELF_SupportRoutines
   use SELF_Metadata
   use SELF_HDF5
+  use SELF_AsyncWriter
   use HDF5
   use FEQParse
 
@@ -51,42 +52,166 @@ module SELF_Model
 
   ! Carpenter-Kennedy Runge-Kuttta 4th Order (Low Storage)
   real(prec),parameter :: rk4_a(1:5) = (/0.0_prec, &
-                                         -1.0_prec, &
-                                         -1.0_prec/3.0_prec+ &
-                                         2.0_prec**(2.0_prec/3.0_prec)/6.0_prec, &
-                                         -2.0_prec**(1.0_prec/3.0_prec)- &
-                                         2.0_prec**(2.0_prec/3.0_prec)-2.0_prec, &
-                                         -1.0_prec+2.0_prec**(1.0_prec/3.0_prec)/)
-
-  real(prec),parameter :: rk4_b(1:5) = (/ &
-                          0.0_prec, &
-                          2.0_prec/3.0_prec+2.0_prec**(1.0_prec/3.0_prec)/3.0_prec+ &
-                          2.0_prec**(2.0_prec/3.0_prec)/6.0_prec, &
-                          2.0_prec/3.0_prec+2.0_prec**(1.0_prec/3.0_prec)/3.0_prec+ &
-                          2.0_prec**(2.0_prec/3.0_prec)/6.0_prec, &
-                          1.0_prec/3.0_prec-2.0_prec**(1.0_prec/3.0_prec)/3.0_prec- &
-                          2.0_prec**(2.0_prec/3.0_prec)/6.0_prec, &
-                          1.0_prec/)
-
-  real(prec),parameter :: rk4_g(1:5) = (/ &
-                          2.0_prec/3.0_prec+2.0_prec**(1.0_prec/3.0_prec)/3.0_prec+ &
-                          2.0_prec**(2.0_prec/3.0_prec)/6.0_prec, &
-                          -2.0_prec**(2.0_prec/3.0_prec)/6.0_prec+1.0_prec/6.0_prec, &
-                          -1.0_prec/3.0_prec-2.0_prec*2.0_prec**(1.0_prec/3.0_prec)/3.0_prec- &
-                          2.0_prec**(2.0_prec/3.0_prec)/3.0_prec, &
-                          1.0_prec/3.0_prec-2.0_prec**(1.0_prec/3.0_prec)/3.0_prec- &
-                          2.0_prec**(2.0_prec/3.0_prec)/6.0_prec, &
-                          1.0_prec/3.0_prec+2.0_prec**(1.0_prec/3.0_prec)/6.0_prec+ &
-                          2.0_prec**(2.0_prec/3.0_prec)/12.0_prec/)
+                                         -567301805773.0_prec/1357537059087.0_prec, &
+                                         -2404267990393.0_prec/2016746695238.0_prec, &
+                                         -3550918686646.0_prec/2091501179385.0_prec, &
+                                         -1275806237668.0_prec/842570457699.0_prec/)
+
+  real(prec),parameter :: rk4_b(1:5) = (/0.0_prec, &
+                                         1432997174477.0_prec/9575080441755.0_prec, &
+                                         2526269341429.0_prec/6820363962896.0_prec, &
+                                         2006345519317.0_prec/3224310063776.0_prec, &
+                                         2802321613138.0_prec/2924317926251.0_prec/)
+
+  real(prec),parameter :: rk4_g(1:5) = (/1432997174477.0_prec/9575080441755.0_prec, &
+                                         5161836677717.0_prec/13612068292357.0_prec, &
+                                         1720146321549.0_prec/2090206949498.0_prec, &
+                                         3134564353537.0_prec/4481467310338.0_prec, &
+                                         2277821191437.0_prec/14882151754819.0_prec/)
+
+  ! Niegemann, Diehl & Busch 12-stage, 4th order (Low Storage)
+  real(prec),parameter :: lsrk124_a(1:12) = (/0.0_prec,-0.0923311242368072_prec, &
+                                              -0.9441056581158819_prec,-4.3271273247576394_prec, &
+                                              -2.1557771329026072_prec,-0.9770727190189062_prec, &
+                                              -0.7581835342571139_prec,-1.7977525470825499_prec, &
+                                              -2.6915667972700770_prec,-4.6466798960268143_prec, &
+                                              -0.1539613783825189_prec,-0.5943293901830616_prec/)
+  real(prec),parameter :: lsrk124_b(1:12) = (/0.0_prec,0.0650008435125904_prec, &
+                                              0.0796560563081853_prec,0.1620416710085376_prec, &
+                                              0.2248877362907778_prec,0.2952293985641261_prec, &
+                                              0.3318332506149405_prec,0.4094724050198658_prec, &
+                                              0.6356954475753369_prec,0.6806551557645497_prec, &
+                                              0.7143773712418350_prec,0.9032588871651854_prec/)
+  real(prec),parameter :: lsrk124_g(1:12) = (/0.0650008435125904_prec,0.0161459902249842_prec, &
+                                              0.5758627178358159_prec,0.1649758848361671_prec, &
+                                              0.3934619494248182_prec,0.0443509641602719_prec, &
+                                              0.2074504268408778_prec,0.6914247433015102_prec, &
+                                              0.3766646883450449_prec,0.0757190350155483_prec, &
+                                              0.2027862031054088_prec,0.2167029365631842_prec/)
+
+  ! Niegemann, Diehl & Busch 13-stage, 4th order (Low Storage)
+  real(prec),parameter :: lsrk134_a(1:13) = (/0.0_prec,-0.6160178650170565_prec, &
+                                              -0.4449487060774118_prec,-1.0952033345276178_prec, &
+                                              -1.2256030785959187_prec,-0.2740182222332805_prec, &
+                                              -0.0411952089052647_prec,-0.1797084899153560_prec, &
+                                              -1.1771530652064288_prec,-0.4078831463120878_prec, &
+                                              -0.8295636426191777_prec,-4.7895970584252288_prec, &
+                                              -0.6606671432964504_prec/)
+  real(prec),parameter :: lsrk134_b(1:13) = (/0.0_prec,0.0271990297818803_prec, &
+                                              0.0952594339119365_prec,0.1266450286591127_prec, &
+                                              0.1825883045699772_prec,0.3737511439063931_prec, &
+                                              0.5301279418422206_prec,0.5704177433952291_prec, &
+                                              0.5885784947099155_prec,0.6160769826246714_prec, &
+                                              0.6223252334314046_prec,0.6897593128753419_prec, &
+                                              0.9126827615920843_prec/)
+  real(prec),parameter :: lsrk134_g(1:13) = (/0.0271990297818803_prec,0.1772488819905108_prec, &
+                                              0.0378528418949694_prec,0.6086431830142991_prec, &
+                                              0.2154313974316100_prec,0.2066152563885843_prec, &
+                                              0.0415864076069797_prec,0.0219891884310925_prec, &
+                                              0.9893081222650993_prec,0.0063199019859826_prec, &
+                                              0.3749640721105318_prec,1.6080235151003195_prec, &
+                                              0.0961209123818189_prec/)
+
+  ! Niegemann, Diehl & Busch 14-stage, 4th order (Low Storage)
+  real(prec),parameter :: lsrk144_a(1:14) = (/0.0_prec,-0.7188012108672410_prec, &
+                                              -0.7785331173421570_prec,-0.0053282796654044_prec, &
+                                              -0.8552979934029281_prec,-3.9564138245774565_prec, &
+                                              -1.5780575380587385_prec,-2.0837094552574054_prec, &
+                                              -0.7483334182761610_prec,-0.7032861106563359_prec, &
+                                              0.0013917096117681_prec,-0.0932075369637460_prec, &
+                                              -0.9514200470875948_prec,-7.1151571693922548_prec/)
+  real(prec),parameter :: lsrk144_b(1:14) = (/0.0_prec,0.0367762454319673_prec, &
+                                              0.1249685262725025_prec,0.2446177702277698_prec, &
+                                              0.2476149531070420_prec,0.2969311120382472_prec, &
+                                              0.3978149645802642_prec,0.5270854589440328_prec, &
+                                              0.6981269994175695_prec,0.8190890835352128_prec, &
+                                              0.8527059887098624_prec,0.8604711817462826_prec, &
+                                              0.8627060376969976_prec,0.8734213127600976_prec/)
+  real(prec),parameter :: lsrk144_g(1:14) = (/0.0367762454319673_prec,0.3136296607553959_prec, &
+                                              0.1531848691869027_prec,0.0030097086818182_prec, &
+                                              0.3326293790646110_prec,0.2440251405350864_prec, &
+                                              0.3718879239592277_prec,0.6204126221582444_prec, &
+                                              0.1524043173028741_prec,0.0760894927419266_prec, &
+                                              0.0077604214040978_prec,0.0024647284755382_prec, &
+                                              0.0780348340049386_prec,5.5059777270269628_prec/)
+
+  ! Toulorge & Desmet 7-stage, 3rd order (Low Storage)
+  real(prec),parameter :: lddrk73_a(1:7) = (/0.0_prec,-0.8083163874983830_prec, &
+                                             -1.503407858773331_prec,-1.053064525050744_prec, &
+                                             -1.463149119280508_prec,-0.6592881281087830_prec, &
+                                             -1.667891931891068_prec/)
+  real(prec),parameter :: lddrk73_b(1:7) = (/0.0_prec,0.01197052673097840_prec, &
+                                             0.1823177940361990_prec,0.5082168062551849_prec, &
+                                             0.6532031220148590_prec,0.8534401385678250_prec, &
+                                             0.9980466084623790_prec/)
+  real(prec),parameter :: lddrk73_g(1:7) = (/0.01197052673097840_prec,0.8886897793820711_prec, &
+                                             0.4578382089261419_prec,0.5790045253338471_prec, &
+                                             0.3160214638138484_prec,0.2483525368264122_prec, &
+                                             0.06771230959408840_prec/)
+
+  ! Toulorge & Desmet 8-stage, 4th order, optimized for the Courant number (Low Storage)
+  real(prec),parameter :: lddrk84c_a(1:8) = (/0.0_prec,-0.7212962482279240_prec, &
+                                              -0.01077336571612980_prec,-0.5162584698930970_prec, &
+                                              -1.730100286632201_prec,-5.200129304403076_prec, &
+                                              0.7837058945416420_prec,-0.5445836094332190_prec/)
+  real(prec),parameter :: lddrk84c_b(1:8) = (/0.0_prec,0.2165936736758085_prec, &
+                                              0.2660343487538170_prec,0.2840056122522720_prec, &
+                                              0.3251266843788570_prec,0.4555149599187530_prec, &
+                                              0.7713219317101170_prec,0.9199028964538660_prec/)
+  real(prec),parameter :: lddrk84c_g(1:8) = (/0.2165936736758085_prec,0.1773950826411583_prec, &
+                                              0.01802538611623290_prec,0.08473476372541490_prec, &
+                                              0.8129106974622483_prec,1.903416030422760_prec, &
+                                              0.1314841743399048_prec,0.2082583170674149_prec/)
+
+  ! Toulorge & Desmet 8-stage, 4th order, optimized for accuracy (Low Storage)
+  real(prec),parameter :: lddrk84f_a(1:8) = (/0.0_prec,-0.5534431294501569_prec, &
+                                              0.01065987570203490_prec,-0.5515812888932000_prec, &
+                                              -1.885790377558741_prec,-5.701295742793264_prec, &
+                                              2.113903965664793_prec,-0.5339578826675280_prec/)
+  real(prec),parameter :: lddrk84f_b(1:8) = (/0.0_prec,0.08037936882736950_prec, &
+                                              0.3210064250338430_prec,0.3408501826604660_prec, &
+                                              0.3850364824285470_prec,0.5040052477534100_prec, &
+                                              0.6578977561168540_prec,0.9484087623348481_prec/)
+  real(prec),parameter :: lddrk84f_g(1:8) = (/0.08037936882736950_prec,0.5388497458569843_prec, &
+                                              0.01974974409031960_prec,0.09911841297339970_prec, &
+                                              0.7466920411064123_prec,1.679584245618894_prec, &
+                                              0.2433728067008188_prec,0.1422730459001373_prec/)
+
+  ! Step size controller for the embedded Runge-Kutta pairs
+  real(prec),parameter :: erk_safety = 0.9_prec ! Safety factor applied to the proposed step size
+  real(prec),parameter :: erk_facmin = 0.2_prec ! Smallest allowed ratio of consecutive step sizes
+  real(prec),parameter :: erk_facmax = 5.0_prec ! Largest allowed ratio of consecutive step sizes
+  real(prec),parameter :: erk_beta1 = 0.7_prec ! PI controller gains, scaled by 1/(q+1),
+  real(prec),parameter :: erk_beta2 = 0.4_prec ! where q is the order of the embedded solution
+  real(prec),parameter :: erk_errmin = 1.0e-4_prec ! Floor on the error norm used by the controller
+  integer,parameter :: SELF_ERK_MAX_STAGES = 8
+
+  ! Adams-Bashforth coefficients, from the most recent tendency to the oldest
+  real(prec),parameter :: ab2_b(1:2) = (/1.5_prec,-0.5_prec/)
+  real(prec),parameter :: ab3_b(1:3) = (/23.0_prec/12.0_prec,-16.0_prec/12.0_prec,5.0_prec/12.0_prec/)
+  real(prec),parameter :: ab4_b(1:4) = (/55.0_prec/24.0_prec,-59.0_prec/24.0_prec, &
+                                         37.0_prec/24.0_prec,-9.0_prec/24.0_prec/)
+  real(prec),parameter :: ab_steptol = 0.01_prec ! Relative change in step size tolerated by the tendency history
+  integer,parameter :: SELF_MAX_RATE_LEVELS = 8 ! Largest number of rate levels of the multirate methods
+
+  integer,parameter :: imex_maxnewton = 10 ! Largest number of Newton iterations per implicit stage
 
 !
   integer,parameter :: SELF_EULER = 100
   integer,parameter :: SELF_RK2 = 200
   integer,parameter :: SELF_RK3 = 300
   integer,parameter :: SELF_RK4 = 400
-  ! integer,parameter :: SELF_AB2 = 201
-  ! integer,parameter :: SELF_AB3 = 301
-  ! integer,parameter :: SELF_AB4 = 401
+  integer,parameter :: SELF_RK32 = 302
+  integer,parameter :: SELF_RK43 = 403
+  integer,parameter :: SELF_RK54 = 504
+  integer,parameter :: SELF_AB2 = 201
+  integer,parameter :: SELF_AB3 = 301
+  integer,parameter :: SELF_AB4 = 401
+  integer,parameter :: SELF_MRAB2 = 202
+  integer,parameter :: SELF_MRAB3 = 303
+  integer,parameter :: SELF_MRAB4 = 404
+  integer,parameter :: SELF_ARK3 = 332
+  integer,parameter :: SELF_ARK4 = 443
 
   integer,parameter :: SELF_INTEGRATOR_LENGTH = 10 ! max length of integrator methods when specified as char
   integer,parameter :: SELF_EQUATION_LENGTH = 500
@@ -106,7 +231,75 @@ module SELF_Model
     logical :: gradient_enabled = .false.
     logical :: prescribed_bcs_enabled = .true.
     logical :: tecplot_enabled = .true.
+    ! When enabled, ForwardStep writes the visualization output with WriteXDMF, to one
+    ! HDF5 file per output for all ranks, in place of the per-rank Tecplot files
+    logical :: xdmf_enabled = .false.
+    ! When enabled, the geometry and interpolant are written once, to geometryFile,
+    ! and each pickup file references them through HDF5 external links
+    logical :: geometry_file_enabled = .false.
+    logical :: geometry_file_written = .false.
+    character(LEN=self_FileNameLength) :: geometryFile = 'geometry.h5'
+    ! When enabled, WriteModel copies the solution to a snapshot buffer and writes it with
+    ! nonblocking MPI-IO, so that time stepping continues during the write. WriteModel only
+    ! waits when async_io_depth writes are already in flight
+    logical :: async_io_enabled = .false.
+    integer :: async_io_depth = 1
+    type(AsyncWriter) :: asyncWriter
+    ! Storage of the datasets in the model output files (chunking, compression and mantissa
+    ! rounding). The solution and tendency history are always written without the mantissa
+    ! rounding, so that pickup files are lossless; the rounding is only applied to analysis
+    ! outputs. Asynchronous writes use contiguous, uncompressed solution datasets.
+    type(HDF5StoragePolicy) :: outputStorage
     integer :: nvar
+    ! 2N-storage Runge-Kutta coefficient table (see SetLowStorageRKTableau)
+    integer :: lsrk_nstages = 0
+    real(prec),allocatable :: lsrk_a(:)
+    real(prec),allocatable :: lsrk_b(:) ! Stage times, as a fraction of the time step
+    real(prec),allocatable :: lsrk_g(:)
+    ! Embedded Runge-Kutta pair (see SetTimeIntegrator)
+    integer :: erk_nstages = 0
+    integer :: erk_order = 0 ! Order of the embedded (lower order) solution
+    logical :: erk_fsal = .false. ! True when the last stage is evaluated at the new solution
+    real(prec),allocatable :: erk_a(:,:)
+    real(prec),allocatable :: erk_b(:)
+    real(prec),allocatable :: erk_bhat(:)
+    real(prec),allocatable :: erk_c(:)
+    real(prec) :: erk_errPrev = 1.0_prec
+    integer :: erk_nslots = 0 ! Number of stage slots currently allocated by the model
+    real(prec) :: abstol = 1.0e-6_prec ! Absolute error tolerance for adaptive time stepping
+    real(prec) :: reltol = 1.0e-6_prec ! Relative error tolerance for adaptive time stepping
+    integer :: nAcceptedSteps = 0
+    integer :: nRejectedSteps = 0
+    ! Adams-Bashforth multistep methods (see SetTimeIntegrator). The tendency history
+    ! is a ring buffer of ab_order slots, with the most recent tendency in slot ab_head
+    integer :: ab_order = 0
+    integer :: ab_nhistory = 0 ! Number of consecutive tendencies currently stored
+    integer :: ab_head = 0
+    real(prec) :: ab_dt = 0.0_prec ! Time step size of the stored tendency history
+    integer :: ab_nslots = 0 ! Number of history slots currently allocated by the model
+    ! Multirate Adams-Bashforth methods (see SetMultirateLevels). Elements of rate level l
+    ! step with dt*2**l, and each level keeps its own position in the tendency history
+    integer :: lts_nlevels = 1
+    integer :: lts_head(0:SELF_MAX_RATE_LEVELS-1) = 0
+    integer :: lts_nhistory(0:SELF_MAX_RATE_LEVELS-1) = 0
+    ! Elements above this rate level are skipped by the flux, source and boundary flux methods
+    integer :: lts_activeLevel = huge(1)
+    ! Additive Runge-Kutta IMEX methods (see SetTimeIntegrator). The terms of the tendency
+    ! that depend on the solution gradient are integrated implicitly, the others explicitly
+    integer :: ark_nstages = 0
+    real(prec),allocatable :: ark_ae(:,:) ! Explicit coefficients
+    real(prec),allocatable :: ark_ai(:,:) ! Implicit (singly diagonal) coefficients
+    real(prec),allocatable :: ark_b(:)
+    real(prec),allocatable :: ark_c(:)
+    real(prec) :: imex_tol = 1.0e-6_prec ! Relative reduction of the residual of the implicit stages
+    integer :: gmres_m = 20 ! Restart length of GMRES
+    integer :: gmres_maxiter = 500 ! Largest number of GMRES iterations per linear solve
+    integer :: imex_nvectors = 0 ! Number of vector slots needed by the IMEX integrator
+    integer :: imex_nslots = 0 ! Number of vector slots currently allocated by the model
+    integer :: nKrylovIterations = 0 ! GMRES iterations since the IMEX integrator was set
+    ! When cfl > 0, the time step size is reset to ComputeStableDt(cfl)
+    ! at the start of each IO interval in ForwardStep
+    real(prec) :: cfl = 0.0_prec
     ! Standard Diagnostics
     real(prec) :: entropy ! Mathematical entropy function for the model
 
@@ -136,9 +329,48 @@ module SELF_Model
     procedure :: LowStorageRK4_timeIntegrator
     procedure(UpdateGRK),deferred :: UpdateGRK4
 
+    procedure :: LowStorageRK_timeIntegrator
+    procedure(UpdateGRK),deferred :: UpdateGLSRK
+    procedure :: SetLowStorageRKTableau
+
+    ! Embedded Runge-Kutta methods
+    procedure :: EmbeddedRK_timeIntegrator
+    procedure(StoreERKStage),deferred :: StoreERKStage
+    procedure(UpdateERK),deferred :: UpdateERK
+    procedure(ERKErrorNorm),deferred :: ERKErrorNorm
+
+    procedure :: AdamsBashforth_timeIntegrator
+    procedure(UpdateGAB),deferred :: UpdateGAB
+    procedure :: WriteABState => WriteABState_Model
+    procedure :: ReadABState => ReadABState_Model
+
+    procedure :: MultirateAB_timeIntegrator
+    procedure(UpdateGMRAB),deferred :: UpdateGMRAB
+    procedure(SetMultirateLevels),deferred :: SetMultirateLevels
+
+    ! Additive Runge-Kutta IMEX methods
+    procedure :: IMEX_timeIntegrator
+    procedure :: EvaluateIMEXParts
+    procedure :: SolveIMEXStage
+    procedure :: GMRES_IMEX
+    procedure(CalculateTendency),deferred :: CalculateExplicitTendency
+    procedure(StoreIMEX),deferred :: StoreIMEX
+    procedure(LoadIMEX),deferred :: LoadIMEX
+    procedure(CombineIMEX),deferred :: CombineIMEX
+    procedure(DotIMEX),deferred :: DotIMEX
+    procedure(LoadIMEX),deferred :: RandomIMEX
+
     procedure :: PreTendency => PreTendency_Model
     procedure :: entropy_func => entropy_func_Model
 
+    procedure :: maxWaveSpeed => maxWaveSpeed_Model
+    procedure :: maxDiffusivity => maxDiffusivity_Model
+    procedure(ComputeStableDt),deferred :: ComputeStableDt
+    procedure :: EstimateSpectrum
+    procedure :: EstimateSpectralRadius
+    procedure :: EstimateStableDt
+    procedure :: AmplificationFactor
+
     procedure :: flux1D => flux1d_Model
     procedure :: flux2D => flux2d_Model
     procedure :: flux3D => flux3d_Model
@@ -151,6 +383,24 @@ module SELF_Model
     procedure :: source2d => source2d_Model
     procedure :: source3d => source3d_Model
 
+    ! Batched versions of the flux, source and Riemann flux functions. These are
+    ! called by the DGModel classes on contiguous blocks of nodes; the first
+    ! dimension of each array is the node index. The defaults call the pointwise
+    ! functions above at each node, so that a model only needs to override the
+    ! pointwise functions; models can override these to evaluate the block with
+    ! vectorizable loops over nodes.
+    procedure :: flux1d_batch => flux1d_batch_Model
+    procedure :: flux2d_batch => flux2d_batch_Model
+    procedure :: flux3d_batch => flux3d_batch_Model
+
+    procedure :: riemannflux1d_batch => riemannflux1d_batch_Model
+    procedure :: riemannflux2d_batch => riemannflux2d_batch_Model
+    procedure :: riemannflux3d_batch => riemannflux3d_batch_Model
+
+    procedure :: source1d_batch => source1d_batch_Model
+    procedure :: source2d_batch => source2d_batch_Model
+    procedure :: source3d_batch => source3d_batch_Model
+
     ! Boundary condition functions (hyperbolic)
     procedure :: hbc1d_Prescribed => hbc1d_Prescribed_Model
     procedure :: hbc1d_Radiation => hbc1d_Generic_Model
@@ -180,9 +430,13 @@ module SELF_Model
 
     procedure(UpdateSolution),deferred :: UpdateSolution
     procedure(CalculateTendency),deferred :: CalculateTendency
+    ! Computes the source and flux divergence without assembling dSdt. The low-storage
+    ! Runge-Kutta stage updates (UpdateGRK*) read these directly.
+    procedure(CalculateTendency),deferred :: CalculateFluxDivergence
     procedure(ReadModel),deferred :: ReadModel
     procedure(WriteModel),deferred :: WriteModel
     procedure(WriteTecplot),deferred :: WriteTecplot
+    procedure :: WriteXDMF => WriteXDMF_Model
 
     generic :: SetTimeIntegrator => SetTimeIntegrator_withChar
     procedure,private :: SetTimeIntegrator_withChar
@@ -211,6 +465,142 @@ module SELF_Model
     endsubroutine UpdateGRK
   endinterface
 
+  interface
+    subroutine StoreERKStage(this,m)
+      !! Copies the solution (m=0) or the tendency dSdt (m>0) to stage slot m
+      import Model
+      implicit none
+      class(Model),intent(inout) :: this
+      integer,intent(in) :: m
+    endsubroutine StoreERKStage
+  endinterface
+
+  interface
+    subroutine UpdateERK(this,w)
+      !! Sets the solution to the contents of slot 0 plus the weighted sum
+      !! of the stored tendencies, sum_j w(j)*slot(j)
+      use SELF_Constants,only:prec
+      import Model
+      implicit none
+      class(Model),intent(inout) :: this
+      real(prec),intent(in) :: w(:)
+    endsubroutine UpdateERK
+  endinterface
+
+  interface
+    function ERKErrorNorm(this,w) result(err)
+      !! Returns the root-mean-square of the error estimate sum_j w(j)*slot(j),
+      !! scaled by abstol + reltol*max(|slot(0)|,|solution|), over all ranks
+      use SELF_Constants,only:prec
+      import Model
+      implicit none
+      class(Model),intent(inout) :: this
+      real(prec),intent(in) :: w(:)
+      real(prec) :: err
+    endfunction ERKErrorNorm
+  endinterface
+
+  interface
+    subroutine UpdateGAB(this,w)
+      !! Copies the tendency dSdt to history slot ab_head, then replaces dSdt
+      !! with the weighted sum of the history, sum_j w(j)*slot(j-1)
+      use SELF_Constants,only:prec
+      import Model
+      implicit none
+      class(Model),intent(inout) :: this
+      real(prec),intent(in) :: w(:)
+    endsubroutine UpdateGAB
+  endinterface
+
+  interface
+    subroutine UpdateGMRAB(this,w,activeLevel,predict)
+      !! For the elements of rate level l <= activeLevel, copies the solution to workSol and
+      !! the tendency dSdt to history slot lts_head(l). When predict is true, the solution of
+      !! every element is then set to workSol plus sum_j w(j,l)*slot(j-1)
+      use SELF_Constants,only:prec
+      import Model
+      implicit none
+      class(Model),intent(inout) :: this
+      real(prec),intent(in) :: w(:,0:)
+      integer,intent(in) :: activeLevel
+      logical,intent(in) :: predict
+    endsubroutine UpdateGMRAB
+  endinterface
+
+  interface
+    subroutine SetMultirateLevels(this,cfl,maxLevels)
+      !! Assigns each element to a rate level from its stable time step size and sets
+      !! the time step size dt of the fastest level
+      use SELF_Constants,only:prec
+      import Model
+      implicit none
+      class(Model),intent(inout) :: this
+      real(prec),intent(in) :: cfl
+      integer,intent(in) :: maxLevels
+    endsubroutine SetMultirateLevels
+  endinterface
+
+  interface
+    subroutine StoreIMEX(this,slot,fromTendency)
+      !! Copies the tendency dSdt (fromTendency = .true.) or the solution to the given vector slot
+      import Model
+      implicit none
+      class(Model),intent(inout) :: this
+      integer,intent(in) :: slot
+      logical,intent(in) :: fromTendency
+    endsubroutine StoreIMEX
+  endinterface
+
+  interface
+    subroutine LoadIMEX(this,slot)
+      !! Copies the given vector slot to the solution
+      import Model
+      implicit none
+      class(Model),intent(inout) :: this
+      integer,intent(in) :: slot
+    endsubroutine LoadIMEX
+  endinterface
+
+  interface
+    subroutine CombineIMEX(this,slot,slots,w)
+      !! Sets the given vector slot to sum_j w(j)*v(slots(j)), where v(k) is vector slot k.
+      !! The given slot may be one of slots
+      use SELF_Constants,only:prec
+      import Model
+      implicit none
+      class(Model),intent(inout) :: this
+      integer,intent(in) :: slot
+      integer,intent(in) :: slots(:)
+      real(prec),intent(in) :: w(:)
+    endsubroutine CombineIMEX
+  endinterface
+
+  interface
+    function DotIMEX(this,a,b) result(d)
+      !! Returns the dot product of vector slots a and b, over all ranks
+      use SELF_Constants,only:prec
+      import Model
+      implicit none
+      class(Model),intent(inout) :: this
+      integer,intent(in) :: a
+      integer,intent(in) :: b
+      real(prec) :: d
+    endfunction DotIMEX
+  endinterface
+
+  interface
+    function ComputeStableDt(this,cfl) result(dt)
+      !! Returns the largest time step size allowed by the cfl number,
+      !! over all ranks
+      use SELF_Constants,only:prec
+      import Model
+      implicit none
+      class(Model),intent(inout) :: this
+      real(prec),intent(in) :: cfl
+      real(prec) :: dt
+    endfunction ComputeStableDt
+  endinterface
+
   interface
     subroutine UpdateSolution(this,dt)
       use SELF_Constants,only:prec
@@ -326,6 +716,31 @@ contains
 
   endfunction entropy_func_Model
 
+  pure function maxWaveSpeed_Model(this,s) result(c)
+    !! Returns the largest characteristic speed of the model at the state s.
+    !! This is used by ComputeStableDt to set the advective time step limit.
+    !! This default returns zero; override it in models with wave propagation
+    !! or advection.
+    class(Model),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%nvar)
+    real(prec) :: c
+
+    c = 0.0_prec
+
+  endfunction maxWaveSpeed_Model
+
+  pure function maxDiffusivity_Model(this,s) result(nu)
+    !! Returns the largest diffusivity of the model at the state s.
+    !! This is used by ComputeStableDt to set the diffusive time step limit
+    !! when gradient_enabled is set. This default returns zero.
+    class(Model),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%nvar)
+    real(prec) :: nu
+
+    nu = 0.0_prec
+
+  endfunction maxDiffusivity_Model
+
   pure function riemannflux1d_Model(this,sL,sR,dsdx,nhat) result(flux)
     class(Model),intent(in) :: this
     real(prec),intent(in) :: sL(1:this%nvar)
@@ -458,6 +873,154 @@ contains
 
   endfunction source3d_Model
 
+  pure subroutine riemannflux1d_batch_Model(this,sL,sR,dsdx,nhat,flux)
+    !! Evaluates riemannflux1d at each node of a block; sL(n,1:nvar), sR(n,1:nvar),
+    !! dsdx(n,1:nvar) and nhat(n) are the inputs at node n, and flux(n,1:nvar) is the output.
+    class(Model),intent(in) :: this
+    real(prec),intent(in) :: sL(:,:)
+    real(prec),intent(in) :: sR(:,:)
+    real(prec),intent(in) :: dsdx(:,:)
+    real(prec),intent(in) :: nhat(:)
+    real(prec),intent(out) :: flux(:,:)
+    ! Local
+    integer :: n
+
+    do concurrent(n=1:size(sL,1))
+      flux(n,1:this%nvar) = this%riemannflux1d(sL(n,1:this%nvar),sR(n,1:this%nvar), &
+                                               dsdx(n,1:this%nvar),nhat(n))
+    enddo
+
+  endsubroutine riemannflux1d_batch_Model
+
+  pure subroutine riemannflux2d_batch_Model(this,sL,sR,dsdx,nhat,flux)
+    !! Evaluates riemannflux2d at each node of a block; nhat(n,1:2) is the unit
+    !! normal at node n.
+    class(Model),intent(in) :: this
+    real(prec),intent(in) :: sL(:,:)
+    real(prec),intent(in) :: sR(:,:)
+    real(prec),intent(in) :: dsdx(:,:,:)
+    real(prec),intent(in) :: nhat(:,:)
+    real(prec),intent(out) :: flux(:,:)
+    ! Local
+    integer :: n
+
+    do concurrent(n=1:size(sL,1))
+      flux(n,1:this%nvar) = this%riemannflux2d(sL(n,1:this%nvar),sR(n,1:this%nvar), &
+                                               dsdx(n,1:this%nvar,1:2),nhat(n,1:2))
+    enddo
+
+  endsubroutine riemannflux2d_batch_Model
+
+  pure subroutine riemannflux3d_batch_Model(this,sL,sR,dsdx,nhat,flux)
+    !! Evaluates riemannflux3d at each node of a block; nhat(n,1:3) is the unit
+    !! normal at node n.
+    class(Model),intent(in) :: this
+    real(prec),intent(in) :: sL(:,:)
+    real(prec),intent(in) :: sR(:,:)
+    real(prec),intent(in) :: dsdx(:,:,:)
+    real(prec),intent(in) :: nhat(:,:)
+    real(prec),intent(out) :: flux(:,:)
+    ! Local
+    integer :: n
+
+    do concurrent(n=1:size(sL,1))
+      flux(n,1:this%nvar) = this%riemannflux3d(sL(n,1:this%nvar),sR(n,1:this%nvar), &
+                                               dsdx(n,1:this%nvar,1:3),nhat(n,1:3))
+    enddo
+
+  endsubroutine riemannflux3d_batch_Model
+
+  pure subroutine flux1d_batch_Model(this,s,dsdx,flux)
+    !! Evaluates flux1d at each node of a block; s(n,1:nvar) and dsdx(n,1:nvar) are
+    !! the inputs at node n, and flux(n,1:nvar) is the output.
+    class(Model),intent(in) :: this
+    real(prec),intent(in) :: s(:,:)
+    real(prec),intent(in) :: dsdx(:,:)
+    real(prec),intent(out) :: flux(:,:)
+    ! Local
+    integer :: n
+
+    do concurrent(n=1:size(s,1))
+      flux(n,1:this%nvar) = this%flux1d(s(n,1:this%nvar),dsdx(n,1:this%nvar))
+    enddo
+
+  endsubroutine flux1d_batch_Model
+
+  pure subroutine flux2d_batch_Model(this,s,dsdx,flux)
+    !! Evaluates flux2d at each node of a block; flux(n,1:nvar,1:2) is the output at node n.
+    class(Model),intent(in) :: this
+    real(prec),intent(in) :: s(:,:)
+    real(prec),intent(in) :: dsdx(:,:,:)
+    real(prec),intent(out) :: flux(:,:,:)
+    ! Local
+    integer :: n
+
+    do concurrent(n=1:size(s,1))
+      flux(n,1:this%nvar,1:2) = this%flux2d(s(n,1:this%nvar),dsdx(n,1:this%nvar,1:2))
+    enddo
+
+  endsubroutine flux2d_batch_Model
+
+  pure subroutine flux3d_batch_Model(this,s,dsdx,flux)
+    !! Evaluates flux3d at each node of a block; flux(n,1:nvar,1:3) is the output at node n.
+    class(Model),intent(in) :: this
+    real(prec),intent(in) :: s(:,:)
+    real(prec),intent(in) :: dsdx(:,:,:)
+    real(prec),intent(out) :: flux(:,:,:)
+    ! Local
+    integer :: n
+
+    do concurrent(n=1:size(s,1))
+      flux(n,1:this%nvar,1:3) = this%flux3d(s(n,1:this%nvar),dsdx(n,1:this%nvar,1:3))
+    enddo
+
+  endsubroutine flux3d_batch_Model
+
+  pure subroutine source1d_batch_Model(this,s,dsdx,source)
+    !! Evaluates source1d at each node of a block
+    class(Model),intent(in) :: this
+    real(prec),intent(in) :: s(:,:)
+    real(prec),intent(in) :: dsdx(:,:)
+    real(prec),intent(out) :: source(:,:)
+    ! Local
+    integer :: n
+
+    do concurrent(n=1:size(s,1))
+      source(n,1:this%nvar) = this%source1d(s(n,1:this%nvar),dsdx(n,1:this%nvar))
+    enddo
+
+  endsubroutine source1d_batch_Model
+
+  pure subroutine source2d_batch_Model(this,s,dsdx,source)
+    !! Evaluates source2d at each node of a block
+    class(Model),intent(in) :: this
+    real(prec),intent(in) :: s(:,:)
+    real(prec),intent(in) :: dsdx(:,:,:)
+    real(prec),intent(out) :: source(:,:)
+    ! Local
+    integer :: n
+
+    do concurrent(n=1:size(s,1))
+      source(n,1:this%nvar) = this%source2d(s(n,1:this%nvar),dsdx(n,1:this%nvar,1:2))
+    enddo
+
+  endsubroutine source2d_batch_Model
+
+  pure subroutine source3d_batch_Model(this,s,dsdx,source)
+    !! Evaluates source3d at each node of a block
+    class(Model),intent(in) :: this
+    real(prec),intent(in) :: s(:,:)
+    real(prec),intent(in) :: dsdx(:,:,:)
+    real(prec),intent(out) :: source(:,:)
+    ! Local
+    integer :: n
+
+    do concurrent(n=1:size(s,1))
+      source(n,1:this%nvar) = this%source3d(s(n,1:this%nvar),dsdx(n,1:this%nvar,1:3))
+    enddo
+
+  endsubroutine source3d_batch_Model
+
   pure function hbc1d_Generic_Model(this,s,nhat) result(exts)
     class(Model),intent(in) :: this
     real(prec),intent(in) :: s(1:this%nvar)
@@ -635,6 +1198,44 @@ contains
     !!   "rk2"
     !!   "rk3"
     !!   "rk4"
+    !!   "lsrk124"  : Niegemann, Diehl & Busch 12-stage, 4th order
+    !!   "lsrk134"  : Niegemann, Diehl & Busch 13-stage, 4th order
+    !!   "lsrk144"  : Niegemann, Diehl & Busch 14-stage, 4th order
+    !!   "lddrk73"  : Toulorge & Desmet 7-stage, 3rd order
+    !!   "lddrk84c" : Toulorge & Desmet 8-stage, 4th order, optimized for the Courant number
+    !!   "lddrk84f" : Toulorge & Desmet 8-stage, 4th order, optimized for accuracy
+    !!   "rk32" : Bogacki-Shampine 3(2) embedded pair, adaptive time step
+    !!   "rk43" : Merson 4(3) embedded pair, adaptive time step
+    !!   "rk54" : Dormand-Prince 5(4) embedded pair, adaptive time step
+    !!   "ab2"  : Adams-Bashforth 2nd order
+    !!   "ab3"  : Adams-Bashforth 3rd order
+    !!   "ab4"  : Adams-Bashforth 4th order
+    !!   "mrab2" : Multirate Adams-Bashforth 2nd order
+    !!   "mrab3" : Multirate Adams-Bashforth 3rd order
+    !!   "mrab4" : Multirate Adams-Bashforth 4th order
+    !!   "ark3" : Kennedy-Carpenter ARK3(2)4L[2]SA additive Runge-Kutta IMEX, 3rd order
+    !!   "ark4" : Kennedy-Carpenter ARK4(3)6L[2]SA additive Runge-Kutta IMEX, 4th order
+    !!
+    !! For the adaptive methods, the time step passed to ForwardStep is used as the
+    !! size of the first step attempt and the step size is then controlled so that the
+    !! estimated local error stays below abstol + reltol*|s|
+    !!
+    !! The Adams-Bashforth methods need one tendency evaluation per step. The first steps,
+    !! until the tendency history is filled, are taken with a Runge-Kutta method.
+    !!
+    !! The multirate methods step each element with its own rate level, set with
+    !! SetMultirateLevels. Without it, all elements are on one level and the methods are
+    !! the same as the Adams-Bashforth methods.
+    !!
+    !! The IMEX methods integrate the terms of the tendency that depend on the solution
+    !! gradient (e.g. diffusion) implicitly, so the time step is only limited by the other
+    !! terms. The implicit stages are solved with Newton iterations and matrix-free GMRES,
+    !! controlled by imex_tol, gmres_m and gmres_maxiter.
+    !!
+    !! The many-stage low storage methods have stability regions that are optimized for the
+    !! spectra of discontinuous Galerkin operators, and allow a larger time step per tendency
+    !! evaluation than rk3 and rk4. Other 2N-storage methods can be set with
+    !! SetLowStorageRKTableau.
     !!
     !! Note that the character provided is not case-sensitive
     !!
@@ -660,6 +1261,138 @@ contains
     case("RK4")
       this%timeIntegrator => LowStorageRK4_timeIntegrator
 
+    case("LSRK124")
+      call this%SetLowStorageRKTableau(lsrk124_a,lsrk124_b,lsrk124_g)
+
+    case("LSRK134")
+      call this%SetLowStorageRKTableau(lsrk134_a,lsrk134_b,lsrk134_g)
+
+    case("LSRK144")
+      call this%SetLowStorageRKTableau(lsrk144_a,lsrk144_b,lsrk144_g)
+
+    case("LDDRK73")
+      call this%SetLowStorageRKTableau(lddrk73_a,lddrk73_b,lddrk73_g)
+
+    case("LDDRK84C")
+      call this%SetLowStorageRKTableau(lddrk84c_a,lddrk84c_b,lddrk84c_g)
+
+    case("LDDRK84F")
+      call this%SetLowStorageRKTableau(lddrk84f_a,lddrk84f_b,lddrk84f_g)
+
+    case("RK32")
+      call SetEmbeddedRKTableau(this,4,2,.true.)
+      this%erk_c = (/0.0_prec,0.5_prec,0.75_prec,1.0_prec/)
+      this%erk_a(2,1) = 0.5_prec
+      this%erk_a(3,1:2) = (/0.0_prec,0.75_prec/)
+      this%erk_a(4,1:3) = (/2.0_prec/9.0_prec,1.0_prec/3.0_prec,4.0_prec/9.0_prec/)
+      this%erk_b = (/2.0_prec/9.0_prec,1.0_prec/3.0_prec,4.0_prec/9.0_prec,0.0_prec/)
+      this%erk_bhat = (/7.0_prec/24.0_prec,0.25_prec,1.0_prec/3.0_prec,0.125_prec/)
+      this%timeIntegrator => EmbeddedRK_timeIntegrator
+
+    case("RK43")
+      call SetEmbeddedRKTableau(this,5,3,.false.)
+      this%erk_c = (/0.0_prec,1.0_prec/3.0_prec,1.0_prec/3.0_prec,0.5_prec,1.0_prec/)
+      this%erk_a(2,1) = 1.0_prec/3.0_prec
+      this%erk_a(3,1:2) = (/1.0_prec/6.0_prec,1.0_prec/6.0_prec/)
+      this%erk_a(4,1:3) = (/0.125_prec,0.0_prec,0.375_prec/)
+      this%erk_a(5,1:4) = (/0.5_prec,0.0_prec,-1.5_prec,2.0_prec/)
+      this%erk_b = (/1.0_prec/6.0_prec,0.0_prec,0.0_prec,2.0_prec/3.0_prec,1.0_prec/6.0_prec/)
+      this%erk_bhat = (/0.1_prec,0.0_prec,0.3_prec,0.4_prec,0.2_prec/)
+      this%timeIntegrator => EmbeddedRK_timeIntegrator
+
+    case("RK54")
+      call SetEmbeddedRKTableau(this,7,4,.true.)
+      this%erk_c = (/0.0_prec,0.2_prec,0.3_prec,0.8_prec,8.0_prec/9.0_prec,1.0_prec,1.0_prec/)
+      this%erk_a(2,1) = 0.2_prec
+      this%erk_a(3,1:2) = (/3.0_prec/40.0_prec,9.0_prec/40.0_prec/)
+      this%erk_a(4,1:3) = (/44.0_prec/45.0_prec,-56.0_prec/15.0_prec,32.0_prec/9.0_prec/)
+      this%erk_a(5,1:4) = (/19372.0_prec/6561.0_prec,-25360.0_prec/2187.0_prec, &
+                            64448.0_prec/6561.0_prec,-212.0_prec/729.0_prec/)
+      this%erk_a(6,1:5) = (/9017.0_prec/3168.0_prec,-355.0_prec/33.0_prec, &
+                            46732.0_prec/5247.0_prec,49.0_prec/176.0_prec, &
+                            -5103.0_prec/18656.0_prec/)
+      this%erk_a(7,1:6) = (/35.0_prec/384.0_prec,0.0_prec,500.0_prec/1113.0_prec, &
+                            125.0_prec/192.0_prec,-2187.0_prec/6784.0_prec,11.0_prec/84.0_prec/)
+      this%erk_b = this%erk_a(7,1:7)
+      this%erk_bhat = (/5179.0_prec/57600.0_prec,0.0_prec,7571.0_prec/16695.0_prec, &
+                        393.0_prec/640.0_prec,-92097.0_prec/339200.0_prec, &
+                        187.0_prec/2100.0_prec,1.0_prec/40.0_prec/)
+      this%timeIntegrator => EmbeddedRK_timeIntegrator
+
+    case("AB2")
+      call SetAdamsBashforth(this,2)
+      this%timeIntegrator => AdamsBashforth_timeIntegrator
+
+    case("AB3")
+      call SetAdamsBashforth(this,3)
+      this%timeIntegrator => AdamsBashforth_timeIntegrator
+
+    case("AB4")
+      call SetAdamsBashforth(this,4)
+      this%timeIntegrator => AdamsBashforth_timeIntegrator
+
+    case("MRAB2")
+      call SetAdamsBashforth(this,2)
+      this%timeIntegrator => MultirateAB_timeIntegrator
+
+    case("MRAB3")
+      call SetAdamsBashforth(this,3)
+      this%timeIntegrator => MultirateAB_timeIntegrator
+
+    case("MRAB4")
+      call SetAdamsBashforth(this,4)
+      this%timeIntegrator => MultirateAB_timeIntegrator
+
+    case("ARK3")
+      call SetARKTableau(this,4)
+      this%ark_c = (/0.0_prec,3535464411806.0_prec/4055673282236.0_prec,0.6_prec,1.0_prec/)
+      this%ark_ae(2,1) = 1767732205903.0_prec/2027836641118.0_prec
+      this%ark_ae(3,1:2) = (/5535828885825.0_prec/10492691773637.0_prec, &
+                             788022342437.0_prec/10882634858940.0_prec/)
+      this%ark_ae(4,1:3) = (/6485989280629.0_prec/16251701735622.0_prec, &
+                             -4246266847089.0_prec/9704473918619.0_prec, &
+                             10755448449292.0_prec/10357097424841.0_prec/)
+      this%ark_ai(2,1:2) = 1767732205903.0_prec/4055673282236.0_prec
+      this%ark_ai(3,1:3) = (/2746238789719.0_prec/10658868560708.0_prec, &
+                             -640167445237.0_prec/6845629431997.0_prec, &
+                             1767732205903.0_prec/4055673282236.0_prec/)
+      this%ark_ai(4,1:4) = (/1471266399579.0_prec/7840856788654.0_prec, &
+                             -4482444167858.0_prec/7529755066697.0_prec, &
+                             11266239266428.0_prec/11593286722821.0_prec, &
+                             1767732205903.0_prec/4055673282236.0_prec/)
+      this%ark_b = this%ark_ai(4,1:4)
+      this%timeIntegrator => IMEX_timeIntegrator
+
+    case("ARK4")
+      call SetARKTableau(this,6)
+      this%ark_c = (/0.0_prec,0.5_prec,83.0_prec/250.0_prec,31.0_prec/50.0_prec,17.0_prec/20.0_prec,1.0_prec/)
+      this%ark_ae(2,1) = 0.5_prec
+      this%ark_ae(3,1:2) = (/13861.0_prec/62500.0_prec,6889.0_prec/62500.0_prec/)
+      this%ark_ae(4,1:3) = (/-116923316275.0_prec/2393684061468.0_prec, &
+                             -2731218467317.0_prec/15368042101831.0_prec, &
+                             9408046702089.0_prec/11113171139209.0_prec/)
+      this%ark_ae(5,1:4) = (/-451086348788.0_prec/2902428689909.0_prec, &
+                             -2682348792572.0_prec/7519795681897.0_prec, &
+                             12662868775082.0_prec/11960479115383.0_prec, &
+                             3355817975965.0_prec/11060851509271.0_prec/)
+      this%ark_ae(6,1:5) = (/647845179188.0_prec/3216320057751.0_prec, &
+                             73281519250.0_prec/8382639484533.0_prec, &
+                             552539513391.0_prec/3454668386233.0_prec, &
+                             3354512671639.0_prec/8306763924573.0_prec, &
+                             4040.0_prec/17871.0_prec/)
+      this%ark_ai(2,1:2) = 0.25_prec
+      this%ark_ai(3,1:3) = (/8611.0_prec/62500.0_prec,-1743.0_prec/31250.0_prec,0.25_prec/)
+      this%ark_ai(4,1:4) = (/5012029.0_prec/34652500.0_prec,-654441.0_prec/2922500.0_prec, &
+                             174375.0_prec/388108.0_prec,0.25_prec/)
+      this%ark_ai(5,1:5) = (/15267082809.0_prec/155376265600.0_prec, &
+                             -71443401.0_prec/120774400.0_prec, &
+                             730878875.0_prec/902184768.0_prec, &
+                             2285395.0_prec/8070912.0_prec,0.25_prec/)
+      this%ark_ai(6,1:6) = (/82889.0_prec/524892.0_prec,0.0_prec,15625.0_prec/83664.0_prec, &
+                             69875.0_prec/102672.0_prec,-2260.0_prec/8211.0_prec,0.25_prec/)
+      this%ark_b = this%ark_ai(6,1:6)
+      this%timeIntegrator => IMEX_timeIntegrator
+
     case DEFAULT
       this%timeIntegrator => LowStorageRK3_timeIntegrator
 
@@ -667,6 +1400,135 @@ contains
 
   endsubroutine SetTimeIntegrator_withChar
 
+  subroutine SetLowStorageRKTableau(this,rk_a,rk_b,rk_g)
+    !! Sets a 2N-storage Runge-Kutta method from its coefficient table and selects
+    !! LowStorageRK_timeIntegrator. Stage m of a step updates the stage tendency and
+    !! the solution as
+    !!
+    !!   g = rk_a(m)*g + dS/dt(t + rk_b(m)*dt)
+    !!   s = s + rk_g(m)*dt*g
+    !!
+    !! with rk_a(1) = 0 and rk_b(1) = 0
+    implicit none
+    class(Model),intent(inout) :: this
+    real(prec),intent(in) :: rk_a(:)
+    real(prec),intent(in) :: rk_b(:)
+    real(prec),intent(in) :: rk_g(:)
+
+    if(size(rk_b) /= size(rk_a) .or. size(rk_g) /= size(rk_a)) then
+      print*,__FILE__//" : Low storage Runge-Kutta coefficient arrays must have the same size."
+      stop 1
+    endif
+
+    if(allocated(this%lsrk_a)) deallocate(this%lsrk_a,this%lsrk_b,this%lsrk_g)
+    this%lsrk_nstages = size(rk_a)
+    this%lsrk_a = rk_a
+    this%lsrk_b = rk_b
+    this%lsrk_g = rk_g
+    this%timeIntegrator => LowStorageRK_timeIntegrator
+
+  endsubroutine SetLowStorageRKTableau
+
+  subroutine SetEmbeddedRKTableau(this,nstages,order,fsal)
+    !! Allocates the Butcher tableau of an embedded Runge-Kutta pair and resets
+    !! the step size controller. The coefficients are set by the caller.
+    implicit none
+    class(Model),intent(inout) :: this
+    integer,intent(in) :: nstages
+    integer,intent(in) :: order
+    logical,intent(in) :: fsal
+
+    if(allocated(this%erk_a)) deallocate(this%erk_a,this%erk_b,this%erk_bhat,this%erk_c)
+    allocate(this%erk_a(1:nstages,1:nstages), &
+             this%erk_b(1:nstages), &
+             this%erk_bhat(1:nstages), &
+             this%erk_c(1:nstages))
+
+    this%erk_a = 0.0_prec
+    this%erk_nstages = nstages
+    this%erk_order = order
+    this%erk_fsal = fsal
+    this%erk_errPrev = 1.0_prec
+
+  endsubroutine SetEmbeddedRKTableau
+
+  subroutine SetARKTableau(this,nstages)
+    !! Allocates the coefficients of an additive Runge-Kutta IMEX method, with the same
+    !! weights and stage times for the explicit and implicit parts. The coefficients are
+    !! set by the caller.
+    implicit none
+    class(Model),intent(inout) :: this
+    integer,intent(in) :: nstages
+
+    if(allocated(this%ark_ae)) deallocate(this%ark_ae,this%ark_ai,this%ark_b,this%ark_c)
+    allocate(this%ark_ae(1:nstages,1:nstages), &
+             this%ark_ai(1:nstages,1:nstages), &
+             this%ark_b(1:nstages), &
+             this%ark_c(1:nstages))
+
+    this%ark_ae = 0.0_prec
+    this%ark_ai = 0.0_prec
+    this%ark_nstages = nstages
+    this%nKrylovIterations = 0
+
+  endsubroutine SetARKTableau
+
+  subroutine SetAdamsBashforth(this,order)
+    !! Sets the order of the Adams-Bashforth method and clears the tendency history
+    implicit none
+    class(Model),intent(inout) :: this
+    integer,intent(in) :: order
+
+    this%ab_order = order
+    this%ab_nhistory = 0
+    this%ab_head = 0
+    this%lts_nhistory = 0
+    this%lts_head = 0
+
+  endsubroutine SetAdamsBashforth
+
+  subroutine WriteABState_Model(this,fileId)
+    !! Writes the position and step size of the Adams-Bashforth tendency history as
+    !! attributes of a pickup file. The history itself is written by the model.
+    implicit none
+    class(Model),intent(in) :: this
+    integer(HID_T),intent(in) :: fileId
+
+    call WriteAttribute_HDF5(fileId,'ab_order',this%ab_order)
+    call WriteAttribute_HDF5(fileId,'ab_nhistory',this%ab_nhistory)
+    call WriteAttribute_HDF5(fileId,'ab_head',this%ab_head)
+    call WriteAttribute_HDF5(fileId,'ab_dt',this%ab_dt)
+
+  endsubroutine WriteABState_Model
+
+  function ReadABState_Model(this,fileId) result(found)
+    !! Reads the state of the Adams-Bashforth tendency history from a pickup file.
+    !! Returns true when the file holds a history for the current Adams-Bashforth order,
+    !! in which case the model should read the history; otherwise the history is cleared.
+    implicit none
+    class(Model),intent(inout) :: this
+    integer(HID_T),intent(in) :: fileId
+    logical :: found
+    ! Local
+    integer :: order,error
+
+    found = .false.
+    this%ab_nhistory = 0
+    if(this%ab_order == 0) return
+
+    call h5aexists_f(fileId,'ab_order',found,error)
+    if(.not. found) return
+
+    call ReadAttribute_HDF5(fileId,'ab_order',order)
+    found = (order == this%ab_order)
+    if(found) then
+      call ReadAttribute_HDF5(fileId,'ab_nhistory',this%ab_nhistory)
+      call ReadAttribute_HDF5(fileId,'ab_head',this%ab_head)
+      call ReadAttribute_HDF5(fileId,'ab_dt',this%ab_dt)
+    endif
+
+  endfunction ReadABState_Model
+
   subroutine GetSimulationTime(this,t)
     !! Returns the current simulation time stored in the model % t attribute
     implicit none
@@ -738,6 +1600,17 @@ contains
     return
   endsubroutine ReportMetrics_Model
 
+  subroutine WriteXDMF_Model(this,filename)
+    !! Base method for writing the visualization output in HDF5, with an XDMF
+    !! description. Models that do not override it write nothing.
+    implicit none
+    class(Model),intent(inout) :: this
+    character(*),intent(in),optional :: filename
+
+    print*,__FILE__//" : XDMF output is not available for this model."
+
+  endsubroutine WriteXDMF_Model
+
   subroutine ReportUserMetrics_Model(this)
     !! Method that can be overridden by users to
     !! report their own custom metrics after file io
@@ -760,6 +1633,9 @@ contains
   !!
   !! If ioInterval is provided, file IO will be conducted every ioInterval seconds until tn
   !! is reached
+  !!
+  !! If this % cfl is positive, the time step size is recomputed with ComputeStableDt at the
+  !! start of every IO interval in place of dt
     implicit none
     class(Model),intent(inout) :: this
     real(prec),intent(in) :: tn
@@ -776,12 +1652,16 @@ contains
     this%dt = dt
     targetTime = tn
 
-    write(ntimesteps,"(I10)") int(ioInterval/this%dt)
     nIO = int((targetTime-this%t)/ioInterval)
     do i = 1,nIO
 
       tNext = this%t+ioInterval
 
+      if(this%cfl > 0.0_prec) then
+        this%dt = this%ComputeStableDt(this%cfl)
+      endif
+      write(ntimesteps,"(I10)") int(ioInterval/this%dt)
+
       TIMER(t1) ! See SELF_Macros.h for TIMER selection
       call this%timeIntegrator(tNext)
       TIMER(t2)
@@ -828,7 +1708,9 @@ contains
       call this%ReportMetrics()
 
       call this%WriteModel()
-      if(this%tecplot_enabled) then
+      if(this%xdmf_enabled) then
+        call this%WriteXDMF()
+      elseif(this%tecplot_enabled) then
         call this%WriteTecplot()
       endif
       call this%IncrementIOCounter()
@@ -877,7 +1759,7 @@ contains
       tRemain = tn-this%t
       this%dt = min(dtLim,tRemain)
       do m = 1,2
-        call this%CalculateTendency()
+        call this%CalculateFluxDivergence()
         call this%UpdateGRK2(m)
         this%t = t0+rk2_b(m)*this%dt
       enddo
@@ -907,7 +1789,7 @@ contains
       tRemain = tn-this%t
       this%dt = min(dtLim,tRemain)
       do m = 1,3
-        call this%CalculateTendency()
+        call this%CalculateFluxDivergence()
         call this%UpdateGRK3(m)
         this%t = t0+rk3_b(m)*this%dt
       enddo
@@ -937,7 +1819,7 @@ contains
       tRemain = tn-this%t
       this%dt = min(dtLim,tRemain)
       do m = 1,5
-        call this%CalculateTendency()
+        call this%CalculateFluxDivergence()
         call this%UpdateGRK4(m)
         this%t = t0+rk4_b(m)*this%dt
       enddo
@@ -950,4 +1832,969 @@ contains
 
   endsubroutine LowStorageRK4_timeIntegrator
 
+  subroutine LowStorageRK_timeIntegrator(this,tn)
+    !! 2N-storage Runge-Kutta integration with the coefficient table set by SetLowStorageRKTableau
+    implicit none
+    class(Model),intent(inout) :: this
+    real(prec),intent(in) :: tn
+    ! Local
+    integer :: m
+    real(prec) :: tRemain
+    real(prec) :: dtLim
+    real(prec) :: t0
+
+    dtLim = this%dt ! Get the max time step size from the dt attribute
+    do while(this%t < tn)
+
+      t0 = this%t
+      tRemain = tn-this%t
+      this%dt = min(dtLim,tRemain)
+      do m = 1,this%lsrk_nstages
+        this%t = t0+this%lsrk_b(m)*this%dt
+        call this%CalculateFluxDivergence()
+        call this%UpdateGLSRK(m)
+      enddo
+
+      this%t = t0+this%dt
+
+    enddo
+
+    this%dt = dtLim
+
+  endsubroutine LowStorageRK_timeIntegrator
+
+  subroutine EmbeddedRK_timeIntegrator(this,tn)
+    !! Adaptive time integration with the embedded Runge-Kutta pair set by SetTimeIntegrator.
+    !!
+    !! The current value of this % dt is the size of the first step attempt. After each step,
+    !! the difference between the two solutions of the pair is measured with ERKErrorNorm;
+    !! steps with an error norm larger than one are rejected and retried from the start of the
+    !! step with a smaller step size. The size of the next step is set by a PI controller, and
+    !! is left in this % dt on exit so that it carries over to the next call.
+    implicit none
+    class(Model),intent(inout) :: this
+    real(prec),intent(in) :: tn
+    ! Local
+    integer :: m
+    real(prec) :: t0
+    real(prec) :: dt
+    real(prec) :: err
+    real(prec) :: fac
+    real(prec) :: k
+    logical :: lastStep
+    logical :: fsalValid
+    logical :: retry
+
+    k = real(this%erk_order+1,prec)
+    fsalValid = .false.
+    retry = .false.
+    do while(this%t < tn)
+
+      t0 = this%t
+      dt = this%dt
+      lastStep = (t0+dt >= tn)
+      if(lastStep) dt = tn-t0
+
+      ! After a rejected step, slots 0 and 1 still hold the solution
+      ! and tendency at t0
+      if(.not. retry) then
+        call this%StoreERKStage(0)
+        if(.not. fsalValid) call this%CalculateTendency()
+        call this%StoreERKStage(1)
+      endif
+
+      do m = 2,this%erk_nstages
+        call this%UpdateERK(dt*this%erk_a(m,1:m-1))
+        this%t = t0+this%erk_c(m)*dt
+        call this%CalculateTendency()
+        call this%StoreERKStage(m)
+      enddo
+
+      ! With first-same-as-last pairs, the last stage is evaluated at the new solution
+      if(.not. this%erk_fsal) call this%UpdateERK(dt*this%erk_b)
+
+      err = this%ERKErrorNorm(dt*(this%erk_b-this%erk_bhat))
+
+      if(err <= 1.0_prec) then
+
+        this%t = t0+dt
+        this%nAcceptedSteps = this%nAcceptedSteps+1
+        fsalValid = this%erk_fsal
+        retry = .false.
+
+        err = max(err,erk_errmin)
+        fac = erk_safety*err**(-erk_beta1/k)*this%erk_errPrev**(erk_beta2/k)
+        fac = min(erk_facmax,max(erk_facmin,fac))
+        this%erk_errPrev = err
+
+        if(lastStep .and. dt < this%dt) then
+          ! The step was shortened to land on tn; keep the larger of the two step sizes
+          this%dt = max(this%dt,fac*dt)
+        else
+          this%dt = fac*dt
+        endif
+
+      else
+
+        call this%UpdateERK(this%erk_b(1:0))
+        this%t = t0
+        this%nRejectedSteps = this%nRejectedSteps+1
+        retry = .true.
+
+        fac = max(erk_facmin,erk_safety*err**(-1.0_prec/k))
+        this%dt = fac*dt
+
+        if(this%dt <= 10.0_prec*epsilon(1.0_prec)*max(abs(t0),1.0_prec)) then
+          print*,__FILE__//" : Adaptive time step size underflow at t = ",t0
+          stop 1
+        endif
+
+      endif
+
+    enddo
+
+  endsubroutine EmbeddedRK_timeIntegrator
+
+  subroutine AdamsBashforth_timeIntegrator(this,tn)
+    !! Adams-Bashforth time integration, with the order set by SetTimeIntegrator.
+    !!
+    !! Each step evaluates the tendency once and stores it in the history ring buffer with
+    !! UpdateGAB, which also replaces dSdt with the Adams-Bashforth combination of the stored
+    !! tendencies. Until the history holds ab_order tendencies, steps are taken with the low
+    !! storage rk3 method, reusing the stored tendency as its first stage. The local error of
+    !! these few steps is O(dt^4), which keeps the global order of all three methods.
+    !!
+    !! The history is only valid for steps of equal size. When the step size changes by more
+    !! than ab_steptol (e.g. the last step before tn, or a new dt set through ForwardStep), the
+    !! history is cleared and the method restarts.
+    implicit none
+    class(Model),intent(inout) :: this
+    real(prec),intent(in) :: tn
+    ! Local
+    integer :: m,j,slot
+    real(prec) :: tRemain
+    real(prec) :: dtLim
+    real(prec) :: t0
+    real(prec) :: w(1:this%ab_order)
+    logical :: lastStep
+
+    dtLim = this%dt ! Get the max time step size from the dt attribute
+    do while(this%t < tn)
+
+      t0 = this%t
+      tRemain = tn-this%t
+      ! Steps within ab_steptol of dtLim are stretched to land on tn
+      lastStep = (tRemain <= (1.0_prec+ab_steptol)*dtLim)
+      if(lastStep) then
+        this%dt = tRemain
+      else
+        this%dt = dtLim
+      endif
+
+      if(abs(this%dt-this%ab_dt) > ab_steptol*this%dt) then
+        this%ab_nhistory = 0
+        this%ab_dt = this%dt
+      endif
+
+      call this%CalculateTendency()
+
+      this%ab_head = mod(this%ab_head+1,this%ab_order)
+      this%ab_nhistory = min(this%ab_nhistory+1,this%ab_order)
+
+      if(this%ab_nhistory < this%ab_order) then
+
+        ! Store the tendency and leave dSdt unchanged
+        w = 0.0_prec
+        w(this%ab_head+1) = 1.0_prec
+        call this%UpdateGAB(w)
+
+        do m = 1,3
+          if(m > 1) call this%CalculateTendency()
+          call this%UpdateGRK3(m)
+          this%t = t0+rk3_b(m)*this%dt
+        enddo
+
+      else
+
+        ! Weights of the history slots, from the most recent tendency (j=1) to the oldest
+        do j = 1,this%ab_order
+          slot = mod(this%ab_head-j+1+this%ab_order,this%ab_order)
+          select case(this%ab_order)
+          case(2)
+            w(slot+1) = ab2_b(j)
+          case(3)
+            w(slot+1) = ab3_b(j)
+          case default
+            w(slot+1) = ab4_b(j)
+          endselect
+        enddo
+        call this%UpdateGAB(w)
+        call this%UpdateSolution()
+
+      endif
+
+      if(lastStep) then
+        this%t = tn
+      else
+        this%t = t0+this%dt
+      endif
+
+    enddo
+
+    this%dt = dtLim
+
+  endsubroutine AdamsBashforth_timeIntegrator
+
+  subroutine MultirateAB_timeIntegrator(this,tn)
+    !! Multirate Adams-Bashforth time integration, with the order set by SetTimeIntegrator
+    !! and the element rate levels set by SetMultirateLevels.
+    !!
+    !! Elements of rate level l take steps of size dt*2**l. Each macro step, of size
+    !! dt*2**(lts_nlevels-1), is divided into substeps of size dt. At the start of a substep
+    !! the tendency is evaluated and stored in the history of the levels whose step starts at
+    !! that time. The elements of these levels are the only ones whose flux and source are
+    !! computed. Every element is then moved to the end of the substep with the Adams-Bashforth
+    !! polynomial of its own level, integrated from the start of its step. Elements of a slower
+    !! level that neighbor a faster one, across a rank boundary or not, are thus exchanged with
+    !! a state of the same order of accuracy at every substep. The predicted state of each
+    !! element ends on its Adams-Bashforth step, so the method reduces to AdamsBashforth on a
+    !! single level.
+    !!
+    !! Until the history of the slowest level is filled, macro steps are taken with the low
+    !! storage rk3 method at the substep size on all elements, storing the tendency of the
+    !! first stage in the history of each level at its step times.
+    !!
+    !! As for AdamsBashforth, the history is cleared when the substep size changes, which
+    !! includes a shorter last macro step before tn. Choose IO intervals that are a multiple
+    !! of the macro step to avoid restarts.
+    implicit none
+    class(Model),intent(inout) :: this
+    real(prec),intent(in) :: tn
+    ! Local
+    integer :: m,j,k,l,slot,nsub,activeLevel
+    real(prec) :: tRemain
+    real(prec) :: dtLim
+    real(prec) :: t0
+    real(prec) :: c(1:this%ab_order)
+    real(prec) :: w(1:this%ab_order,0:this%lts_nlevels-1)
+    logical :: lastStep,bootstrap
+
+    nsub = 2**(this%lts_nlevels-1)
+    dtLim = this%dt ! Get the max time step size from the dt attribute
+    do while(this%t < tn)
+
+      t0 = this%t
+      tRemain = tn-this%t
+      ! Macro steps within ab_steptol of nsub*dtLim are stretched to land on tn
+      lastStep = (tRemain <= (1.0_prec+ab_steptol)*nsub*dtLim)
+      if(lastStep) then
+        this%dt = tRemain/real(nsub,prec)
+      else
+        this%dt = dtLim
+      endif
+
+      if(abs(this%dt-this%ab_dt) > ab_steptol*this%dt) then
+        this%lts_nhistory = 0
+        this%ab_dt = this%dt
+      endif
+
+      bootstrap = (this%lts_nhistory(this%lts_nlevels-1)+1 < this%ab_order)
+
+      do k = 0,nsub-1
+
+        ! Levels 0 through activeLevel start a step at this substep
+        activeLevel = 0
+        do while(activeLevel < this%lts_nlevels-1)
+          if(mod(k,2**(activeLevel+1)) /= 0) exit
+          activeLevel = activeLevel+1
+        enddo
+
+        this%t = t0+real(k,prec)*this%dt
+        if(.not. bootstrap) this%lts_activeLevel = activeLevel
+        call this%CalculateTendency()
+        this%lts_activeLevel = huge(1)
+
+        do l = 0,activeLevel
+          this%lts_head(l) = mod(this%lts_head(l)+1,this%ab_order)
+          this%lts_nhistory(l) = min(this%lts_nhistory(l)+1,this%ab_order)
+        enddo
+
+        ! Weights of the history slots of each level, for the fraction of its step
+        ! completed at the end of this substep
+        do l = 0,this%lts_nlevels-1
+          c = ABFractionalWeights(this%ab_order, &
+                                  real(mod(k,2**l)+1,prec)/real(2**l,prec))
+          do j = 1,this%ab_order
+            slot = mod(this%lts_head(l)-j+1+this%ab_order,this%ab_order)
+            w(slot+1,l) = c(j)*this%dt*real(2**l,prec)
+          enddo
+        enddo
+        call this%UpdateGMRAB(w,activeLevel,.not. bootstrap)
+
+        if(bootstrap) then
+          do m = 1,3
+            if(m > 1) call this%CalculateTendency()
+            call this%UpdateGRK3(m)
+            this%t = t0+(real(k,prec)+rk3_b(m))*this%dt
+          enddo
+        endif
+
+      enddo
+
+      if(lastStep) then
+        this%t = tn
+      else
+        this%t = t0+real(nsub,prec)*this%dt
+      endif
+
+    enddo
+
+    this%dt = dtLim
+
+  endsubroutine MultirateAB_timeIntegrator
+
+  subroutine IMEX_timeIntegrator(this,tn)
+    !! Additive Runge-Kutta IMEX time integration, with the coefficients set by SetTimeIntegrator.
+    !!
+    !! The tendency is split into an explicit part, the tendency evaluated with a zero solution
+    !! gradient (CalculateExplicitTendency), and an implicit part, the rest of the tendency.
+    !! For the advection-diffusion models, these are the advective and diffusive terms. Each
+    !! stage after the first solves
+    !!
+    !!   X - dt*ai(i,i)*I(X) = s + dt*sum_{j<i} ( ae(i,j)*E(X_j) + ai(i,j)*I(X_j) )
+    !!
+    !! for X with SolveIMEXStage. The explicit and implicit tendencies of the stages are kept
+    !! in vector slots 1..s and s+1..2s, with the solution at the start of the step in slot 0.
+    implicit none
+    class(Model),intent(inout) :: this
+    real(prec),intent(in) :: tn
+    ! Local
+    integer :: i,j,s
+    integer :: slots(1:2*this%ark_nstages+1)
+    real(prec) :: w(1:2*this%ark_nstages+1)
+    real(prec) :: tRemain
+    real(prec) :: dtLim
+    real(prec) :: t0
+
+    s = this%ark_nstages
+    this%imex_nvectors = 2*s+this%gmres_m+8
+    do j = 0,2*s
+      slots(j+1) = j
+    enddo
+
+    dtLim = this%dt ! Get the max time step size from the dt attribute
+    do while(this%t < tn)
+
+      t0 = this%t
+      tRemain = tn-this%t
+      this%dt = min(dtLim,tRemain)
+
+      call this%StoreIMEX(0,.false.)
+
+      ! The first stage is explicit
+      call this%EvaluateIMEXParts(0,1,s+1)
+
+      do i = 2,s
+        this%t = t0+this%ark_c(i)*this%dt
+        w(1) = 1.0_prec
+        w(2:i) = this%dt*this%ark_ae(i,1:i-1)
+        w(i+1:2*i-1) = this%dt*this%ark_ai(i,1:i-1)
+        call this%CombineIMEX(2*s+1,(/slots(1:i),slots(s+2:s+i)/),w(1:2*i-1))
+        call this%SolveIMEXStage(i)
+      enddo
+
+      w(1) = 1.0_prec
+      w(2:s+1) = this%dt*this%ark_b(1:s)
+      w(s+2:2*s+1) = this%dt*this%ark_b(1:s)
+      call this%CombineIMEX(0,slots,w)
+      call this%LoadIMEX(0)
+
+      this%t = t0+this%dt
+
+    enddo
+
+    this%dt = dtLim
+
+  endsubroutine IMEX_timeIntegrator
+
+  subroutine EvaluateIMEXParts(this,kx,ke,ki)
+    !! Sets the solution to vector slot kx and stores the explicit and implicit parts of the
+    !! tendency in slots ke and ki. On output, dSdt holds the full tendency.
+    implicit none
+    class(Model),intent(inout) :: this
+    integer,intent(in) :: kx
+    integer,intent(in) :: ke
+    integer,intent(in) :: ki
+
+    call this%LoadIMEX(kx)
+    call this%CalculateExplicitTendency()
+    call this%StoreIMEX(ke,.true.)
+    call this%CalculateTendency()
+    call this%StoreIMEX(ki,.true.)
+    call this%CombineIMEX(ki,(/ki,ke/),(/1.0_prec,-1.0_prec/))
+
+  endsubroutine EvaluateIMEXParts
+
+  subroutine SolveIMEXStage(this,i)
+    !! Solves X - g*I(X) = R for stage i of the IMEX method, with g = dt*ai(i,i) and R in vector
+    !! slot 2s+1. Newton iterations start from X = R, and each correction is computed with
+    !! GMRES_IMEX. The iterations stop when the residual is reduced by imex_tol, or reaches the
+    !! round off in R. On output, the explicit and implicit tendencies at X are in slots i and s+i.
+    implicit none
+    class(Model),intent(inout) :: this
+    integer,intent(in) :: i
+    ! Local
+    integer :: s,kRHS,kX,kRes,kd,iter
+    real(prec) :: g,rnorm,r0,rfloor
+
+    s = this%ark_nstages
+    kRHS = 2*s+1 ! Right hand side
+    kX = 2*s+2 ! Stage value
+    kRes = 2*s+3 ! Residual
+    kd = 2*s+4 ! Newton correction
+    g = this%dt*this%ark_ai(i,i)
+
+    call this%CombineIMEX(kX,(/kRHS/),(/1.0_prec/))
+    ! The residual cannot be reduced below the round off in the right hand side
+    rfloor = epsilon(1.0_prec)*sqrt(this%DotIMEX(kRHS,kRHS))
+    r0 = 0.0_prec
+    do iter = 1,imex_maxnewton
+
+      call this%EvaluateIMEXParts(kX,i,s+i)
+      call this%CombineIMEX(kRes,(/kRHS,kX,s+i/),(/1.0_prec,-1.0_prec,g/))
+      rnorm = sqrt(this%DotIMEX(kRes,kRes))
+      if(iter == 1) r0 = rnorm
+      if(rnorm <= max(this%imex_tol*r0,rfloor)) return
+
+      if(iter == imex_maxnewton) then
+        print*,__FILE__//" : Warning : implicit stage residual reduced by ",rnorm/r0, &
+          " after ",imex_maxnewton," Newton iterations"
+        return
+      endif
+
+      call this%GMRES_IMEX(kX,s+i,g,0.1_prec*this%imex_tol*r0/rnorm)
+      call this%CombineIMEX(kX,(/kX,kd/),(/1.0_prec,1.0_prec/))
+
+    enddo
+
+  endsubroutine SolveIMEXStage
+
+  subroutine GMRES_IMEX(this,kX,kIX,g,tol)
+    !! Restarted GMRES solution of (Id - g*J) d = r, where J is the Jacobian of the implicit part
+    !! of the tendency at the stage value in vector slot kX, r is in slot 2s+3 and d is returned in
+    !! slot 2s+4. The implicit tendency at the stage value is in slot kIX. Products with J are
+    !! approximated by finite differences of the implicit tendency, so no matrix is formed. The
+    !! iterations stop when the residual is reduced by tol or after gmres_maxiter iterations.
+    implicit none
+    class(Model),intent(inout) :: this
+    integer,intent(in) :: kX
+    integer,intent(in) :: kIX
+    real(prec),intent(in) :: g
+    real(prec),intent(in) :: tol
+    ! Local
+    integer :: s,m,kRes,kd,kY,kIY,kV,i,j,nk,total
+    real(prec) :: H(1:this%gmres_m+1,1:this%gmres_m)
+    real(prec) :: cs(1:this%gmres_m),sn(1:this%gmres_m)
+    real(prec) :: gv(1:this%gmres_m+1),y(1:this%gmres_m)
+    real(prec) :: bnorm,beta,xnorm,tmp
+    integer :: slots(1:this%gmres_m+1)
+
+    s = this%ark_nstages
+    m = this%gmres_m
+    kRes = 2*s+3 ! Right hand side
+    kd = 2*s+4 ! Solution
+    kY = 2*s+5 ! Perturbed stage value
+    kIY = 2*s+6 ! Implicit tendency at the perturbed stage value
+    kV = 2*s+7 ! First vector of the Krylov basis
+    do j = 1,m+1
+      slots(j) = kV+j-1
+    enddo
+
+    call this%CombineIMEX(kd,(/kRes/),(/0.0_prec/))
+    bnorm = sqrt(this%DotIMEX(kRes,kRes))
+    if(bnorm == 0.0_prec) return
+    xnorm = sqrt(this%DotIMEX(kX,kX))
+
+    total = 0
+    beta = bnorm
+    call this%CombineIMEX(kV,(/kRes/),(/1.0_prec/beta/))
+    do while(total < this%gmres_maxiter)
+
+      gv = 0.0_prec
+      gv(1) = beta
+      nk = 0
+      do j = 1,m
+
+        call MatVec(kV+j-1,kV+j)
+        ! Modified Gram-Schmidt
+        do i = 1,j
+          H(i,j) = this%DotIMEX(kV+j,kV+i-1)
+          call this%CombineIMEX(kV+j,(/kV+j,kV+i-1/),(/1.0_prec,-H(i,j)/))
+        enddo
+        H(j+1,j) = sqrt(this%DotIMEX(kV+j,kV+j))
+        if(H(j+1,j) > 0.0_prec) call this%CombineIMEX(kV+j,(/kV+j/),(/1.0_prec/H(j+1,j)/))
+
+        ! Givens rotations reduce H to upper triangular form
+        do i = 1,j-1
+          tmp = cs(i)*H(i,j)+sn(i)*H(i+1,j)
+          H(i+1,j) = -sn(i)*H(i,j)+cs(i)*H(i+1,j)
+          H(i,j) = tmp
+        enddo
+        tmp = sqrt(H(j,j)**2+H(j+1,j)**2)
+        cs(j) = H(j,j)/tmp
+        sn(j) = H(j+1,j)/tmp
+        H(j,j) = tmp
+        H(j+1,j) = 0.0_prec
+        gv(j+1) = -sn(j)*gv(j)
+        gv(j) = cs(j)*gv(j)
+
+        nk = j
+        total = total+1
+        if(abs(gv(j+1)) <= tol*bnorm .or. total >= this%gmres_maxiter) exit
+
+      enddo
+
+      ! Update the solution with the least squares solution in the Krylov basis
+      do i = nk,1,-1
+        y(i) = (gv(i)-dot_product(H(i,i+1:nk),y(i+1:nk)))/H(i,i)
+      enddo
+      call this%CombineIMEX(kd,(/kd,slots(1:nk)/),(/1.0_prec,y(1:nk)/))
+
+      if(abs(gv(nk+1)) <= tol*bnorm) exit
+
+      ! Restart from the residual r - A d
+      call MatVec(kd,kV)
+      call this%CombineIMEX(kV,(/kRes,kV/),(/1.0_prec,-1.0_prec/))
+      beta = sqrt(this%DotIMEX(kV,kV))
+      if(beta == 0.0_prec) exit
+      call this%CombineIMEX(kV,(/kV/),(/1.0_prec/beta/))
+
+    enddo
+
+    this%nKrylovIterations = this%nKrylovIterations+total
+
+  contains
+
+    subroutine MatVec(kin,kout)
+      !! Sets slot kout to (Id - g*J) applied to slot kin, with J*v approximated by
+      !! ( I(X + eps*v) - I(X) )/eps
+      integer,intent(in) :: kin
+      integer,intent(in) :: kout
+      ! Local
+      real(prec) :: vnorm,eps
+
+      vnorm = sqrt(this%DotIMEX(kin,kin))
+      if(vnorm == 0.0_prec) then
+        call this%CombineIMEX(kout,(/kin/),(/0.0_prec/))
+        return
+      endif
+      eps = sqrt(epsilon(1.0_prec))*(1.0_prec+xnorm)/vnorm
+      call this%CombineIMEX(kY,(/kX,kin/),(/1.0_prec,eps/))
+      ! The explicit tendency is not needed and is stored in kout until it is overwritten
+      call this%EvaluateIMEXParts(kY,kout,kIY)
+      call this%CombineIMEX(kout,(/kin,kIY,kIX/),(/1.0_prec,-g/eps,g/eps/))
+
+    endsubroutine MatVec
+
+  endsubroutine GMRES_IMEX
+
+  subroutine EstimateSpectrum(this,lambda,nk)
+    !! Estimates the eigenvalues of the Jacobian of the tendency at the current solution, with
+    !! nk (default 40) Arnoldi iterations started from a random state. On output, lambda holds
+    !! the Ritz values, which approximate the eigenvalues at the edge of the spectrum. More
+    !! iterations resolve more of the edge, at the cost of nk+5 solution-sized work vectors.
+    !!
+    !! Products with the Jacobian are approximated by finite differences of CalculateTendency,
+    !! so for the linear models the Ritz values approximate the eigenvalues of the
+    !! semi-discrete operator. The IMEX vector slots are used as work space; the solution and
+    !! model time are unchanged on output, but dSdt is overwritten.
+    implicit none
+    class(Model),intent(inout) :: this
+    complex(prec),allocatable,intent(out) :: lambda(:)
+    integer,optional,intent(in) :: nk
+    ! Local
+    integer :: m,n,i,j,kV
+    real(prec),allocatable :: H(:,:)
+    complex(prec),allocatable :: Hc(:,:)
+    real(prec) :: xnorm,beta,eps
+
+    m = 40
+    if(present(nk)) m = nk
+    ! Slot 0 holds the solution, slot 1 its tendency, slots 2 and 3 the perturbed solution
+    ! and its tendency, and slots 4.. the Arnoldi basis
+    this%imex_nvectors = m+5
+    kV = 4
+
+    call this%StoreIMEX(0,.false.)
+    call this%CalculateTendency()
+    call this%StoreIMEX(1,.true.)
+    xnorm = sqrt(this%DotIMEX(0,0))
+
+    call this%RandomIMEX(kV)
+    beta = sqrt(this%DotIMEX(kV,kV))
+    call this%CombineIMEX(kV,(/kV/),(/1.0_prec/beta/))
+
+    allocate(H(1:m+1,1:m))
+    H = 0.0_prec
+    n = m
+    eps = sqrt(epsilon(1.0_prec))*(1.0_prec+xnorm)
+    do j = 1,m
+
+      ! J*v is approximated by ( T(s + eps*v) - T(s) )/eps, with |v| = 1
+      call this%CombineIMEX(2,(/0,kV+j-1/),(/1.0_prec,eps/))
+      call this%LoadIMEX(2)
+      call this%CalculateTendency()
+      call this%StoreIMEX(3,.true.)
+      call this%CombineIMEX(kV+j,(/3,1/),(/1.0_prec/eps,-1.0_prec/eps/))
+
+      ! Modified Gram-Schmidt
+      do i = 1,j
+        H(i,j) = this%DotIMEX(kV+j,kV+i-1)
+        call this%CombineIMEX(kV+j,(/kV+j,kV+i-1/),(/1.0_prec,-H(i,j)/))
+      enddo
+      H(j+1,j) = sqrt(this%DotIMEX(kV+j,kV+j))
+
+      ! The basis spans an invariant subspace, to the accuracy of the finite differences
+      if(H(j+1,j) <= sqrt(epsilon(1.0_prec))*maxval(abs(H(1:j,1:j)))) then
+        n = j
+        exit
+      endif
+      call this%CombineIMEX(kV+j,(/kV+j/),(/1.0_prec/H(j+1,j)/))
+
+    enddo
+
+    call this%LoadIMEX(0)
+
+    allocate(Hc(1:n,1:n),lambda(1:n))
+    Hc = cmplx(H(1:n,1:n),0.0_prec,prec)
+    call HessenbergEigenvalues(Hc,lambda)
+    deallocate(H,Hc)
+
+  endsubroutine EstimateSpectrum
+
+  function EstimateSpectralRadius(this,nk) result(rho)
+    !! Returns the largest magnitude of the Ritz values from EstimateSpectrum
+    implicit none
+    class(Model),intent(inout) :: this
+    integer,optional,intent(in) :: nk
+    real(prec) :: rho
+    ! Local
+    complex(prec),allocatable :: lambda(:)
+
+    call this%EstimateSpectrum(lambda,nk)
+    rho = maxval(abs(lambda))
+    deallocate(lambda)
+
+  endfunction EstimateSpectralRadius
+
+  function EstimateStableDt(this,safety,nk) result(dt)
+    !! Returns safety (default 0.95) times the largest time step size for which dt*lambda is
+    !! in the stability region of the time integrator, for each Ritz value lambda from
+    !! EstimateSpectrum.
+    !!
+    !! The stability region is traced along the ray from the origin through each dt*lambda,
+    !! with AmplificationFactor. Ritz values with positive real parts, which the operator of a
+    !! stable semi-discretization does not have, are moved onto the imaginary axis.
+    implicit none
+    class(Model),intent(inout) :: this
+    real(prec),optional,intent(in) :: safety
+    integer,optional,intent(in) :: nk
+    real(prec) :: dt
+    ! Local
+    complex(prec),allocatable :: lambda(:)
+    complex(prec) :: z
+    real(prec) :: f,rmax,r,r0,r1
+    integer :: i,k
+    real(prec),parameter :: dr = 0.01_prec ! Step size of the search along each ray
+    real(prec),parameter :: rlim = 100.0_prec ! Largest scaled step size searched
+    real(prec),parameter :: gtol = 1.0e-8_prec ! Growth tolerated by the amplification factor
+
+    f = 0.95_prec
+    if(present(safety)) f = safety
+
+    call this%EstimateSpectrum(lambda,nk)
+    rmax = maxval(abs(lambda))
+
+    dt = huge(1.0_prec)
+    do i = 1,size(lambda)
+
+      z = cmplx(min(real(lambda(i),prec),0.0_prec),aimag(lambda(i)),prec)
+      if(abs(z) <= epsilon(1.0_prec)*rmax) cycle
+      z = z/abs(z)
+
+      ! Find the first step along the ray that is outside the stability region, then
+      ! refine the crossing by bisection
+      r0 = 0.0_prec
+      r1 = rlim
+      do k = 1,int(rlim/dr)
+        r = real(k,prec)*dr
+        if(this%AmplificationFactor(r*z) > 1.0_prec+gtol) then
+          r0 = r-dr
+          r1 = r
+          exit
+        endif
+      enddo
+      if(r1 < rlim) then
+        do k = 1,50
+          r = 0.5_prec*(r0+r1)
+          if(this%AmplificationFactor(r*z) > 1.0_prec+gtol) then
+            r1 = r
+          else
+            r0 = r
+          endif
+        enddo
+      endif
+
+      dt = min(dt,r0/abs(cmplx(min(real(lambda(i),prec),0.0_prec),aimag(lambda(i)),prec)))
+
+    enddo
+    dt = f*dt
+
+    deallocate(lambda)
+
+  endfunction EstimateStableDt
+
+  function AmplificationFactor(this,z) result(g)
+    !! Returns the magnitude of the amplification factor of one step of the time integrator
+    !! for ds/dt = lambda*s, with z = lambda*dt. For the Adams-Bashforth methods, this is the
+    !! largest magnitude of the roots of the characteristic polynomial. The multirate methods
+    !! use the Adams-Bashforth method of the same order, which is the limit for the elements
+    !! of rate level 0.
+    implicit none
+    class(Model),intent(inout) :: this
+    complex(prec),intent(in) :: z
+    real(prec) :: g
+    ! Local
+    integer :: i,j,p
+    complex(prec) :: y,w
+    complex(prec),allocatable :: k(:),C(:,:),roots(:)
+    real(prec) :: b(1:4)
+
+    if(associated(this%timeIntegrator,Euler_timeIntegrator)) then
+      g = abs(1.0_prec+z)
+
+    elseif(associated(this%timeIntegrator,LowStorageRK2_timeIntegrator)) then
+      g = abs(LowStorageRKFactor(rk2_a,rk2_g,z))
+
+    elseif(associated(this%timeIntegrator,LowStorageRK3_timeIntegrator)) then
+      g = abs(LowStorageRKFactor(rk3_a,rk3_g,z))
+
+    elseif(associated(this%timeIntegrator,LowStorageRK4_timeIntegrator)) then
+      g = abs(LowStorageRKFactor(rk4_a,rk4_g,z))
+
+    elseif(associated(this%timeIntegrator,LowStorageRK_timeIntegrator)) then
+      g = abs(LowStorageRKFactor(this%lsrk_a,this%lsrk_g,z))
+
+    elseif(associated(this%timeIntegrator,EmbeddedRK_timeIntegrator)) then
+      allocate(k(1:this%erk_nstages))
+      y = 1.0_prec
+      do i = 1,this%erk_nstages
+        w = 1.0_prec
+        do j = 1,i-1
+          w = w+this%erk_a(i,j)*k(j)
+        enddo
+        k(i) = z*w
+        y = y+this%erk_b(i)*k(i)
+      enddo
+      g = abs(y)
+      deallocate(k)
+
+    elseif(associated(this%timeIntegrator,AdamsBashforth_timeIntegrator) .or. &
+           associated(this%timeIntegrator,MultirateAB_timeIntegrator)) then
+      p = this%ab_order
+      select case(p)
+      case(2)
+        b(1:2) = ab2_b
+      case(3)
+        b(1:3) = ab3_b
+      case default
+        b(1:4) = ab4_b
+      endselect
+      ! Companion matrix of x**p - (1 + z*b(1))*x**(p-1) - z*sum_{j>1} b(j)*x**(p-j)
+      allocate(C(1:p,1:p),roots(1:p))
+      C = 0.0_prec
+      C(1,1) = 1.0_prec+z*b(1)
+      do j = 2,p
+        C(1,j) = z*b(j)
+        C(j,j-1) = 1.0_prec
+      enddo
+      call HessenbergEigenvalues(C,roots)
+      g = maxval(abs(roots))
+      deallocate(C,roots)
+
+    else
+      print*,__FILE__//" : The amplification factor is not available for the selected time integrator"
+      stop 1
+    endif
+
+  endfunction AmplificationFactor
+
+  function LowStorageRKFactor(rk_a,rk_g,z) result(y)
+    !! Returns the amplification factor of the 2N-storage Runge-Kutta method with the
+    !! coefficients rk_a and rk_g for ds/dt = lambda*s, with z = lambda*dt
+    implicit none
+    real(prec),intent(in) :: rk_a(:)
+    real(prec),intent(in) :: rk_g(:)
+    complex(prec),intent(in) :: z
+    complex(prec) :: y
+    ! Local
+    integer :: m
+    complex(prec) :: w
+
+    y = 1.0_prec
+    w = 0.0_prec
+    do m = 1,size(rk_a)
+      w = rk_a(m)*w+z*y
+      y = y+rk_g(m)*w
+    enddo
+
+  endfunction LowStorageRKFactor
+
+  subroutine HessenbergEigenvalues(A,lambda)
+    !! Computes the eigenvalues of the upper Hessenberg matrix A with the shifted QR algorithm,
+    !! using Wilkinson shifts and deflation. A is overwritten.
+    implicit none
+    complex(prec),intent(inout) :: A(:,:)
+    complex(prec),intent(out) :: lambda(:)
+    ! Local
+    integer :: n,lo,hi,k,j,iter
+    complex(prec) :: mu,disc,e1,e2,t1,t2
+    complex(prec),allocatable :: cs(:),sn(:)
+    real(prec) :: r
+
+    n = size(A,1)
+    allocate(cs(1:n),sn(1:n))
+    hi = n
+    iter = 0
+    do while(hi >= 1)
+
+      ! Find the start of the unreduced block that ends at row hi
+      lo = hi
+      do while(lo > 1)
+        if(abs(A(lo,lo-1)) <= epsilon(1.0_prec)*(abs(A(lo,lo))+abs(A(lo-1,lo-1)))) then
+          A(lo,lo-1) = 0.0_prec
+          exit
+        endif
+        lo = lo-1
+      enddo
+
+      if(lo == hi .or. iter > 30) then
+        lambda(hi) = A(hi,hi)
+        hi = hi-1
+        iter = 0
+        cycle
+      endif
+      iter = iter+1
+
+      ! The shift is the eigenvalue of the trailing 2x2 block closest to A(hi,hi)
+      disc = sqrt(0.25_prec*(A(hi-1,hi-1)-A(hi,hi))**2+A(hi-1,hi)*A(hi,hi-1))
+      e1 = 0.5_prec*(A(hi-1,hi-1)+A(hi,hi))+disc
+      e2 = 0.5_prec*(A(hi-1,hi-1)+A(hi,hi))-disc
+      if(abs(e1-A(hi,hi)) < abs(e2-A(hi,hi))) then
+        mu = e1
+      else
+        mu = e2
+      endif
+      if(mod(iter,10) == 0) mu = A(hi,hi)+abs(A(hi,hi-1)) ! Exceptional shift
+
+      ! QR step on the block, with Givens rotations
+      do k = lo,hi
+        A(k,k) = A(k,k)-mu
+      enddo
+      do k = lo,hi-1
+        r = sqrt(abs(A(k,k))**2+abs(A(k+1,k))**2)
+        if(r > 0.0_prec) then
+          cs(k) = A(k,k)/r
+          sn(k) = A(k+1,k)/r
+        else
+          cs(k) = 1.0_prec
+          sn(k) = 0.0_prec
+        endif
+        do j = k,hi
+          t1 = A(k,j)
+          t2 = A(k+1,j)
+          A(k,j) = conjg(cs(k))*t1+conjg(sn(k))*t2
+          A(k+1,j) = -sn(k)*t1+cs(k)*t2
+        enddo
+      enddo
+      do k = lo,hi-1
+        do j = lo,min(k+2,hi)
+          t1 = A(j,k)
+          t2 = A(j,k+1)
+          A(j,k) = t1*cs(k)+t2*sn(k)
+          A(j,k+1) = -t1*conjg(sn(k))+t2*conjg(cs(k))
+        enddo
+      enddo
+      do k = lo,hi
+        A(k,k) = A(k,k)+mu
+      enddo
+
+    enddo
+
+    deallocate(cs,sn)
+
+  endsubroutine HessenbergEigenvalues
+
+  function ABFractionalWeights(order,theta) result(c)
+    !! Returns the integrals from 0 to theta of the Lagrange polynomials through the
+    !! history times x = 0,-1,...,1-order, with c(j) for the polynomial that is one at
+    !! x = 1-j. For theta = 1, these are the Adams-Bashforth coefficients.
+    implicit none
+    integer,intent(in) :: order
+    real(prec),intent(in) :: theta
+    real(prec) :: c(1:order)
+    ! Local
+    integer :: i,j,m,deg
+    real(prec) :: poly(0:order-1)
+    real(prec) :: xm,denom
+
+    do j = 1,order
+      poly = 0.0_prec
+      poly(0) = 1.0_prec
+      deg = 0
+      denom = 1.0_prec
+      do m = 1,order
+        if(m == j) cycle
+        xm = real(1-m,prec)
+        ! Multiply the polynomial by (x - xm)
+        do i = deg+1,1,-1
+          poly(i) = poly(i-1)-xm*poly(i)
+        enddo
+        poly(0) = -xm*poly(0)
+        deg = deg+1
+        denom = denom*(real(1-j,prec)-xm)
+      enddo
+      c(j) = 0.0_prec
+      do i = 0,deg
+        c(j) = c(j)+poly(i)*theta**(i+1)/real(i+1,prec)
+      enddo
+      c(j) = c(j)/denom
+    enddo
+
+  endfunction ABFractionalWeights
+
+  pure subroutine NextActiveRun(rateLevel,activeLevel,e1,e2)
+    !! Finds the next contiguous range of elements e1:e2 with rateLevel <= activeLevel,
+    !! searching forward from the input value of e1. The DGModel classes use this to call
+    !! the batched flux and source functions on blocks of nodes that are contiguous in
+    !! memory. On output, e1 > size(rateLevel) when no active elements remain.
+    implicit none
+    integer,intent(in) :: rateLevel(:)
+    integer,intent(in) :: activeLevel
+    integer,intent(inout) :: e1
+    integer,intent(out) :: e2
+
+    do while(e1 <= size(rateLevel))
+      if(rateLevel(e1) <= activeLevel) exit
+      e1 = e1+1
+    enddo
+
+    e2 = e1
+    do while(e2 < size(rateLevel))
+      if(rateLevel(e2+1) > activeLevel) exit
+      e2 = e2+1
+    enddo
+
+  endsubroutine NextActiveRun
+
 endmodule SELF_Model
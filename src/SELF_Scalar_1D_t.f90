@@ -205,11 +205,12 @@ contains
 
   endsubroutine Derivative_Scalar1D_t
 
-  subroutine WriteHDF5_Scalar1D_t(this,fileId,group)
+  subroutine WriteHDF5_Scalar1D_t(this,fileId,group,storage)
     implicit none
     class(Scalar1D_t),intent(in) :: this
     integer(HID_T),intent(in) :: fileId
     character(*),intent(in) :: group
+    type(HDF5StoragePolicy),optional,intent(in) :: storage
     ! Local
     integer :: ivar
 
@@ -220,10 +221,10 @@ contains
     enddo
 
     call WriteArray_HDF5(fileId,trim(group)//"/interior", &
-                         this%interior)
+                         this%interior,storage=storage)
 
     call WriteArray_HDF5(fileId,trim(group)//"/boundary", &
-                         this%boundary)
+                         this%boundary,storage=storage)
 
   endsubroutine WriteHDF5_Scalar1D_t
 
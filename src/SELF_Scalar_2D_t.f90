@@ -177,23 +177,8 @@ contains
     implicit none
     class(Scalar2D_t),intent(in) :: this
     real(prec),intent(inout) :: f(1:this%M+1,1:this%M+1,1:this%nelem,1:this%nvar)
-    ! Local
-    integer :: i,j,ii,jj,iel,ivar
-    real(prec) :: fi,fij
-
-    do concurrent(i=1:this%M+1,j=1:this%M+1,iel=1:this%nElem,ivar=1:this%nVar)
-
-      fij = 0.0_prec
-      do jj = 1,this%N+1
-        fi = 0.0_prec
-        do ii = 1,this%N+1
-          fi = fi+this%interior(ii,jj,iel,ivar)*this%interp%iMatrix(ii,i)
-        enddo
-        fij = fij+fi*this%interp%iMatrix(jj,j)
-      enddo
-      f(i,j,iel,ivar) = fij
 
-    enddo
+    call this%interp%GridInterp_2D(this%interior,f,this%nelem*this%nvar)
 
   endsubroutine GridInterp_Scalar2D_t
 
@@ -218,13 +203,14 @@ contains
 
   endsubroutine Gradient_Scalar2D_t
 
-  subroutine WriteHDF5_MPI_Scalar2D_t(this,fileId,group,elemoffset,nglobalelem)
+  subroutine WriteHDF5_MPI_Scalar2D_t(this,fileId,group,elemoffset,nglobalelem,storage)
     implicit none
     class(Scalar2D_t),intent(in) :: this
     character(*),intent(in) :: group
     integer(HID_T),intent(in) :: fileId
     integer,intent(in) :: elemoffset
     integer,intent(in) :: nglobalelem
+    type(HDF5StoragePolicy),optional,intent(in) :: storage
     ! Local
     integer(HID_T) :: offset(1:3)
     integer(HID_T) :: globalDims(1:3)
@@ -241,16 +227,17 @@ contains
       !call this%meta(ivar)%WriteHDF5(group,ivar,fileId)
       call WriteArray_HDF5(fileId, &
                            trim(group)//"/"//trim(this%meta(ivar)%name), &
-                           this%interior(:,:,:,ivar),offset,globalDims)
+                           this%interior(:,:,:,ivar),offset,globalDims,storage=storage)
     enddo
 
   endsubroutine WriteHDF5_MPI_Scalar2D_t
 
-  subroutine WriteHDF5_Scalar2D_t(this,fileId,group)
+  subroutine WriteHDF5_Scalar2D_t(this,fileId,group,storage)
     implicit none
     class(Scalar2D_t),intent(in) :: this
     integer(HID_T),intent(in) :: fileId
     character(*),intent(in) :: group
+    type(HDF5StoragePolicy),optional,intent(in) :: storage
     ! Local
     integer :: ivar
 
@@ -260,7 +247,7 @@ contains
       call this%meta(ivar)%WriteHDF5(group,ivar,fileId)
       call WriteArray_HDF5(fileId, &
                            trim(group)//"/"//trim(this%meta(ivar)%name), &
-                           this%interior(:,:,:,ivar))
+                           this%interior(:,:,:,ivar),storage=storage)
     enddo
 
   endsubroutine WriteHDF5_Scalar2D_t
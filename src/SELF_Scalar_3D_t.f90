@@ -188,28 +188,8 @@ contains
     class(Scalar3D_t),intent(in) :: this
     real(prec),intent(out) :: f(1:this%M+1,1:this%M+1,1:this%M+1,1:this%nelem,1:this%nvar)
     !! (Output) Array of function values, defined on the target grid
-    ! Local
-    integer :: i,j,k,ii,jj,kk,iel,ivar
-    real(prec) :: fi,fij,fijk
-
-    do concurrent(i=1:this%M+1,j=1:this%M+1, &
-                  k=1:this%M+1,iel=1:this%nelem,ivar=1:this%nvar)
-
-      fijk = 0.0_prec
-      do kk = 1,this%N+1
-        fij = 0.0_prec
-        do jj = 1,this%N+1
-          fi = 0.0_prec
-          do ii = 1,this%N+1
-            fi = fi+this%interior(ii,jj,kk,iel,ivar)*this%interp%iMatrix(ii,i)
-          enddo
-          fij = fij+fi*this%interp%iMatrix(jj,j)
-        enddo
-        fijk = fijk+fij*this%interp%iMatrix(kk,k)
-      enddo
-      f(i,j,k,iel,ivar) = fijk
 
-    enddo
+    call this%interp%GridInterp_3D(this%interior,f,this%nelem*this%nvar)
 
   endsubroutine GridInterp_Scalar3D_t
 
@@ -240,13 +220,14 @@ contains
 
   endsubroutine Gradient_Scalar3D_t
 
-  subroutine WriteHDF5_MPI_Scalar3D_t(this,fileId,group,elemoffset,nglobalelem)
+  subroutine WriteHDF5_MPI_Scalar3D_t(this,fileId,group,elemoffset,nglobalelem,storage)
     implicit none
     class(Scalar3D_t),intent(in) :: this
     character(*),intent(in) :: group
     integer(HID_T),intent(in) :: fileId
     integer,intent(in) :: elemoffset
     integer,intent(in) :: nglobalelem
+    type(HDF5StoragePolicy),optional,intent(in) :: storage
     ! Local
     integer(HID_T) :: offset(1:4)
     integer(HID_T) :: globalDims(1:4)
@@ -264,16 +245,17 @@ contains
       !call this%meta(ivar)%WriteHDF5(group,ivar,fileId)
       call WriteArray_HDF5(fileId, &
                            trim(group)//"/"//trim(this%meta(ivar)%name), &
-                           this%interior(:,:,:,:,ivar),offset,globalDims)
+                           this%interior(:,:,:,:,ivar),offset,globalDims,storage=storage)
     enddo
 
   endsubroutine WriteHDF5_MPI_Scalar3D_t
 
-  subroutine WriteHDF5_Scalar3D_t(this,fileId,group)
+  subroutine WriteHDF5_Scalar3D_t(this,fileId,group,storage)
     implicit none
     class(Scalar3D_t),intent(in) :: this
     integer(HID_T),intent(in) :: fileId
     character(*),intent(in) :: group
+    type(HDF5StoragePolicy),optional,intent(in) :: storage
     ! Local
     integer :: ivar
 
@@ -283,7 +265,7 @@ contains
       call this%meta(ivar)%WriteHDF5(group,ivar,fileId)
       call WriteArray_HDF5(fileId, &
                            trim(group)//"/"//trim(this%meta(ivar)%name), &
-                           this%interior(:,:,:,:,ivar))
+                           this%interior(:,:,:,:,ivar),storage=storage)
     enddo
 
   endsubroutine WriteHDF5_Scalar3D_t
@@ -268,6 +268,98 @@ contains
     if(present(unit)) unit = newunit
   endfunction newunit
 
+  subroutine SortIndex(keys,perm,N)
+    !! Returns the permutation perm that sorts keys into ascending order, so that
+    !! keys(perm(1)) <= keys(perm(2)) <= ... <= keys(perm(N)). The keys are not modified.
+    !! A heap sort is used so that the cost is O(N log N) for any input ordering.
+    implicit none
+    integer,intent(in) :: N
+    integer(int64),intent(in) :: keys(1:N)
+    integer,intent(out) :: perm(1:N)
+    ! Local
+    integer :: i,last,tmp
+
+    do i = 1,N
+      perm(i) = i
+    enddo
+
+    ! Build a max-heap of the indices, ordered by key
+    do i = N/2,1,-1
+      call SiftDown(i,N)
+    enddo
+
+    ! Move the largest remaining key to the end of the unsorted range
+    do last = N,2,-1
+      tmp = perm(1)
+      perm(1) = perm(last)
+      perm(last) = tmp
+      call SiftDown(1,last-1)
+    enddo
+
+  contains
+
+    subroutine SiftDown(root,heapSize)
+      integer,intent(in) :: root
+      integer,intent(in) :: heapSize
+      ! Local
+      integer :: parent,child,tmp
+
+      parent = root
+      do while(2*parent <= heapSize)
+        child = 2*parent
+        if(child < heapSize) then
+          if(keys(perm(child+1)) > keys(perm(child))) child = child+1
+        endif
+        if(keys(perm(parent)) >= keys(perm(child))) return
+        tmp = perm(parent)
+        perm(parent) = perm(child)
+        perm(child) = tmp
+        parent = child
+      enddo
+
+    endsubroutine SiftDown
+
+  endsubroutine SortIndex
+
+  pure function LogarithmicMean(x,y) result(lnMean)
+    !! Returns the logarithmic mean, (y-x)/log(y/x), of two positive numbers. Near x = y,
+    !! the mean is evaluated from a series in f = (x-y)/(x+y) to avoid the cancellation in
+    !! the quotient (Ranocha et al., 2021, "Efficient implementation of modern entropy
+    !! stable and kinetic energy preserving discontinuous Galerkin methods")
+    implicit none
+    real(prec),intent(in) :: x
+    real(prec),intent(in) :: y
+    real(prec) :: lnMean
+    ! Local
+    real(prec) :: f2
+
+    f2 = (x*(x-2.0_prec*y)+y*y)/(x*(x+2.0_prec*y)+y*y) ! f**2
+    if(f2 < 1.0e-4_prec) then
+      lnMean = (x+y)/(2.0_prec+f2*(2.0_prec/3.0_prec+f2*(0.4_prec+f2*2.0_prec/7.0_prec)))
+    else
+      lnMean = (y-x)/log(y/x)
+    endif
+
+  endfunction LogarithmicMean
+
+  pure function InverseLogarithmicMean(x,y) result(invLnMean)
+    !! Returns 1/LogarithmicMean(x,y), without the extra division
+    implicit none
+    real(prec),intent(in) :: x
+    real(prec),intent(in) :: y
+    real(prec) :: invLnMean
+    ! Local
+    real(prec) :: f2
+
+    f2 = (x*(x-2.0_prec*y)+y*y)/(x*(x+2.0_prec*y)+y*y) ! f**2
+    if(f2 < 1.0e-4_prec) then
+      invLnMean = (2.0_prec+f2*(2.0_prec/3.0_prec+f2*(0.4_prec+f2*2.0_prec/7.0_prec)))/(x+y)
+    else
+      invLnMean = log(y/x)/(y-x)
+    endif
+
+  endfunction InverseLogarithmicMean
+
   function UpperCase(str) result(upper)
 
     implicit none
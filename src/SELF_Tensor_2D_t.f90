@@ -53,6 +53,8 @@ module SELF_Tensor_2D_t
     procedure,public :: UpdateDevice => UpdateDevice_Tensor2D_t
 
     procedure,public :: BoundaryInterp => BoundaryInterp_Tensor2D_t
+    generic,public :: GridInterp => GridInterp_Tensor2D_t
+    procedure,private :: GridInterp_Tensor2D_t
 
     generic,public :: Determinant => Determinant_Tensor2D_t
     procedure,private :: Determinant_Tensor2D_t
@@ -160,6 +162,16 @@ contains
 
   endsubroutine BoundaryInterp_Tensor2D_t
 
+  subroutine GridInterp_Tensor2D_t(this,f)
+    implicit none
+    class(Tensor2D_t),intent(in) :: this
+    real(prec),intent(out) :: f(1:this%M+1,1:this%M+1,1:this%nelem,1:this%nvar,1:2,1:2)
+    !! (Output) Array of function values, defined on the target grid
+
+    call this%interp%GridInterp_2D(this%interior,f,4*this%nelem*this%nvar)
+
+  endsubroutine GridInterp_Tensor2D_t
+
   subroutine Determinant_Tensor2D_t(this,det)
     implicit none
     class(Tensor2D_t),intent(in) :: this
@@ -50,6 +50,8 @@ module SELF_Tensor_3D_t
     procedure,public :: Free => Free_Tensor3D_t
 
     procedure,public :: BoundaryInterp => BoundaryInterp_Tensor3D_t
+    generic,public :: GridInterp => GridInterp_Tensor3D_t
+    procedure,private :: GridInterp_Tensor3D_t
 
     procedure,public :: UpdateHost => UpdateHost_Tensor3D_t
     procedure,public :: UpdateDevice => UpdateDevice_Tensor3D_t
@@ -167,6 +169,16 @@ contains
 
   endsubroutine BoundaryInterp_Tensor3D_t
 
+  subroutine GridInterp_Tensor3D_t(this,f)
+    implicit none
+    class(Tensor3D_t),intent(in) :: this
+    real(prec),intent(out) :: f(1:this%M+1,1:this%M+1,1:this%M+1,1:this%nelem,1:this%nvar,1:3,1:3)
+    !! (Output) Array of function values, defined on the target grid
+
+    call this%interp%GridInterp_3D(this%interior,f,9*this%nelem*this%nvar)
+
+  endsubroutine GridInterp_Tensor3D_t
+
   subroutine Determinant_Tensor3D_t(this,det)
     implicit none
     class(Tensor3D_t),intent(in) :: this
@@ -167,24 +167,8 @@ contains
     implicit none
     class(Vector2D_t),intent(in) :: this
     real(prec),intent(out) :: f(1:this%M+1,1:this%M+1,1:this%nelem,1:this%nvar,1:2)
-    ! Local
-    integer :: i,j,ii,jj,iel,ivar,idir
-    real(prec) :: fi,fij
-
-    do concurrent(i=1:this%M+1,j=1:this%M+1,iel=1:this%nElem, &
-                  ivar=1:this%nVar,idir=1:2)
 
-      fij = 0.0_prec
-      do jj = 1,this%N+1
-        fi = 0.0_prec
-        do ii = 1,this%N+1
-          fi = fi+this%interior(ii,jj,iel,ivar,idir)*this%interp%iMatrix(ii,i)
-        enddo
-        fij = fij+fi*this%interp%iMatrix(jj,j)
-      enddo
-      f(i,j,iel,ivar,idir) = fij
-
-    enddo
+    call this%interp%GridInterp_2D(this%interior,f,2*this%nelem*this%nvar)
 
   endsubroutine GridInterp_Vector2D_t
 
@@ -281,13 +265,14 @@ contains
 
   endsubroutine Divergence_Vector2D_t
 
-  subroutine WriteHDF5_MPI_Vector2D_t(this,fileId,group,elemoffset,nglobalelem)
+  subroutine WriteHDF5_MPI_Vector2D_t(this,fileId,group,elemoffset,nglobalelem,storage)
     implicit none
     class(Vector2D_t),intent(in) :: this
     character(*),intent(in) :: group
     integer(HID_T),intent(in) :: fileId
     integer,intent(in) :: elemoffset
     integer,intent(in) :: nglobalelem
+    type(HDF5StoragePolicy),optional,intent(in) :: storage
     ! Local
     integer(HID_T) :: offset(1:3)
     integer(HID_T) :: globalDims(1:3)
@@ -308,17 +293,18 @@ contains
         !call this%meta(ivar)%WriteHDF5(group,ivar,fileId)
         call WriteArray_HDF5(fileId, &
                              trim(group)//"/"//trim(this%meta(ivar)%name)//"_"//dimvar, &
-                             this%interior(:,:,:,ivar,idir),offset,globalDims)
+                             this%interior(:,:,:,ivar,idir),offset,globalDims,storage=storage)
       enddo
     enddo
 
   endsubroutine WriteHDF5_MPI_Vector2D_t
 
-  subroutine WriteHDF5_Vector2D_t(this,fileId,group)
+  subroutine WriteHDF5_Vector2D_t(this,fileId,group,storage)
     implicit none
     class(Vector2D_t),intent(in) :: this
     integer(HID_T),intent(in) :: fileId
     character(*),intent(in) :: group
+    type(HDF5StoragePolicy),optional,intent(in) :: storage
     ! Local
     integer :: ivar,idir
     character(4) :: dimvar
@@ -334,7 +320,7 @@ contains
       do ivar = 1,this%nVar
         call WriteArray_HDF5(fileId, &
                              trim(group)//"/"//trim(this%meta(ivar)%name)//"_"//dimvar, &
-                             this%interior(:,:,:,ivar,idir))
+                             this%interior(:,:,:,ivar,idir),storage=storage)
       enddo
     enddo
 
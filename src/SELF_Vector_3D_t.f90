@@ -171,28 +171,8 @@ contains
     class(Vector3D_t),intent(in) :: this
     real(prec),intent(out) :: f(1:this%M+1,1:this%M+1,1:this%M+1,1:this%nelem,1:this%nvar,1:3)
     !! (Output) Array of function values, defined on the target grid
-    ! Local
-    integer :: i,j,k,ii,jj,kk,iel,ivar,idir
-    real(prec) :: fi,fij,fijk
-
-    do concurrent(i=1:this%M+1,j=1:this%M+1, &
-                  k=1:this%M+1,iel=1:this%nelem,ivar=1:this%nvar,idir=1:3)
-
-      fijk = 0.0_prec
-      do kk = 1,this%N+1
-        fij = 0.0_prec
-        do jj = 1,this%N+1
-          fi = 0.0_prec
-          do ii = 1,this%N+1
-            fi = fi+this%interior(ii,jj,kk,iel,ivar,idir)*this%interp%iMatrix(ii,i)
-          enddo
-          fij = fij+fi*this%interp%iMatrix(jj,j)
-        enddo
-        fijk = fijk+fij*this%interp%iMatrix(kk,k)
-      enddo
-      f(i,j,k,iel,ivar,idir) = fijk
 
-    enddo
+    call this%interp%GridInterp_3D(this%interior,f,3*this%nelem*this%nvar)
 
   endsubroutine GridInterp_Vector3D_t
 
@@ -361,13 +341,14 @@ contains
 
   endsubroutine Divergence_Vector3D_t
 
-  subroutine WriteHDF5_MPI_Vector3D_t(this,fileId,group,elemoffset,nglobalelem)
+  subroutine WriteHDF5_MPI_Vector3D_t(this,fileId,group,elemoffset,nglobalelem,storage)
     implicit none
     class(Vector3D_t),intent(in) :: this
     character(*),intent(in) :: group
     integer(HID_T),intent(in) :: fileId
     integer,intent(in) :: elemoffset
     integer,intent(in) :: nglobalelem
+    type(HDF5StoragePolicy),optional,intent(in) :: storage
     ! Local
     integer(HID_T) :: offset(1:4)
     integer(HID_T) :: globalDims(1:4)
@@ -388,17 +369,18 @@ contains
       do ivar = 1,this%nVar
         call WriteArray_HDF5(fileId, &
                              trim(group)//"/"//trim(this%meta(ivar)%name)//"_"//dimvar, &
-                             this%interior(:,:,:,:,ivar,idir),offset,globalDims)
+                             this%interior(:,:,:,:,ivar,idir),offset,globalDims,storage=storage)
       enddo
     enddo
 
   endsubroutine WriteHDF5_MPI_Vector3D_t
 
-  subroutine WriteHDF5_Vector3D_t(this,fileId,group)
+  subroutine WriteHDF5_Vector3D_t(this,fileId,group,storage)
     implicit none
     class(Vector3D_t),intent(in) :: this
     integer(HID_T),intent(in) :: fileId
     character(*),intent(in) :: group
+    type(HDF5StoragePolicy),optional,intent(in) :: storage
     ! Local
     integer :: ivar,idir
     character(4) :: dimvar
@@ -414,7 +396,7 @@ contains
       do ivar = 1,this%nVar
         call WriteArray_HDF5(fileId, &
                              trim(group)//"/"//trim(this%meta(ivar)%name)//"_"//dimvar, &
-                             this%interior(:,:,:,:,ivar,idir))
+                             this%interior(:,:,:,:,ivar,idir),storage=storage)
       enddo
     enddo
   endsubroutine WriteHDF5_Vector3D_t
@@ -0,0 +1,115 @@
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+!
+! Maintainers : support@fluidnumerics.com
+! Official Repository : https://github.com/FluidNumerics/self/
+!
+! Copyright © 2024 Fluid Numerics LLC
+!
+! Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+!
+! 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+!
+! 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in
+!    the documentation and/or other materials provided with the distribution.
+!
+! 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from
+!    this software without specific prior written permission.
+!
+! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+! LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+! HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+! LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+! THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+! THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+
+module SELF_XDMF
+!! Writes the XDMF (eXtensible Data Model and Format) files that describe the
+!! unstructured grids and node-centered fields written to HDF5 for visualization.
+!! Each file holds a single grid: BeginGrid_XDMF opens it and writes the cell
+!! connectivity, the model then writes its Geometry and Attribute elements, with
+!! one DataItem per HDF5 dataset, and EndGrid_XDMF closes it.
+
+  use SELF_Constants
+  use SELF_SupportRoutines
+
+  implicit none
+
+  private
+
+  public :: BeginGrid_XDMF
+  public :: WriteDataItem_XDMF
+  public :: EndGrid_XDMF
+
+contains
+
+  subroutine BeginGrid_XDMF(fUnit,fileName,time,topologyType,nCells,cellDims,cellPath)
+    !! Opens fileName for writing on a new unit, fUnit, and writes the header of an
+    !! unstructured grid at the given time, with its cell connectivity
+    implicit none
+    integer,intent(out) :: fUnit
+    character(*),intent(in) :: fileName
+    real(prec),intent(in) :: time
+    character(*),intent(in) :: topologyType
+    !! XDMF cell type, e.g. "Quadrilateral" or "Hexahedron"
+    integer,intent(in) :: nCells
+    character(*),intent(in) :: cellDims
+    !! Dimensions of the connectivity dataset, slowest varying first
+    character(*),intent(in) :: cellPath
+    !! Connectivity dataset, as <HDF5 file>:<dataset>
+    ! Local
+    character(LEN=32) :: str
+
+    open(UNIT=NEWUNIT(fUnit), &
+         FILE=trim(fileName), &
+         FORM='formatted', &
+         STATUS='replace')
+
+    write(fUnit,'(A)') '<?xml version="1.0" ?>'
+    write(fUnit,'(A)') '<Xdmf Version="3.0">'
+    write(fUnit,'(A)') ' <Domain>'
+    write(fUnit,'(A)') '  <Grid Name="mesh" GridType="Uniform">'
+    write(str,'(ES23.15E3)') time
+    write(fUnit,'(A)') '   <Time Value="'//trim(adjustl(str))//'"/>'
+    write(str,'(I0)') nCells
+    write(fUnit,'(A)') '   <Topology TopologyType="'//trim(topologyType)// &
+      '" NumberOfElements="'//trim(str)//'">'
+    call WriteDataItem_XDMF(fUnit,cellDims,"Int",4,cellPath)
+    write(fUnit,'(A)') '   </Topology>'
+
+  endsubroutine BeginGrid_XDMF
+
+  subroutine WriteDataItem_XDMF(fUnit,dims,numberType,precision,path)
+    !! Writes a DataItem element that refers to an HDF5 dataset
+    implicit none
+    integer,intent(in) :: fUnit
+    character(*),intent(in) :: dims
+    character(*),intent(in) :: numberType
+    !! "Float" or "Int"
+    integer,intent(in) :: precision
+    !! Size of each value, in bytes
+    character(*),intent(in) :: path
+    ! Local
+    character(LEN=4) :: str
+
+    write(str,'(I0)') precision
+    write(fUnit,'(A)') '    <DataItem Dimensions="'//trim(dims)//'" NumberType="'//trim(numberType)// &
+      '" Precision="'//trim(str)//'" Format="HDF">'//trim(path)//'</DataItem>'
+
+  endsubroutine WriteDataItem_XDMF
+
+  subroutine EndGrid_XDMF(fUnit)
+    !! Closes the grid opened with BeginGrid_XDMF, and the file
+    implicit none
+    integer,intent(in) :: fUnit
+
+    write(fUnit,'(A)') '  </Grid>'
+    write(fUnit,'(A)') ' </Domain>'
+    write(fUnit,'(A)') '</Xdmf>'
+
+    close(UNIT=fUnit)
+
+  endsubroutine EndGrid_XDMF
+
+endmodule SELF_XDMF
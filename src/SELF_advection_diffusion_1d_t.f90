@@ -39,7 +39,11 @@ module self_advection_diffusion_1d_t
   contains
     procedure :: riemannflux1d => riemannflux1d_advection_diffusion_1d_t
     procedure :: flux1d => flux1d_advection_diffusion_1d_t
+    procedure :: riemannflux1d_batch => riemannflux1d_batch_advection_diffusion_1d_t
+    procedure :: flux1d_batch => flux1d_batch_advection_diffusion_1d_t
     procedure :: entropy_func => entropy_func_advection_diffusion_1d_t
+    procedure :: maxWaveSpeed => maxWaveSpeed_advection_diffusion_1d_t
+    procedure :: maxDiffusivity => maxDiffusivity_advection_diffusion_1d_t
 
   endtype advection_diffusion_1d_t
 
@@ -59,6 +63,24 @@ contains
 
   endfunction entropy_func_advection_diffusion_1d_t
 
+  pure function maxWaveSpeed_advection_diffusion_1d_t(this,s) result(c)
+    class(advection_diffusion_1d_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%solution%nvar)
+    real(prec) :: c
+
+    c = abs(this%u)
+
+  endfunction maxWaveSpeed_advection_diffusion_1d_t
+
+  pure function maxDiffusivity_advection_diffusion_1d_t(this,s) result(nu)
+    class(advection_diffusion_1d_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%solution%nvar)
+    real(prec) :: nu
+
+    nu = this%nu
+
+  endfunction maxDiffusivity_advection_diffusion_1d_t
+
   pure function riemannflux1d_advection_diffusion_1d_t(this,sL,sR,dsdx,nhat) result(flux)
     class(advection_diffusion_1d_t),intent(in) :: this
     real(prec),intent(in) :: sL(1:this%solution%nvar)
@@ -91,4 +113,36 @@ contains
 
   endfunction flux1d_advection_diffusion_1d_t
 
+  pure subroutine riemannflux1d_batch_advection_diffusion_1d_t(this,sL,sR,dsdx,nhat,flux)
+    class(advection_diffusion_1d_t),intent(in) :: this
+    real(prec),intent(in) :: sL(:,:)
+    real(prec),intent(in) :: sR(:,:)
+    real(prec),intent(in) :: dsdx(:,:)
+    real(prec),intent(in) :: nhat(:)
+    real(prec),intent(out) :: flux(:,:)
+    ! Local
+    integer :: ivar,n
+
+    do concurrent(ivar=1:this%solution%nvar,n=1:size(sL,1))
+      flux(n,ivar) = 0.5_prec*(this%u*nhat(n)*(sL(n,ivar)+sR(n,ivar))+ &
+                               abs(this%u*nhat(n))*(sL(n,ivar)-sR(n,ivar)))- & ! advective flux
+                     this%nu*dsdx(n,ivar)*nhat(n) ! diffusive flux
+    enddo
+
+  endsubroutine riemannflux1d_batch_advection_diffusion_1d_t
+
+  pure subroutine flux1d_batch_advection_diffusion_1d_t(this,s,dsdx,flux)
+    class(advection_diffusion_1d_t),intent(in) :: this
+    real(prec),intent(in) :: s(:,:)
+    real(prec),intent(in) :: dsdx(:,:)
+    real(prec),intent(out) :: flux(:,:)
+    ! Local
+    integer :: ivar,n
+
+    do concurrent(ivar=1:this%solution%nvar,n=1:size(s,1))
+      flux(n,ivar) = this%u*s(n,ivar)-this%nu*dsdx(n,ivar) ! advective flux + diffusive flux
+    enddo
+
+  endsubroutine flux1d_batch_advection_diffusion_1d_t
+
 endmodule self_advection_diffusion_1d_t
@@ -39,7 +39,11 @@ module self_advection_diffusion_2d_t
   contains
     procedure :: riemannflux2d => riemannflux2d_advection_diffusion_2d_t
     procedure :: flux2d => flux2d_advection_diffusion_2d_t
+    procedure :: riemannflux2d_batch => riemannflux2d_batch_advection_diffusion_2d_t
+    procedure :: flux2d_batch => flux2d_batch_advection_diffusion_2d_t
     procedure :: entropy_func => entropy_func_advection_diffusion_2d_t
+    procedure :: maxWaveSpeed => maxWaveSpeed_advection_diffusion_2d_t
+    procedure :: maxDiffusivity => maxDiffusivity_advection_diffusion_2d_t
 
   endtype advection_diffusion_2d_t
 
@@ -59,6 +63,24 @@ contains
 
   endfunction entropy_func_advection_diffusion_2d_t
 
+  pure function maxWaveSpeed_advection_diffusion_2d_t(this,s) result(c)
+    class(advection_diffusion_2d_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%solution%nvar)
+    real(prec) :: c
+
+    c = sqrt(this%u*this%u+this%v*this%v)
+
+  endfunction maxWaveSpeed_advection_diffusion_2d_t
+
+  pure function maxDiffusivity_advection_diffusion_2d_t(this,s) result(nu)
+    class(advection_diffusion_2d_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%solution%nvar)
+    real(prec) :: nu
+
+    nu = this%nu
+
+  endfunction maxDiffusivity_advection_diffusion_2d_t
+
   pure function flux2d_advection_diffusion_2d_t(this,s,dsdx) result(flux)
     class(advection_diffusion_2d_t),intent(in) :: this
     real(prec),intent(in) :: s(1:this%solution%nvar)
@@ -96,4 +118,40 @@ contains
 
   endfunction riemannflux2d_advection_diffusion_2d_t
 
+  pure subroutine flux2d_batch_advection_diffusion_2d_t(this,s,dsdx,flux)
+    class(advection_diffusion_2d_t),intent(in) :: this
+    real(prec),intent(in) :: s(:,:)
+    real(prec),intent(in) :: dsdx(:,:,:)
+    real(prec),intent(out) :: flux(:,:,:)
+    ! Local
+    integer :: ivar,n
+
+    do concurrent(ivar=1:this%solution%nvar,n=1:size(s,1))
+      flux(n,ivar,1) = this%u*s(n,ivar)-this%nu*dsdx(n,ivar,1) ! advective flux + diffusive flux
+      flux(n,ivar,2) = this%v*s(n,ivar)-this%nu*dsdx(n,ivar,2) ! advective flux + diffusive flux
+    enddo
+
+  endsubroutine flux2d_batch_advection_diffusion_2d_t
+
+  pure subroutine riemannflux2d_batch_advection_diffusion_2d_t(this,sL,sR,dsdx,nhat,flux)
+    class(advection_diffusion_2d_t),intent(in) :: this
+    real(prec),intent(in) :: sL(:,:)
+    real(prec),intent(in) :: sR(:,:)
+    real(prec),intent(in) :: dsdx(:,:,:)
+    real(prec),intent(in) :: nhat(:,:)
+    real(prec),intent(out) :: flux(:,:)
+    ! Local
+    integer :: ivar,n
+    real(prec) :: un,dsdn
+
+    do concurrent(ivar=1:this%nvar,n=1:size(sL,1))
+      un = this%u*nhat(n,1)+this%v*nhat(n,2)
+      dsdn = dsdx(n,ivar,1)*nhat(n,1)+dsdx(n,ivar,2)*nhat(n,2)
+      flux(n,ivar) = 0.5_prec*( &
+                     (sL(n,ivar)+sR(n,ivar))+abs(un)*(sL(n,ivar)-sR(n,ivar)))- & ! advective flux
+                     this%nu*dsdn
+    enddo
+
+  endsubroutine riemannflux2d_batch_advection_diffusion_2d_t
+
 endmodule self_advection_diffusion_2d_t
@@ -42,7 +42,11 @@ module self_advection_diffusion_3d_t
 
     procedure :: riemannflux3d => riemannflux3d_advection_diffusion_3d_t
     procedure :: flux3d => flux3d_advection_diffusion_3d_t
+    procedure :: riemannflux3d_batch => riemannflux3d_batch_advection_diffusion_3d_t
+    procedure :: flux3d_batch => flux3d_batch_advection_diffusion_3d_t
     procedure :: entropy_func => entropy_func_advection_diffusion_3d_t
+    procedure :: maxWaveSpeed => maxWaveSpeed_advection_diffusion_3d_t
+    procedure :: maxDiffusivity => maxDiffusivity_advection_diffusion_3d_t
 
   endtype advection_diffusion_3d_t
 
@@ -62,6 +66,24 @@ contains
 
   endfunction entropy_func_advection_diffusion_3d_t
 
+  pure function maxWaveSpeed_advection_diffusion_3d_t(this,s) result(c)
+    class(advection_diffusion_3d_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%solution%nvar)
+    real(prec) :: c
+
+    c = sqrt(this%u*this%u+this%v*this%v+this%w*this%w)
+
+  endfunction maxWaveSpeed_advection_diffusion_3d_t
+
+  pure function maxDiffusivity_advection_diffusion_3d_t(this,s) result(nu)
+    class(advection_diffusion_3d_t),intent(in) :: this
+    real(prec),intent(in) :: s(1:this%solution%nvar)
+    real(prec) :: nu
+
+    nu = this%nu
+
+  endfunction maxDiffusivity_advection_diffusion_3d_t
+
   pure function flux3d_advection_diffusion_3d_t(this,s,dsdx) result(flux)
     class(advection_diffusion_3d_t),intent(in) :: this
     real(prec),intent(in) :: s(1:this%solution%nvar)
@@ -100,4 +122,41 @@ contains
 
   endfunction riemannflux3d_advection_diffusion_3d_t
 
+  pure subroutine flux3d_batch_advection_diffusion_3d_t(this,s,dsdx,flux)
+    class(advection_diffusion_3d_t),intent(in) :: this
+    real(prec),intent(in) :: s(:,:)
+    real(prec),intent(in) :: dsdx(:,:,:)
+    real(prec),intent(out) :: flux(:,:,:)
+! Local
+    integer :: ivar,n
+
+    do concurrent(ivar=1:this%solution%nvar,n=1:size(s,1))
+      flux(n,ivar,1) = this%u*s(n,ivar)-this%nu*dsdx(n,ivar,1) ! advective flux + diffusive flux
+      flux(n,ivar,2) = this%v*s(n,ivar)-this%nu*dsdx(n,ivar,2) ! advective flux + diffusive flux
+      flux(n,ivar,3) = this%w*s(n,ivar)-this%nu*dsdx(n,ivar,3) ! advective flux + diffusive flux
+    enddo
+
+  endsubroutine flux3d_batch_advection_diffusion_3d_t
+
+  pure subroutine riemannflux3d_batch_advection_diffusion_3d_t(this,sL,sR,dsdx,nhat,flux)
+    class(advection_diffusion_3d_t),intent(in) :: this
+    real(prec),intent(in) :: sL(:,:)
+    real(prec),intent(in) :: sR(:,:)
+    real(prec),intent(in) :: dsdx(:,:,:)
+    real(prec),intent(in) :: nhat(:,:)
+    real(prec),intent(out) :: flux(:,:)
+! Local
+    integer :: ivar,n
+    real(prec) :: un,dsdn
+
+    do concurrent(ivar=1:this%nvar,n=1:size(sL,1))
+      un = this%u*nhat(n,1)+this%v*nhat(n,2)+this%w*nhat(n,3)
+      dsdn = dsdx(n,ivar,1)*nhat(n,1)+dsdx(n,ivar,2)*nhat(n,2)+dsdx(n,ivar,3)*nhat(n,3)
+      flux(n,ivar) = 0.5_prec*( &
+                     (sL(n,ivar)+sR(n,ivar))+abs(un)*(sL(n,ivar)-sR(n,ivar)))- & ! advective flux
+                     this%nu*dsdn
+    enddo
+
+  endsubroutine riemannflux3d_batch_advection_diffusion_3d_t
+
 endmodule self_advection_diffusion_3d_t
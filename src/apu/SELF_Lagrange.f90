@@ -188,6 +188,8 @@ contains
     deallocate(this%dMatrix)
     deallocate(this%dgMatrix)
     deallocate(this%bMatrix)
+    if(associated(this%interpWork1)) deallocate(this%interpWork1)
+    if(associated(this%interpWork2)) deallocate(this%interpWork2)
 
     call gpuCheck(hipFree(this%iMatrix_gpu))
     call gpuCheck(hipFree(this%dMatrix_gpu))
@@ -0,0 +1,213 @@
+/*
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+!
+! Maintainers : support@fluidnumerics.com
+! Official Repository : https://github.com/FluidNumerics/self/
+!
+! Copyright © 2024 Fluid Numerics LLC
+!
+! Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+!
+! 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+!
+! 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in
+!    the documentation and/or other materials provided with the distribution.
+!
+! 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from
+!    this software without specific prior written permission.
+!
+! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+! LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+! HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+! LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+! THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+! THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+*/
+
+// Host implementations of the small subset of the HIP/CUDA runtime and the
+// hipblas/cublas routines that are used by the GPU Fortran drivers in src/gpu/.
+// When SELF is built with SELF_ENABLE_CXX_CPU_BACKEND, the interfaces in
+// SELF_GPU.f90 and SELF_GPUBLAS.f90 bind to these symbols so that "device"
+// memory is ordinary host memory and every kernel runs on the CPU with OpenMP.
+
+#include "SELF_GPU_Macros.h"
+#include <cstdlib>
+#include <cstring>
+#include <omp.h>
+
+// Status codes match hipSuccess and HIPBLAS_STATUS_SUCCESS in SELF_GPU_enums.f90
+#define CPU_SUCCESS 0
+#define CPU_ERROR_MEMORY_ALLOCATION 2
+#define CPUBLAS_STATUS_SUCCESS 0
+
+// Transpose flags match HIPBLAS_OP_N and HIPBLAS_OP_T in SELF_GPU_enums.f90
+#define CPUBLAS_OP_N 111
+#define CPUBLAS_OP_T 112
+
+// Alignment (in bytes) of the buffers returned by cpuMalloc; large enough for
+// a full cache line and for aligned AVX-512 loads
+#define CPU_ALIGNMENT 64
+
+extern "C"
+{
+  int cpuGetDeviceCount(int *count)
+  {
+    *count = 1;
+    return CPU_SUCCESS;
+  }
+
+  int cpuSetDevice(int device_id)
+  {
+    return CPU_SUCCESS;
+  }
+
+  int cpuMalloc(void **ptr, size_t mySize)
+  {
+    *ptr = NULL;
+    if( mySize == 0 ) return CPU_SUCCESS;
+    // posix_memalign requires a size that is a multiple of the alignment
+    size_t alignedSize = ((mySize + CPU_ALIGNMENT - 1)/CPU_ALIGNMENT)*CPU_ALIGNMENT;
+    if( posix_memalign(ptr, CPU_ALIGNMENT, alignedSize) != 0 ){
+      *ptr = NULL;
+      return CPU_ERROR_MEMORY_ALLOCATION;
+    }
+    return CPU_SUCCESS;
+  }
+
+  int cpuFree(void *ptr)
+  {
+    free(ptr);
+    return CPU_SUCCESS;
+  }
+
+  int cpuMemcpy(void *dest, const void *src, size_t mySize, int kind)
+  {
+    // All memory is host memory, so the copy direction is irrelevant
+    if( mySize > 0 && dest != src ) memcpy(dest, src, mySize);
+    return CPU_SUCCESS;
+  }
+}
+
+// Column-major matrix multiply C = alpha*op(A)*op(B) + beta*C
+// Each thread owns a set of columns of C. When beta is zero, C is not read,
+// which matches the BLAS convention and allows C to be uninitialized.
+template <typename T>
+static void gemm_host(int transa, int transb, int m, int n, int k,
+                      T alpha, const T *A, int lda, const T *B, int ldb,
+                      T beta, T *C, int ldc)
+{
+  #pragma omp parallel for
+  for(int j = 0; j < n; j++){
+    T *c = &C[(size_t)j*ldc];
+    if( beta == T(0) ){
+      for(int i = 0; i < m; i++) c[i] = T(0);
+    } else if( beta != T(1) ){
+      for(int i = 0; i < m; i++) c[i] *= beta;
+    }
+
+    for(int l = 0; l < k; l++){
+      T bl = (transb == CPUBLAS_OP_N) ? B[l + (size_t)j*ldb] : B[j + (size_t)l*ldb];
+      bl *= alpha;
+      if( transa == CPUBLAS_OP_N ){
+        const T *a = &A[(size_t)l*lda];
+        #pragma omp simd
+        for(int i = 0; i < m; i++) c[i] += a[i]*bl;
+      } else {
+        for(int i = 0; i < m; i++) c[i] += A[l + (size_t)i*lda]*bl;
+      }
+    }
+  }
+}
+
+// Strided batched matrix-vector product y = alpha*op(A)*x + beta*y
+// where A is m x n (column-major) for every batch.
+template <typename T>
+static void gemvStridedBatched_host(int trans, int m, int n, T alpha,
+                                    const T *A, int lda, int64_t strideA,
+                                    const T *x, int incx, int64_t stridex,
+                                    T beta, T *y, int incy, int64_t stridey,
+                                    int batchCount)
+{
+  int ny = (trans == CPUBLAS_OP_N) ? m : n;
+  int nx = (trans == CPUBLAS_OP_N) ? n : m;
+
+  #pragma omp parallel for
+  for(int b = 0; b < batchCount; b++){
+    const T *Ab = &A[(size_t)b*strideA];
+    const T *xb = &x[(size_t)b*stridex];
+    T *yb = &y[(size_t)b*stridey];
+
+    for(int i = 0; i < ny; i++){
+      T yloc = T(0);
+      if( trans == CPUBLAS_OP_N ){
+        for(int l = 0; l < nx; l++) yloc += Ab[i + (size_t)l*lda]*xb[(size_t)l*incx];
+      } else {
+        const T *a = &Ab[(size_t)i*lda];
+        #pragma omp simd reduction(+:yloc)
+        for(int l = 0; l < nx; l++) yloc += a[l]*xb[(size_t)l*incx];
+      }
+      if( beta == T(0) ){
+        yb[(size_t)i*incy] = alpha*yloc;
+      } else {
+        yb[(size_t)i*incy] = alpha*yloc + beta*yb[(size_t)i*incy];
+      }
+    }
+  }
+}
+
+extern "C"
+{
+  int cpublasCreate(void **handle)
+  {
+    // The handle is not used by the host implementations, but it must be
+    // non-null so that it looks like a valid handle to the Fortran drivers
+    static int cpublasHandle = 0;
+    *handle = (void*)&cpublasHandle;
+    return CPUBLAS_STATUS_SUCCESS;
+  }
+
+  int cpublasDestroy(void *handle)
+  {
+    return CPUBLAS_STATUS_SUCCESS;
+  }
+
+  int cpublasSgemm(void *handle, int transa, int transb, int m, int n, int k,
+                   const float *alpha, const float *A, int lda, const float *B, int ldb,
+                   const float *beta, float *C, int ldc)
+  {
+    gemm_host<float>(transa, transb, m, n, k, *alpha, A, lda, B, ldb, *beta, C, ldc);
+    return CPUBLAS_STATUS_SUCCESS;
+  }
+
+  int cpublasDgemm(void *handle, int transa, int transb, int m, int n, int k,
+                   const double *alpha, const double *A, int lda, const double *B, int ldb,
+                   const double *beta, double *C, int ldc)
+  {
+    gemm_host<double>(transa, transb, m, n, k, *alpha, A, lda, B, ldb, *beta, C, ldc);
+    return CPUBLAS_STATUS_SUCCESS;
+  }
+
+  int cpublasSgemvStridedBatched(void *handle, int trans, int m, int n, const float *alpha,
+                                 const float *A, int lda, int64_t strideA,
+                                 const float *x, int incx, int64_t stridex,
+                                 const float *beta, float *y, int incy, int64_t stridey,
+                                 int batchCount)
+  {
+    gemvStridedBatched_host<float>(trans, m, n, *alpha, A, lda, strideA, x, incx, stridex,
+                                   *beta, y, incy, stridey, batchCount);
+    return CPUBLAS_STATUS_SUCCESS;
+  }
+
+  int cpublasDgemvStridedBatched(void *handle, int trans, int m, int n, const double *alpha,
+                                 const double *A, int lda, int64_t strideA,
+                                 const double *x, int incx, int64_t stridex,
+                                 const double *beta, double *y, int incy, int64_t stridey,
+                                 int batchCount)
+  {
+    gemvStridedBatched_host<double>(trans, m, n, *alpha, A, lda, strideA, x, incx, stridex,
+                                    *beta, y, incy, stridey, batchCount);
+    return CPUBLAS_STATUS_SUCCESS;
+  }
+}
@@ -0,0 +1,286 @@
+#include "SELF_GPU_Macros.h"
+#include "SELF_TensorKernels.h"
+
+// Host (OpenMP) implementations of the kernels in src/gpu/SELF_Data.cpp
+// Loops are ordered so that the innermost loop runs over the fastest
+// varying (quadrature point) index of the SELF data layouts.
+//
+// For N <= SELF_NMAX_SPECIALIZED, the tensor-product operations are dispatched
+// to the degree-specialized kernels in SELF_TensorKernels.h. The runtime-N
+// loops below are used for higher degrees.
+
+typedef void (*Divergence_2D_fn)(const real*, const real*, real*, const real*);
+typedef void (*Divergence_3D_fn)(const real*, const real*, const real*, real*, const real*);
+typedef void (*BoundaryInterp_fn)(const real*, real*, const real*);
+typedef void (*DG_BoundaryContribution_fn)(const real*, real*, const real*, const real*);
+
+static const Divergence_2D_fn Divergence_2D_table[] = SELF_DISPATCH_TABLE(Divergence_2D_element);
+static const Divergence_3D_fn Divergence_3D_table[] = SELF_DISPATCH_TABLE(Divergence_3D_element);
+static const BoundaryInterp_fn BoundaryInterp_2D_table[] = SELF_DISPATCH_TABLE(BoundaryInterp_2D_element);
+static const BoundaryInterp_fn BoundaryInterp_3D_table[] = SELF_DISPATCH_TABLE(BoundaryInterp_3D_element);
+static const DG_BoundaryContribution_fn DG_BoundaryContribution_2D_table[] = SELF_DISPATCH_TABLE(DG_BoundaryContribution_2D_element);
+static const DG_BoundaryContribution_fn DG_BoundaryContribution_3D_table[] = SELF_DISPATCH_TABLE(DG_BoundaryContribution_3D_element);
+
+extern "C"
+{
+  void Average_gpu(real *f, real *f1, real *f2, int ndof)
+  {
+    #pragma omp parallel for simd
+    for(int i = 0; i < ndof; i++){
+      f[i] = 0.5*(f1[i]+f2[i]);
+    }
+  }
+}
+
+extern "C"
+{
+  void BoundaryInterp_2D_gpu(real *bMatrix, real *f, real *fBound, int N, int nvar, int nel)
+  {
+    if( N <= SELF_NMAX_SPECIALIZED ){
+      BoundaryInterp_fn kernel = BoundaryInterp_2D_table[N];
+      #pragma omp parallel for collapse(2)
+      for(int iVar = 0; iVar < nvar; iVar++){
+        for(int iEl = 0; iEl < nel; iEl++){
+          kernel(&f[SC_2D_INDEX(0,0,iEl,iVar,N,nel)],
+                 &fBound[SCB_2D_INDEX(0,0,iEl,iVar,N,nel)], bMatrix);
+        }
+      }
+      return;
+    }
+
+    #pragma omp parallel for collapse(2)
+    for(int iVar = 0; iVar < nvar; iVar++){
+      for(int iEl = 0; iEl < nel; iEl++){
+        for(int i = 0; i < N+1; i++){
+
+          real fbs = 0.0;
+          real fbn = 0.0;
+          real fbw = 0.0;
+          real fbe = 0.0;
+          for(int ii = 0; ii < N+1; ii++){
+            fbs += f[SC_2D_INDEX(i,ii,iEl,iVar,N,nel)]*bMatrix[ii]; // South
+            fbn += f[SC_2D_INDEX(i,ii,iEl,iVar,N,nel)]*bMatrix[ii+(N+1)]; // North
+            fbw += f[SC_2D_INDEX(ii,i,iEl,iVar,N,nel)]*bMatrix[ii]; // West
+            fbe += f[SC_2D_INDEX(ii,i,iEl,iVar,N,nel)]*bMatrix[ii+(N+1)]; // East
+          }
+          fBound[SCB_2D_INDEX(i,0,iEl,iVar,N,nel)] = fbs; // South
+          fBound[SCB_2D_INDEX(i,1,iEl,iVar,N,nel)] = fbe; // East
+          fBound[SCB_2D_INDEX(i,2,iEl,iVar,N,nel)] = fbn; // North
+          fBound[SCB_2D_INDEX(i,3,iEl,iVar,N,nel)] = fbw; // West
+
+        }
+      }
+    }
+  }
+}
+
+extern "C"
+{
+  void BoundaryInterp_3D_gpu(real *bMatrix, real *f, real *fBound, int N, int nvar, int nel)
+  {
+    if( N <= SELF_NMAX_SPECIALIZED ){
+      BoundaryInterp_fn kernel = BoundaryInterp_3D_table[N];
+      #pragma omp parallel for collapse(2)
+      for(int iVar = 0; iVar < nvar; iVar++){
+        for(int iEl = 0; iEl < nel; iEl++){
+          kernel(&f[SC_3D_INDEX(0,0,0,iEl,iVar,N,nel)],
+                 &fBound[SCB_3D_INDEX(0,0,0,iEl,iVar,N,nel)], bMatrix);
+        }
+      }
+      return;
+    }
+
+    #pragma omp parallel for collapse(2)
+    for(int iVar = 0; iVar < nvar; iVar++){
+      for(int iEl = 0; iEl < nel; iEl++){
+        for(int j = 0; j < N+1; j++){
+          for(int i = 0; i < N+1; i++){
+
+            real fb[6] = {0.0};
+            for(int ii = 0; ii < N+1; ii++){
+              fb[0] += f[SC_3D_INDEX(i,j,ii,iEl,iVar,N,nel)]*bMatrix[ii]; // Bottom
+              fb[1] += f[SC_3D_INDEX(i,ii,j,iEl,iVar,N,nel)]*bMatrix[ii]; // South
+              fb[2] += f[SC_3D_INDEX(ii,i,j,iEl,iVar,N,nel)]*bMatrix[ii+(N+1)]; // East
+              fb[3] += f[SC_3D_INDEX(i,ii,j,iEl,iVar,N,nel)]*bMatrix[ii+(N+1)]; // North
+              fb[4] += f[SC_3D_INDEX(ii,i,j,iEl,iVar,N,nel)]*bMatrix[ii]; // West
+              fb[5] += f[SC_3D_INDEX(i,j,ii,iEl,iVar,N,nel)]*bMatrix[ii+(N+1)]; // Top
+            }
+            for(int iside = 0; iside < 6; iside++){
+              fBound[SCB_3D_INDEX(i,j,iside,iEl,iVar,N,nel)] = fb[iside];
+            }
+
+          }
+        }
+      }
+    }
+  }
+}
+
+extern "C"
+{
+  void Divergence_2D_gpu(real *f, real *df, real *dmatrix, int N, int nvar, int nel)
+  {
+    size_t nq = (N+1)*(N+1);
+
+    if( N <= SELF_NMAX_SPECIALIZED ){
+      Divergence_2D_fn kernel = Divergence_2D_table[N];
+      #pragma omp parallel for collapse(2)
+      for(int ivar = 0; ivar < nvar; ivar++){
+        for(int iel = 0; iel < nel; iel++){
+          kernel(&f[nq*(iel + (size_t)nel*(ivar))],
+                 &f[nq*(iel + (size_t)nel*(ivar + nvar))],
+                 &df[nq*(iel + (size_t)nel*ivar)], dmatrix);
+        }
+      }
+      return;
+    }
+
+    #pragma omp parallel for collapse(2)
+    for(int ivar = 0; ivar < nvar; ivar++){
+      for(int iel = 0; iel < nel; iel++){
+        real *f1 = &f[nq*(iel + (size_t)nel*(ivar))]; // x-component
+        real *f2 = &f[nq*(iel + (size_t)nel*(ivar + nvar))]; // y-component
+        real *dfloc = &df[nq*(iel + (size_t)nel*ivar)];
+
+        for(int j = 0; j < N+1; j++){
+          #pragma omp simd
+          for(int i = 0; i < N+1; i++){
+            real dfl = 0.0;
+            for(int ii = 0; ii < N+1; ii++){
+              dfl += dmatrix[ii+(N+1)*i]*f1[ii+(N+1)*j]+
+                     dmatrix[ii+(N+1)*j]*f2[i+(N+1)*ii];
+            }
+            dfloc[i+(N+1)*j] = dfl;
+          }
+        }
+      }
+    }
+  }
+}
+
+extern "C"
+{
+  void DG_BoundaryContribution_2D_gpu(real *bMatrix, real *qWeights, real *bf, real *df, int N, int nvar, int nel)
+  {
+    size_t nq = (N+1)*(N+1);
+
+    if( N <= SELF_NMAX_SPECIALIZED ){
+      DG_BoundaryContribution_fn kernel = DG_BoundaryContribution_2D_table[N];
+      #pragma omp parallel for collapse(2)
+      for(int ivar = 0; ivar < nvar; ivar++){
+        for(int iel = 0; iel < nel; iel++){
+          kernel(&bf[SCB_2D_INDEX(0,0,iel,ivar,N,nel)],
+                 &df[nq*(iel + (size_t)nel*ivar)], bMatrix, qWeights);
+        }
+      }
+      return;
+    }
+
+    #pragma omp parallel for collapse(2)
+    for(int ivar = 0; ivar < nvar; ivar++){
+      for(int iel = 0; iel < nel; iel++){
+        for(int j = 0; j < N+1; j++){
+          for(int i = 0; i < N+1; i++){
+            size_t iq = i+(N+1)*j;
+            df[iq + nq*(iel + (size_t)nel*ivar)] += (bMatrix[i+(N+1)]*bf[SCB_2D_INDEX(j,1,iel,ivar,N,nel)] + // east
+                                                    bMatrix[i]*bf[SCB_2D_INDEX(j,3,iel,ivar,N,nel)])/ // west
+                                                   qWeights[i] +
+                                                   (bMatrix[j+(N+1)]*bf[SCB_2D_INDEX(i,2,iel,ivar,N,nel)] + // north
+                                                    bMatrix[j]*bf[SCB_2D_INDEX(i,0,iel,ivar,N,nel)])/  // south
+                                                   qWeights[j];
+          }
+        }
+      }
+    }
+  }
+}
+
+extern "C"
+{
+  // The argument order matches the Fortran interface in SELF_GPUInterfaces.f90
+  void Divergence_3D_gpu(real *f, real *df, real *dmatrix, int N, int nvar, int nel)
+  {
+    size_t nq = (N+1)*(N+1)*(N+1);
+
+    if( N <= SELF_NMAX_SPECIALIZED ){
+      Divergence_3D_fn kernel = Divergence_3D_table[N];
+      #pragma omp parallel for collapse(2)
+      for(int ivar = 0; ivar < nvar; ivar++){
+        for(int iel = 0; iel < nel; iel++){
+          kernel(&f[nq*(iel + (size_t)nel*(ivar))],
+                 &f[nq*(iel + (size_t)nel*(ivar + nvar))],
+                 &f[nq*(iel + (size_t)nel*(ivar + 2*nvar))],
+                 &df[nq*(iel + (size_t)nel*ivar)], dmatrix);
+        }
+      }
+      return;
+    }
+
+    #pragma omp parallel for collapse(2)
+    for(int ivar = 0; ivar < nvar; ivar++){
+      for(int iel = 0; iel < nel; iel++){
+        real *f1 = &f[nq*(iel + (size_t)nel*(ivar))];
+        real *f2 = &f[nq*(iel + (size_t)nel*(ivar + nvar))];
+        real *f3 = &f[nq*(iel + (size_t)nel*(ivar + 2*nvar))];
+        real *dfloc = &df[nq*(iel + (size_t)nel*ivar)];
+
+        for(int k = 0; k < N+1; k++){
+          for(int j = 0; j < N+1; j++){
+            #pragma omp simd
+            for(int i = 0; i < N+1; i++){
+              real dfl = 0.0;
+              for(int ii = 0; ii < N+1; ii++){
+                dfl += dmatrix[ii+(N+1)*i]*f1[ii+(N+1)*(j+(N+1)*(k))]+
+                       dmatrix[ii+(N+1)*j]*f2[i+(N+1)*(ii+(N+1)*(k))]+
+                       dmatrix[ii+(N+1)*k]*f3[i+(N+1)*(j+(N+1)*(ii))];
+              }
+              dfloc[i+(N+1)*(j+(N+1)*k)] = dfl;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+extern "C"
+{
+  void DG_BoundaryContribution_3D_gpu(real *bMatrix, real *qWeights, real *bf, real *df, int N, int nvar, int nel)
+  {
+    size_t nq = (N+1)*(N+1)*(N+1);
+
+    if( N <= SELF_NMAX_SPECIALIZED ){
+      DG_BoundaryContribution_fn kernel = DG_BoundaryContribution_3D_table[N];
+      #pragma omp parallel for collapse(2)
+      for(int ivar = 0; ivar < nvar; ivar++){
+        for(int iel = 0; iel < nel; iel++){
+          kernel(&bf[SCB_3D_INDEX(0,0,0,iel,ivar,N,nel)],
+                 &df[nq*(iel + (size_t)nel*ivar)], bMatrix, qWeights);
+        }
+      }
+      return;
+    }
+
+    #pragma omp parallel for collapse(2)
+    for(int ivar = 0; ivar < nvar; ivar++){
+      for(int iel = 0; iel < nel; iel++){
+        for(int k = 0; k < N+1; k++){
+          for(int j = 0; j < N+1; j++){
+            for(int i = 0; i < N+1; i++){
+              size_t iq = i+(N+1)*(j+(N+1)*k);
+              df[iq + nq*(iel + (size_t)nel*ivar)] += (bf[SCB_3D_INDEX(i,j,5,iel,ivar,N,nel)]*bMatrix[k+(N+1)] + // top
+                                                      bf[SCB_3D_INDEX(i,j,0,iel,ivar,N,nel)]*bMatrix[k])/       // bottom
+                                                     qWeights[k] +
+                                                     (bf[SCB_3D_INDEX(j,k,2,iel,ivar,N,nel)]*bMatrix[i+(N+1)] + // east
+                                                      bf[SCB_3D_INDEX(j,k,4,iel,ivar,N,nel)]*bMatrix[i])/       // west
+                                                     qWeights[i] +
+                                                     (bf[SCB_3D_INDEX(i,k,3,iel,ivar,N,nel)]*bMatrix[j+(N+1)] + // north
+                                                      bf[SCB_3D_INDEX(i,k,1,iel,ivar,N,nel)]*bMatrix[j])/       // south
+                                                     qWeights[j];
+            }
+          }
+        }
+      }
+    }
+  }
+}
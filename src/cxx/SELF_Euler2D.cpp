@@ -0,0 +1,251 @@
+/*
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+!
+! Maintainers : support@fluidnumerics.com
+! Official Repository : https://github.com/FluidNumerics/self/
+!
+! Copyright © 2024 Fluid Numerics LLC
+!
+! Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+!
+! 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+!
+! 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in
+!    the documentation and/or other materials provided with the distribution.
+!
+! 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from
+!    this software without specific prior written permission.
+!
+! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+! LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+! HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+! LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+! THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+! THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+*/
+
+#include "SELF_GPU_Macros.h"
+#include "SELF_TensorKernels.h"
+#include <cmath>
+
+// Host (OpenMP) implementations of the kernels in src/gpu/SELF_Euler2D.cpp
+//
+// The flux differencing kernel works on one element at a time. The primitive
+// variables and metric terms of the element are gathered into a contiguous work
+// array first; each direction is then swept with the innermost loop over the
+// i index, so that the two-point flux is evaluated for a line of points at a
+// time (SIMD over nodes). As for SELF_TensorKernels.h, the kernel is specialized
+// on the polynomial degree up to SELF_NMAX_SPECIALIZED.
+
+static inline real lnmean_Euler2D(real x, real y){
+  real f2 = (x*(x-2.0*y)+y*y)/(x*(x+2.0*y)+y*y);
+  if( f2 < 1.0e-4 ){
+    return (x+y)/(2.0+f2*(2.0/3.0+f2*(0.4+f2*2.0/7.0)));
+  } else {
+    return (y-x)/log(y/x);
+  }
+}
+
+// Entropy conserving and kinetic energy preserving two-point flux (Ranocha, 2018)
+// in the direction (nx,ny), for the primitive states (rho,u,v,p)
+static inline void twopointflux_Euler2D(real rhol, real ul, real vl, real pl,
+                                        real rhor, real ur, real vr, real pr,
+                                        real nx, real ny, real gamma, real *f){
+  real rhoMean = lnmean_Euler2D(rhol,rhor);
+  real invRhoPMean = pl*pr/lnmean_Euler2D(rhol*pr,rhor*pl);
+  real unl = ul*nx + vl*ny;
+  real unr = ur*nx + vr*ny;
+  real pAvg = 0.5*(pl+pr);
+
+  f[0] = 0.5*rhoMean*(unl+unr);
+  f[1] = 0.5*f[0]*(ul+ur) + pAvg*nx;
+  f[2] = 0.5*f[0]*(vl+vr) + pAvg*ny;
+  f[3] = f[0]*(0.5*(ul*ur+vl*vr) + invRhoPMean/(gamma-1.0)) + 0.5*(pl*unr+pr*unl);
+}
+
+// sol and df point to the first point of the element for the first variable,
+// dsdx to the first point of the element for the first metric component; the
+// stride between variables (and metric components) is ndof. NT < 0 selects the
+// runtime degree Nrt. work holds 13*(N+1)^2 reals.
+template <int NT>
+static void FluxDifferencing_Euler2D_element(const real *__restrict__ sol, const real *__restrict__ dsdx,
+                                             const real *__restrict__ dMatrix, real *__restrict__ df,
+                                             real gamma, int accumulate, int Nrt, size_t ndof,
+                                             real *__restrict__ work){
+
+  const int N = (NT < 0) ? Nrt : NT;
+  const int NP = N+1;
+  const int NP2 = NP*NP;
+  real *rho = work;
+  real *u = work + NP2;
+  real *v = work + 2*NP2;
+  real *p = work + 3*NP2;
+  real *ja = work + 4*NP2; // ja[ij + NP2*(row+2*col)]
+  real *dfl = work + 8*NP2;
+  real *dsplit = work + 12*NP2; // dsplit[n+NP*i] = 2*D(i,n), with a zero diagonal
+
+  #pragma omp simd
+  for(int ij = 0; ij < NP2; ij++){
+    rho[ij] = sol[ij];
+    u[ij] = sol[ij+ndof]/rho[ij];
+    v[ij] = sol[ij+2*ndof]/rho[ij];
+    p[ij] = (gamma-1.0)*(sol[ij+3*ndof]-0.5*rho[ij]*(u[ij]*u[ij]+v[ij]*v[ij]));
+    for(int c = 0; c < 4; c++){
+      ja[ij+NP2*c] = dsdx[ij+c*ndof];
+      dfl[ij+NP2*c] = 0.0;
+    }
+  }
+  for(int i = 0; i < NP; i++){
+    for(int n = 0; n < NP; n++){
+      dsplit[n+NP*i] = (n == i) ? 0.0 : 2.0*dMatrix[n+NP*i];
+    }
+  }
+
+  real f[4];
+  // Computational direction 1 : pairs (i,j),(n,j)
+  for(int j = 0; j < NP; j++){
+    for(int n = 0; n < NP; n++){
+      const int nj = n+NP*j;
+      #pragma omp simd private(f)
+      for(int i = 0; i < NP; i++){
+        const int ij = i+NP*j;
+        real d = dsplit[n+NP*i];
+        real nx = 0.5*(ja[ij]+ja[nj]);
+        real ny = 0.5*(ja[ij+NP2]+ja[nj+NP2]);
+        twopointflux_Euler2D(rho[ij],u[ij],v[ij],p[ij],rho[nj],u[nj],v[nj],p[nj],nx,ny,gamma,f);
+        for(int ivar = 0; ivar < 4; ivar++) dfl[ij+NP2*ivar] += d*f[ivar];
+      }
+    }
+  }
+
+  // Computational direction 2 : pairs (i,j),(i,n)
+  for(int j = 0; j < NP; j++){
+    for(int n = 0; n < NP; n++){
+      if( n == j ) continue;
+      real d = dsplit[n+NP*j];
+      #pragma omp simd private(f)
+      for(int i = 0; i < NP; i++){
+        const int ij = i+NP*j;
+        const int in = i+NP*n;
+        real nx = 0.5*(ja[ij+2*NP2]+ja[in+2*NP2]);
+        real ny = 0.5*(ja[ij+3*NP2]+ja[in+3*NP2]);
+        twopointflux_Euler2D(rho[ij],u[ij],v[ij],p[ij],rho[in],u[in],v[in],p[in],nx,ny,gamma,f);
+        for(int ivar = 0; ivar < 4; ivar++) dfl[ij+NP2*ivar] += d*f[ivar];
+      }
+    }
+  }
+
+  for(int ivar = 0; ivar < 4; ivar++){
+    #pragma omp simd
+    for(int ij = 0; ij < NP2; ij++){
+      if( accumulate ){
+        df[ij+ivar*ndof] += dfl[ij+NP2*ivar];
+      } else {
+        df[ij+ivar*ndof] = dfl[ij+NP2*ivar];
+      }
+    }
+  }
+}
+
+typedef void (*FluxDifferencing_Euler2D_fn)(const real*, const real*, const real*, real*, real, int, int, size_t, real*);
+static const FluxDifferencing_Euler2D_fn FluxDifferencing_Euler2D_table[] = SELF_DISPATCH_TABLE(FluxDifferencing_Euler2D_element);
+
+extern "C"
+{
+  void fluxdifferencing_Euler2D_gpu(real *solution, real *dsdx, real *dMatrix, real *df, real gamma, int accumulate, int N, int nel){
+    size_t ndof = (size_t)(N+1)*(N+1)*nel;
+    FluxDifferencing_Euler2D_fn kernel = FluxDifferencing_Euler2D_element<-1>;
+    if( N <= SELF_NMAX_SPECIALIZED ) kernel = FluxDifferencing_Euler2D_table[N];
+
+    #pragma omp parallel
+    {
+      real *work = new real[13*(N+1)*(N+1)];
+      #pragma omp for
+      for(int iel = 0; iel < nel; iel++){
+        kernel(&solution[SC_2D_INDEX(0,0,iel,0,N,nel)],
+               &dsdx[TE_2D_INDEX(0,0,iel,0,0,0,N,nel,1)],
+               dMatrix, &df[SC_2D_INDEX(0,0,iel,0,N,nel)],
+               gamma, accumulate, N, ndof, work);
+      }
+      delete[] work;
+    }
+  }
+}
+
+extern "C"
+{
+  void boundaryflux_Euler2D_gpu(real *fb, real *extfb, real *nhat, real *nmag, real *flux, real gamma, int N, int nel){
+    size_t ndof = (N+1)*4*nel;
+
+    #pragma omp parallel for simd
+    for(size_t idof = 0; idof < ndof; idof++){
+
+      real nx = nhat[idof];
+      real ny = nhat[idof+ndof];
+
+      real fl[4];
+      real rho = fb[idof];
+      real un = (fb[idof + ndof]*nx + fb[idof + 2*ndof]*ny)/rho;
+      real p = (gamma-1.0)*(fb[idof + 3*ndof] - 0.5*(fb[idof + ndof]*fb[idof + ndof] + fb[idof + 2*ndof]*fb[idof + 2*ndof])/rho);
+      fl[0] = rho*un; // density
+      fl[1] = fb[idof + ndof]*un + p*nx; // x-momentum
+      fl[2] = fb[idof + 2*ndof]*un + p*ny; // y-momentum
+      fl[3] = (fb[idof + 3*ndof] + p)*un; // total energy
+      real lam = fabs(un) + sqrt(gamma*p/rho);
+
+      real fr[4];
+      rho = extfb[idof];
+      un = (extfb[idof + ndof]*nx + extfb[idof + 2*ndof]*ny)/rho;
+      p = (gamma-1.0)*(extfb[idof + 3*ndof] - 0.5*(extfb[idof + ndof]*extfb[idof + ndof] + extfb[idof + 2*ndof]*extfb[idof + 2*ndof])/rho);
+      fr[0] = rho*un; // density
+      fr[1] = extfb[idof + ndof]*un + p*nx; // x-momentum
+      fr[2] = extfb[idof + 2*ndof]*un + p*ny; // y-momentum
+      fr[3] = (extfb[idof + 3*ndof] + p)*un; // total energy
+      lam = fmax(lam, fabs(un) + sqrt(gamma*p/rho));
+
+      real nm = nmag[idof];
+      for(int ivar = 0; ivar < 4; ivar++){
+        flux[idof+ivar*ndof] = (0.5*(fl[ivar]+fr[ivar])+0.5*lam*(fb[idof+ivar*ndof]-extfb[idof+ivar*ndof]))*nm;
+      }
+    }
+  }
+}
+
+extern "C"
+{
+  void setboundarycondition_Euler2D_gpu(real *extBoundary, real *boundary, int *sideInfo, real *nhat, int N, int nel){
+
+    #pragma omp parallel for collapse(2)
+    for(int e1 = 0; e1 < nel; e1++){
+      for(int s1 = 0; s1 < 4; s1++){
+        int e2 = sideInfo[INDEX3(2,s1,e1,5,4)];
+        int bcid = sideInfo[INDEX3(4,s1,e1,5,4)];
+        if( e2 != 0 ) continue;
+
+        for(int i = 0; i < N+1; i++){
+          if( bcid == SELF_BC_NONORMALFLOW ){
+
+            real ru = boundary[SCB_2D_INDEX(i,s1,e1,1,N,nel)];
+            real rv = boundary[SCB_2D_INDEX(i,s1,e1,2,N,nel)];
+            real nx = nhat[VEB_2D_INDEX(i,s1,e1,0,0,N,nel,1)];
+            real ny = nhat[VEB_2D_INDEX(i,s1,e1,0,1,N,nel,1)];
+            real mn = ru*nx + rv*ny;
+            extBoundary[SCB_2D_INDEX(i,s1,e1,0,N,nel)] = boundary[SCB_2D_INDEX(i,s1,e1,0,N,nel)]; // density
+            extBoundary[SCB_2D_INDEX(i,s1,e1,1,N,nel)] = ru-2.0*mn*nx; // x-momentum
+            extBoundary[SCB_2D_INDEX(i,s1,e1,2,N,nel)] = rv-2.0*mn*ny; // y-momentum
+            extBoundary[SCB_2D_INDEX(i,s1,e1,3,N,nel)] = boundary[SCB_2D_INDEX(i,s1,e1,3,N,nel)]; // total energy
+
+          } else if ( bcid == SELF_BC_RADIATION ){
+
+            for(int ivar = 0; ivar < 4; ivar++){
+              extBoundary[SCB_2D_INDEX(i,s1,e1,ivar,N,nel)] = boundary[SCB_2D_INDEX(i,s1,e1,ivar,N,nel)];
+            }
+
+          }
+        }
+      }
+    }
+  }
+}
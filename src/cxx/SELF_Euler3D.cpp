@@ -0,0 +1,286 @@
+/*
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+!
+! Maintainers : support@fluidnumerics.com
+! Official Repository : https://github.com/FluidNumerics/self/
+!
+! Copyright © 2024 Fluid Numerics LLC
+!
+! Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+!
+! 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+!
+! 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in
+!    the documentation and/or other materials provided with the distribution.
+!
+! 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from
+!    this software without specific prior written permission.
+!
+! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+! LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+! HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+! LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+! THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+! THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+*/
+
+#include "SELF_GPU_Macros.h"
+#include "SELF_TensorKernels.h"
+#include <cmath>
+
+// Host (OpenMP) implementations of the kernels in src/gpu/SELF_Euler3D.cpp
+//
+// The layout follows src/cxx/SELF_Euler2D.cpp : the element state and metric
+// terms are gathered into a work array and each of the three directions is
+// swept with the i index innermost.
+
+static inline real lnmean_Euler3D(real x, real y){
+  real f2 = (x*(x-2.0*y)+y*y)/(x*(x+2.0*y)+y*y);
+  if( f2 < 1.0e-4 ){
+    return (x+y)/(2.0+f2*(2.0/3.0+f2*(0.4+f2*2.0/7.0)));
+  } else {
+    return (y-x)/log(y/x);
+  }
+}
+
+// Entropy conserving and kinetic energy preserving two-point flux (Ranocha, 2018)
+// in the direction (nx,ny,nz), for the primitive states (rho,u,v,w,p)
+static inline void twopointflux_Euler3D(real rhol, real ul, real vl, real wl, real pl,
+                                        real rhor, real ur, real vr, real wr, real pr,
+                                        real nx, real ny, real nz, real gamma, real *f){
+  real rhoMean = lnmean_Euler3D(rhol,rhor);
+  real invRhoPMean = pl*pr/lnmean_Euler3D(rhol*pr,rhor*pl);
+  real unl = ul*nx + vl*ny + wl*nz;
+  real unr = ur*nx + vr*ny + wr*nz;
+  real pAvg = 0.5*(pl+pr);
+
+  f[0] = 0.5*rhoMean*(unl+unr);
+  f[1] = 0.5*f[0]*(ul+ur) + pAvg*nx;
+  f[2] = 0.5*f[0]*(vl+vr) + pAvg*ny;
+  f[3] = 0.5*f[0]*(wl+wr) + pAvg*nz;
+  f[4] = f[0]*(0.5*(ul*ur+vl*vr+wl*wr) + invRhoPMean/(gamma-1.0)) + 0.5*(pl*unr+pr*unl);
+}
+
+// Arguments are as for FluxDifferencing_Euler2D_element; work holds
+// 19*(N+1)^3 + (N+1)^2 reals.
+template <int NT>
+static void FluxDifferencing_Euler3D_element(const real *__restrict__ sol, const real *__restrict__ dsdx,
+                                             const real *__restrict__ dMatrix, real *__restrict__ df,
+                                             real gamma, int accumulate, int Nrt, size_t ndof,
+                                             real *__restrict__ work){
+
+  const int N = (NT < 0) ? Nrt : NT;
+  const int NP = N+1;
+  const int NP3 = NP*NP*NP;
+  real *rho = work;
+  real *u = work + NP3;
+  real *v = work + 2*NP3;
+  real *w = work + 3*NP3;
+  real *p = work + 4*NP3;
+  real *ja = work + 5*NP3; // ja[ijk + NP3*(row+3*col)]
+  real *dfl = work + 14*NP3;
+  real *dsplit = work + 19*NP3; // dsplit[n+NP*i] = 2*D(i,n), with a zero diagonal
+
+  #pragma omp simd
+  for(int ijk = 0; ijk < NP3; ijk++){
+    rho[ijk] = sol[ijk];
+    u[ijk] = sol[ijk+ndof]/rho[ijk];
+    v[ijk] = sol[ijk+2*ndof]/rho[ijk];
+    w[ijk] = sol[ijk+3*ndof]/rho[ijk];
+    p[ijk] = (gamma-1.0)*(sol[ijk+4*ndof]-0.5*rho[ijk]*(u[ijk]*u[ijk]+v[ijk]*v[ijk]+w[ijk]*w[ijk]));
+    for(int c = 0; c < 9; c++){
+      ja[ijk+NP3*c] = dsdx[ijk+c*ndof];
+    }
+    for(int c = 0; c < 5; c++){
+      dfl[ijk+NP3*c] = 0.0;
+    }
+  }
+  for(int i = 0; i < NP; i++){
+    for(int n = 0; n < NP; n++){
+      dsplit[n+NP*i] = (n == i) ? 0.0 : 2.0*dMatrix[n+NP*i];
+    }
+  }
+
+  real f[5];
+  for(int k = 0; k < NP; k++){
+    for(int j = 0; j < NP; j++){
+
+      // Computational direction 1 : pairs (i,j,k),(n,j,k)
+      for(int n = 0; n < NP; n++){
+        const int njk = n+NP*(j+NP*k);
+        #pragma omp simd private(f)
+        for(int i = 0; i < NP; i++){
+          const int ijk = i+NP*(j+NP*k);
+          real d = dsplit[n+NP*i];
+          real nx = 0.5*(ja[ijk]+ja[njk]);
+          real ny = 0.5*(ja[ijk+NP3]+ja[njk+NP3]);
+          real nz = 0.5*(ja[ijk+2*NP3]+ja[njk+2*NP3]);
+          twopointflux_Euler3D(rho[ijk],u[ijk],v[ijk],w[ijk],p[ijk],
+                               rho[njk],u[njk],v[njk],w[njk],p[njk],nx,ny,nz,gamma,f);
+          for(int ivar = 0; ivar < 5; ivar++) dfl[ijk+NP3*ivar] += d*f[ivar];
+        }
+      }
+
+      // Computational direction 2 : pairs (i,j,k),(i,n,k)
+      for(int n = 0; n < NP; n++){
+        if( n == j ) continue;
+        real d = dsplit[n+NP*j];
+        #pragma omp simd private(f)
+        for(int i = 0; i < NP; i++){
+          const int ijk = i+NP*(j+NP*k);
+          const int ink = i+NP*(n+NP*k);
+          real nx = 0.5*(ja[ijk+3*NP3]+ja[ink+3*NP3]);
+          real ny = 0.5*(ja[ijk+4*NP3]+ja[ink+4*NP3]);
+          real nz = 0.5*(ja[ijk+5*NP3]+ja[ink+5*NP3]);
+          twopointflux_Euler3D(rho[ijk],u[ijk],v[ijk],w[ijk],p[ijk],
+                               rho[ink],u[ink],v[ink],w[ink],p[ink],nx,ny,nz,gamma,f);
+          for(int ivar = 0; ivar < 5; ivar++) dfl[ijk+NP3*ivar] += d*f[ivar];
+        }
+      }
+
+      // Computational direction 3 : pairs (i,j,k),(i,j,n)
+      for(int n = 0; n < NP; n++){
+        if( n == k ) continue;
+        real d = dsplit[n+NP*k];
+        #pragma omp simd private(f)
+        for(int i = 0; i < NP; i++){
+          const int ijk = i+NP*(j+NP*k);
+          const int ijn = i+NP*(j+NP*n);
+          real nx = 0.5*(ja[ijk+6*NP3]+ja[ijn+6*NP3]);
+          real ny = 0.5*(ja[ijk+7*NP3]+ja[ijn+7*NP3]);
+          real nz = 0.5*(ja[ijk+8*NP3]+ja[ijn+8*NP3]);
+          twopointflux_Euler3D(rho[ijk],u[ijk],v[ijk],w[ijk],p[ijk],
+                               rho[ijn],u[ijn],v[ijn],w[ijn],p[ijn],nx,ny,nz,gamma,f);
+          for(int ivar = 0; ivar < 5; ivar++) dfl[ijk+NP3*ivar] += d*f[ivar];
+        }
+      }
+
+    }
+  }
+
+  for(int ivar = 0; ivar < 5; ivar++){
+    #pragma omp simd
+    for(int ijk = 0; ijk < NP3; ijk++){
+      if( accumulate ){
+        df[ijk+ivar*ndof] += dfl[ijk+NP3*ivar];
+      } else {
+        df[ijk+ivar*ndof] = dfl[ijk+NP3*ivar];
+      }
+    }
+  }
+}
+
+typedef void (*FluxDifferencing_Euler3D_fn)(const real*, const real*, const real*, real*, real, int, int, size_t, real*);
+static const FluxDifferencing_Euler3D_fn FluxDifferencing_Euler3D_table[] = SELF_DISPATCH_TABLE(FluxDifferencing_Euler3D_element);
+
+extern "C"
+{
+  void fluxdifferencing_Euler3D_gpu(real *solution, real *dsdx, real *dMatrix, real *df, real gamma, int accumulate, int N, int nel){
+    size_t ndof = (size_t)(N+1)*(N+1)*(N+1)*nel;
+    FluxDifferencing_Euler3D_fn kernel = FluxDifferencing_Euler3D_element<-1>;
+    if( N <= SELF_NMAX_SPECIALIZED ) kernel = FluxDifferencing_Euler3D_table[N];
+
+    #pragma omp parallel
+    {
+      real *work = new real[19*(N+1)*(N+1)*(N+1)+(N+1)*(N+1)];
+      #pragma omp for
+      for(int iel = 0; iel < nel; iel++){
+        kernel(&solution[SC_3D_INDEX(0,0,0,iel,0,N,nel)],
+               &dsdx[TE_3D_INDEX(0,0,0,iel,0,0,0,N,nel,1)],
+               dMatrix, &df[SC_3D_INDEX(0,0,0,iel,0,N,nel)],
+               gamma, accumulate, N, ndof, work);
+      }
+      delete[] work;
+    }
+  }
+}
+
+extern "C"
+{
+  void boundaryflux_Euler3D_gpu(real *fb, real *extfb, real *nhat, real *nmag, real *flux, real gamma, int N, int nel){
+    size_t ndof = (N+1)*(N+1)*6*nel;
+
+    #pragma omp parallel for simd
+    for(size_t idof = 0; idof < ndof; idof++){
+
+      real nx = nhat[idof];
+      real ny = nhat[idof+ndof];
+      real nz = nhat[idof+2*ndof];
+
+      real fl[5];
+      real rho = fb[idof];
+      real un = (fb[idof + ndof]*nx + fb[idof + 2*ndof]*ny + fb[idof + 3*ndof]*nz)/rho;
+      real p = (gamma-1.0)*(fb[idof + 4*ndof] - 0.5*(fb[idof + ndof]*fb[idof + ndof] +
+                                                     fb[idof + 2*ndof]*fb[idof + 2*ndof] +
+                                                     fb[idof + 3*ndof]*fb[idof + 3*ndof])/rho);
+      fl[0] = rho*un; // density
+      fl[1] = fb[idof + ndof]*un + p*nx; // x-momentum
+      fl[2] = fb[idof + 2*ndof]*un + p*ny; // y-momentum
+      fl[3] = fb[idof + 3*ndof]*un + p*nz; // z-momentum
+      fl[4] = (fb[idof + 4*ndof] + p)*un; // total energy
+      real lam = fabs(un) + sqrt(gamma*p/rho);
+
+      real fr[5];
+      rho = extfb[idof];
+      un = (extfb[idof + ndof]*nx + extfb[idof + 2*ndof]*ny + extfb[idof + 3*ndof]*nz)/rho;
+      p = (gamma-1.0)*(extfb[idof + 4*ndof] - 0.5*(extfb[idof + ndof]*extfb[idof + ndof] +
+                                                   extfb[idof + 2*ndof]*extfb[idof + 2*ndof] +
+                                                   extfb[idof + 3*ndof]*extfb[idof + 3*ndof])/rho);
+      fr[0] = rho*un; // density
+      fr[1] = extfb[idof + ndof]*un + p*nx; // x-momentum
+      fr[2] = extfb[idof + 2*ndof]*un + p*ny; // y-momentum
+      fr[3] = extfb[idof + 3*ndof]*un + p*nz; // z-momentum
+      fr[4] = (extfb[idof + 4*ndof] + p)*un; // total energy
+      lam = fmax(lam, fabs(un) + sqrt(gamma*p/rho));
+
+      real nm = nmag[idof];
+      for(int ivar = 0; ivar < 5; ivar++){
+        flux[idof+ivar*ndof] = (0.5*(fl[ivar]+fr[ivar])+0.5*lam*(fb[idof+ivar*ndof]-extfb[idof+ivar*ndof]))*nm;
+      }
+    }
+  }
+}
+
+extern "C"
+{
+  void setboundarycondition_Euler3D_gpu(real *extBoundary, real *boundary, int *sideInfo, real *nhat, int N, int nel){
+
+    #pragma omp parallel for collapse(2)
+    for(int e1 = 0; e1 < nel; e1++){
+      for(int s1 = 0; s1 < 6; s1++){
+        int e2 = sideInfo[INDEX3(2,s1,e1,5,6)];
+        int bcid = sideInfo[INDEX3(4,s1,e1,5,6)];
+        if( e2 != 0 ) continue;
+
+        for(int j = 0; j < N+1; j++){
+          for(int i = 0; i < N+1; i++){
+            if( bcid == SELF_BC_NONORMALFLOW ){
+
+              real ru = boundary[SCB_3D_INDEX(i,j,s1,e1,1,N,nel)];
+              real rv = boundary[SCB_3D_INDEX(i,j,s1,e1,2,N,nel)];
+              real rw = boundary[SCB_3D_INDEX(i,j,s1,e1,3,N,nel)];
+              real nx = nhat[VEB_3D_INDEX(i,j,s1,e1,0,0,N,nel,1)];
+              real ny = nhat[VEB_3D_INDEX(i,j,s1,e1,0,1,N,nel,1)];
+              real nz = nhat[VEB_3D_INDEX(i,j,s1,e1,0,2,N,nel,1)];
+              real mn = ru*nx + rv*ny + rw*nz;
+              extBoundary[SCB_3D_INDEX(i,j,s1,e1,0,N,nel)] = boundary[SCB_3D_INDEX(i,j,s1,e1,0,N,nel)]; // density
+              extBoundary[SCB_3D_INDEX(i,j,s1,e1,1,N,nel)] = ru-2.0*mn*nx; // x-momentum
+              extBoundary[SCB_3D_INDEX(i,j,s1,e1,2,N,nel)] = rv-2.0*mn*ny; // y-momentum
+              extBoundary[SCB_3D_INDEX(i,j,s1,e1,3,N,nel)] = rw-2.0*mn*nz; // z-momentum
+              extBoundary[SCB_3D_INDEX(i,j,s1,e1,4,N,nel)] = boundary[SCB_3D_INDEX(i,j,s1,e1,4,N,nel)]; // total energy
+
+            } else if ( bcid == SELF_BC_RADIATION ){
+
+              for(int ivar = 0; ivar < 5; ivar++){
+                extBoundary[SCB_3D_INDEX(i,j,s1,e1,ivar,N,nel)] = boundary[SCB_3D_INDEX(i,j,s1,e1,ivar,N,nel)];
+              }
+
+            }
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,333 @@
+#include "SELF_GPU_Macros.h"
+
+// Host (OpenMP) implementations of the kernels in src/gpu/SELF_MappedData.cpp
+
+// JacobianWeight functions
+// The functions take in an array of data and divide by the jacobian.
+static void JacobianWeight(real *f, real *jacobian, int ndof, int nVar){
+
+  #pragma omp parallel for collapse(2)
+  for(int ivar = 0; ivar < nVar; ivar++){
+    for(int idof = 0; idof < ndof; idof++){
+      f[idof + (size_t)ndof*ivar] = f[idof + (size_t)ndof*ivar]/jacobian[idof];
+    }
+  }
+}
+
+extern "C"
+{
+  void JacobianWeight_1D_gpu(real *f, real *jacobian, int N, int nVar, int nEl)
+  {
+    JacobianWeight(f, jacobian, (N+1)*nEl, nVar);
+  }
+}
+extern "C"
+{
+  void JacobianWeight_2D_gpu(real *f, real *jacobian, int N, int nVar, int nEl)
+  {
+    JacobianWeight(f, jacobian, (N+1)*(N+1)*nEl, nVar);
+  }
+}
+extern "C"
+{
+  void JacobianWeight_3D_gpu(real *f, real *jacobian, int N, int nVar, int nEl)
+  {
+    JacobianWeight(f, jacobian, (N+1)*(N+1)*(N+1)*nEl, nVar);
+  }
+}
+
+extern "C"
+{
+  void DGDerivative_BoundaryContribution_1D_gpu(real *bMatrix, real *qWeight, real *bf, real *df, int N, int nVar, int nEl)
+  {
+    int ndof = (N+1)*nEl;
+
+    #pragma omp parallel for collapse(2)
+    for(int ivar = 0; ivar < nVar; ivar++){
+      for(int iel = 0; iel < nEl; iel++){
+        for(int i = 0; i < N+1; i++){
+          df[i + (N+1)*iel + (size_t)ndof*ivar] += (bMatrix[i+(N+1)]*bf[SCB_1D_INDEX(1,iel,ivar,nEl)]+
+                                                    bMatrix[i]*bf[SCB_1D_INDEX(0,iel,ivar,nEl)])/qWeight[i];
+        }
+      }
+    }
+  }
+}
+
+extern "C"
+{
+  void SideExchange_2D_gpu(real *extBoundary, real *boundary, int *sideInfo, int *elemToRank, int rankId, int offset, int N, int nVar, int nEl)
+  {
+    #pragma omp parallel for collapse(2)
+    for(int ivar = 0; ivar < nVar; ivar++){
+      for(int e1 = 0; e1 < nEl; e1++){
+        for(int s1 = 0; s1 < 4; s1++){
+          int e2Global = sideInfo[INDEX3(2,s1,e1,5,4)];
+          if(e2Global == 0) continue;
+          if(elemToRank[e2Global-1] != rankId) continue;
+
+          int e2 = e2Global - offset;
+          int s2 = sideInfo[INDEX3(3,s1,e1,5,4)]/10;
+          int flip = sideInfo[INDEX3(3,s1,e1,5,4)]-s2*10;
+
+          for(int i1 = 0; i1 < N+1; i1++){
+            if(flip == 0){
+              extBoundary[SCB_2D_INDEX(i1,s1,e1,ivar,N,nEl)] = boundary[SCB_2D_INDEX(i1,s2-1,e2-1,ivar,N,nEl)];
+            }
+            else if(flip == 1){
+              int i2 = N-i1;
+              extBoundary[SCB_2D_INDEX(i1,s1,e1,ivar,N,nEl)] = boundary[SCB_2D_INDEX(i2,s2-1,e2-1,ivar,N,nEl)];
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+// Halo buffers are ordered as buffer[i + (N+1)*(ivar + nVar*ihalo)] (2-D) and
+// buffer[i + (N+1)*(j + (N+1)*(ivar + nVar*ihalo))] (3-D); see the device kernels in
+// src/gpu/SELF_MappedData.cpp
+extern "C"
+{
+  void PackHalo_2D_gpu(real *sendBuffer, real *boundary, int *haloSide, int *haloElem, int nHaloSides, int N, int nVar, int nEl)
+  {
+    #pragma omp parallel for collapse(2)
+    for(int ihalo = 0; ihalo < nHaloSides; ihalo++){
+      for(int ivar = 0; ivar < nVar; ivar++){
+        int s1 = haloSide[ihalo]-1;
+        int e1 = haloElem[ihalo]-1;
+        for(int i = 0; i < N+1; i++){
+          sendBuffer[i+(N+1)*(ivar + (size_t)nVar*ihalo)] = boundary[SCB_2D_INDEX(i,s1,e1,ivar,N,nEl)];
+        }
+      }
+    }
+  }
+}
+
+extern "C"
+{
+  void UnpackHalo_2D_gpu(real *extBoundary, real *recvBuffer, int *haloSide, int *haloElem, int *haloFlip, int nHaloSides, int N, int nVar, int nEl)
+  {
+    #pragma omp parallel for collapse(2)
+    for(int ihalo = 0; ihalo < nHaloSides; ihalo++){
+      for(int ivar = 0; ivar < nVar; ivar++){
+        int s1 = haloSide[ihalo]-1;
+        int e1 = haloElem[ihalo]-1;
+        for(int i = 0; i < N+1; i++){
+          int i2 = (haloFlip[ihalo] == 1) ? N-i : i;
+          extBoundary[SCB_2D_INDEX(i,s1,e1,ivar,N,nEl)] = recvBuffer[i2+(N+1)*(ivar + (size_t)nVar*ihalo)];
+        }
+      }
+    }
+  }
+}
+
+// Returns the index pair (i2,j2) on the neighboring side that is coincident
+// with (i1,j1) on the local side for the given flip
+static inline void FlipIndex_3D(int i1, int j1, int flip, int N, int *i2, int *j2){
+
+  switch(flip){
+    case 1: *i2 = N-i1; *j2 = j1;   break;
+    case 2: *i2 = N-i1; *j2 = N-j1; break;
+    case 3: *i2 = i1;   *j2 = N-j1; break;
+    case 4: *i2 = j1;   *j2 = i1;   break;
+    case 5: *i2 = N-j1; *j2 = i1;   break;
+    case 6: *i2 = N-j1; *j2 = N-i1; break;
+    case 7: *i2 = j1;   *j2 = N-i1; break;
+    default: *i2 = i1;  *j2 = j1;   break;
+  }
+}
+
+extern "C"
+{
+  void SideExchange_3D_gpu(real *extBoundary, real *boundary, int *sideInfo, int *elemToRank, int rankId, int offset, int N, int nVar, int nEl)
+  {
+    #pragma omp parallel for collapse(2)
+    for(int ivar = 0; ivar < nVar; ivar++){
+      for(int e1 = 0; e1 < nEl; e1++){
+        for(int s1 = 0; s1 < 6; s1++){
+          int e2Global = sideInfo[INDEX3(2,s1,e1,5,6)];
+          if(e2Global == 0) continue;
+          if(elemToRank[e2Global-1] != rankId) continue;
+
+          int e2 = e2Global - offset;
+          int s2 = sideInfo[INDEX3(3,s1,e1,5,6)]/10;
+          int flip = sideInfo[INDEX3(3,s1,e1,5,6)]-s2*10;
+          if(flip < 0 || flip > 7) continue;
+
+          for(int j1 = 0; j1 < N+1; j1++){
+            for(int i1 = 0; i1 < N+1; i1++){
+              int i2, j2;
+              FlipIndex_3D(i1,j1,flip,N,&i2,&j2);
+              extBoundary[SCB_3D_INDEX(i1,j1,s1,e1,ivar,N,nEl)] = boundary[SCB_3D_INDEX(i2,j2,s2-1,e2-1,ivar,N,nEl)];
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+extern "C"
+{
+  void PackHalo_3D_gpu(real *sendBuffer, real *boundary, int *haloSide, int *haloElem, int nHaloSides, int N, int nVar, int nEl)
+  {
+    #pragma omp parallel for collapse(2)
+    for(int ihalo = 0; ihalo < nHaloSides; ihalo++){
+      for(int ivar = 0; ivar < nVar; ivar++){
+        int s1 = haloSide[ihalo]-1;
+        int e1 = haloElem[ihalo]-1;
+        for(int j = 0; j < N+1; j++){
+          for(int i = 0; i < N+1; i++){
+            sendBuffer[i+(N+1)*(j+(N+1)*(ivar + (size_t)nVar*ihalo))] = boundary[SCB_3D_INDEX(i,j,s1,e1,ivar,N,nEl)];
+          }
+        }
+      }
+    }
+  }
+}
+
+extern "C"
+{
+  void UnpackHalo_3D_gpu(real *extBoundary, real *recvBuffer, int *haloSide, int *haloElem, int *haloFlip, int nHaloSides, int N, int nVar, int nEl)
+  {
+    #pragma omp parallel for collapse(2)
+    for(int ihalo = 0; ihalo < nHaloSides; ihalo++){
+      for(int ivar = 0; ivar < nVar; ivar++){
+        int s1 = haloSide[ihalo]-1;
+        int e1 = haloElem[ihalo]-1;
+        for(int j = 0; j < N+1; j++){
+          for(int i = 0; i < N+1; i++){
+            int i2, j2;
+            FlipIndex_3D(i,j,haloFlip[ihalo],N,&i2,&j2);
+            extBoundary[SCB_3D_INDEX(i,j,s1,e1,ivar,N,nEl)] = recvBuffer[i2+(N+1)*(j2+(N+1)*(ivar + (size_t)nVar*ihalo))];
+          }
+        }
+      }
+    }
+  }
+}
+
+static void ContravariantWeight(real *scalar, real *dsdx, real *tensor, int ndof, int nvar, int ntensor){
+
+  #pragma omp parallel for collapse(2)
+  for(int tdim = 0; tdim < ntensor; tdim++){ // tensor dimension (flattened index for the rows and columns of the tensor)
+    for(int ivar = 0; ivar < nvar; ivar++){
+      #pragma omp simd
+      for(int i = 0; i < ndof; i++){
+        tensor[i+(size_t)ndof*(ivar + nvar*tdim)] = dsdx[i+(size_t)ndof*tdim]*scalar[i+(size_t)ndof*ivar];
+      }
+    }
+  }
+}
+
+extern "C"
+{
+  void ContravariantWeight_2D_gpu(real *scalar, real *dsdx, real *tensor, int N, int nvar, int nel)
+  {
+    ContravariantWeight(scalar, dsdx, tensor, (N+1)*(N+1)*nel, nvar, 4);
+  }
+}
+
+extern "C"
+{
+  void ContravariantWeight_3D_gpu(real *scalar, real *dsdx, real *tensor, int N, int nvar, int nel)
+  {
+    ContravariantWeight(scalar, dsdx, tensor, (N+1)*(N+1)*(N+1)*nel, nvar, 9);
+  }
+}
+
+extern "C"
+{
+  void NormalWeight_2D_gpu(real *fb, real *nhat, real *nscale, real *fbn, int N, int nvar, int nel)
+  {
+    size_t ndof = (N+1)*4*nel;
+
+    #pragma omp parallel for collapse(2)
+    for(int ivar = 0; ivar < nvar; ivar++){
+      for(size_t i = 0; i < ndof; i++){
+        real f = fb[i+ndof*ivar];
+        real nmag = nscale[i];
+        fbn[i+ndof*ivar] = f*nhat[i]*nmag; // x-direction
+        fbn[i+ndof*(ivar+nvar)] = f*nhat[i+ndof]*nmag; // y-direction
+      }
+    }
+  }
+}
+
+extern "C"
+{
+  void NormalWeight_3D_gpu(real *fb, real *nhat, real *nscale, real *fbn, int N, int nvar, int nel)
+  {
+    size_t ndof = (N+1)*(N+1)*6*nel;
+
+    #pragma omp parallel for collapse(2)
+    for(int ivar = 0; ivar < nvar; ivar++){
+      for(size_t i = 0; i < ndof; i++){
+        real f = fb[i+ndof*ivar];
+        real nmag = nscale[i];
+        fbn[i+ndof*ivar] = f*nhat[i]*nmag; // x-direction
+        fbn[i+ndof*(ivar+nvar)] = f*nhat[i+ndof]*nmag; // y-direction
+        fbn[i+ndof*(ivar+2*nvar)] = f*nhat[i+2*ndof]*nmag; // z-direction
+      }
+    }
+  }
+}
+
+extern "C"
+{
+  void ContravariantProjection_2D_gpu(real *vector, real *dsdx, int N, int nVar, int nEl)
+  {
+    size_t nq = (N+1)*(N+1);
+
+    #pragma omp parallel for collapse(2)
+    for(int ivar = 0; ivar < nVar; ivar++){
+      for(int iel = 0; iel < nEl; iel++){
+        #pragma omp simd
+        for(size_t iq = 0; iq < nq; iq++){
+          real Fx = vector[iq+ nq*(iel + (size_t)nEl*(ivar))];
+          real Fy = vector[iq+ nq*(iel + (size_t)nEl*(ivar + nVar))];
+
+          vector[iq+ nq*(iel + (size_t)nEl*(ivar))] = dsdx[iq+ nq*(iel)]*Fx + // dsdx(...,0,0)*Fx
+                                                      dsdx[iq+ nq*(iel+nEl)]*Fy; // dsdx(...,1,0)*Fy;
+
+          vector[iq+ nq*(iel + (size_t)nEl*(ivar+nVar))] = dsdx[iq+ nq*(iel+nEl*2)]*Fx + //dsdx(...,0,1)*Fx
+                                                           dsdx[iq+ nq*(iel+nEl*3)]*Fy;  //dsdx(...,1,1)*Fy
+        }
+      }
+    }
+  }
+}
+
+extern "C"
+{
+  void ContravariantProjection_3D_gpu(real *vector, real *dsdx, int N, int nvar, int nel)
+  {
+    size_t nq = (N+1)*(N+1)*(N+1);
+
+    #pragma omp parallel for collapse(2)
+    for(int ivar = 0; ivar < nvar; ivar++){
+      for(int iel = 0; iel < nel; iel++){
+        #pragma omp simd
+        for(size_t iq = 0; iq < nq; iq++){
+          real Fx = vector[iq+ nq*(iel + (size_t)nel*(ivar))];
+          real Fy = vector[iq+ nq*(iel + (size_t)nel*(ivar + nvar))];
+          real Fz = vector[iq+ nq*(iel + (size_t)nel*(ivar + 2*nvar))];
+
+          vector[iq+ nq*(iel + (size_t)nel*(ivar))] = dsdx[iq+ nq*iel]*Fx +
+                                                      dsdx[iq+ nq*(iel+nel)]*Fy +
+                                                      dsdx[iq+ nq*(iel+2*nel)]*Fz;
+
+          vector[iq+ nq*(iel + (size_t)nel*(ivar + nvar))] = dsdx[iq+ nq*(iel+3*nel)]*Fx +
+                                                             dsdx[iq+ nq*(iel+4*nel)]*Fy +
+                                                             dsdx[iq+ nq*(iel+5*nel)]*Fz;
+
+          vector[iq+ nq*(iel + (size_t)nel*(ivar + 2*nvar))] = dsdx[iq+ nq*(iel+6*nel)]*Fx +
+                                                               dsdx[iq+ nq*(iel+7*nel)]*Fy +
+                                                               dsdx[iq+ nq*(iel+8*nel)]*Fz;
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,116 @@
+#include "SELF_GPU_Macros.h"
+#include <cmath>
+
+// Host (OpenMP) implementations of the kernels in src/gpu/SELF_Model.cpp
+
+extern "C"
+{
+  void UpdateSolution_gpu(real *solution, real *dSdt, real dt, int ndof)
+  {
+    #pragma omp parallel for simd
+    for(int i = 0; i < ndof; i++){
+      solution[i] += dt*dSdt[i];
+    }
+  }
+}
+
+extern "C"
+{
+  void UpdateGRK_gpu(real *grk, real *solution, real *source, real *fluxDivergence, real rk_a, real rk_g, real dt, int ndof)
+  {
+    #pragma omp parallel for simd
+    for(int i = 0; i < ndof; i++){
+      grk[i] = rk_a*grk[i] + source[i] - fluxDivergence[i];
+      solution[i] += rk_g*dt*grk[i];
+    }
+  }
+}
+
+extern "C"
+{
+  void StoreERKStage_gpu(real *stages, real *src, int m, int ndof)
+  {
+    #pragma omp parallel for simd
+    for(int i = 0; i < ndof; i++){
+      stages[i+(size_t)m*ndof] = src[i];
+    }
+  }
+}
+
+extern "C"
+{
+  void UpdateERK_gpu(real *solution, real *stages, real *w, int nw, int ndof)
+  {
+    #pragma omp parallel for
+    for(int i = 0; i < ndof; i++){
+      real s = stages[i];
+      for(int m = 0; m < nw; m++){
+        s += w[m]*stages[i+(size_t)(m+1)*ndof];
+      }
+      solution[i] = s;
+    }
+  }
+}
+
+extern "C"
+{
+  void ERKErrorNorm_gpu(real *partial, real *solution, real *stages, real *w, int nw, real abstol, real reltol, int ndof)
+  {
+    // Partial sums are formed over blocks of 256 degrees of freedom,
+    // as in the device kernel
+    int nblocks = ndof/256 + 1;
+    #pragma omp parallel for
+    for(int b = 0; b < nblocks; b++){
+      real e2 = 0.0;
+      for(int i = b*256; i < (b+1)*256 && i < ndof; i++){
+        real e = 0.0;
+        for(int m = 0; m < nw; m++){
+          e += w[m]*stages[i+(size_t)(m+1)*ndof];
+        }
+        real sc = abstol + reltol*std::fmax(std::fabs(stages[i]),std::fabs(solution[i]));
+        e2 += (e/sc)*(e/sc);
+      }
+      partial[b] = e2;
+    }
+  }
+}
+
+extern "C"
+{
+  void UpdateGAB_gpu(real *history, real *dSdt, real *w, int nw, int head, int ndof)
+  {
+    #pragma omp parallel for
+    for(int i = 0; i < ndof; i++){
+      history[i+(size_t)head*ndof] = dSdt[i];
+      real s = 0.0;
+      for(int m = 0; m < nw; m++){
+        s += w[m]*history[i+(size_t)m*ndof];
+      }
+      dSdt[i] = s;
+    }
+  }
+}
+
+extern "C"
+{
+  void CalculateDSDt_gpu(real *fluxDivergence, real *source, real *dSdt, int ndof)
+  {
+    #pragma omp parallel for simd
+    for(int i = 0; i < ndof; i++){
+      dSdt[i] = source[i]-fluxDivergence[i];
+    }
+  }
+}
+
+extern "C"
+{
+  void GradientNormal_1d_gpu(real *fbn, real *fbavg, int ndof){
+    // The boundary normal is -1 on the left side (even i) of each element
+    // and +1 on the right side (odd i)
+    #pragma omp parallel for simd
+    for(int i = 0; i < ndof; i++){
+      real nhat = 2.0*(i%2)-1.0;
+      fbn[i] = nhat*fbavg[i];
+    }
+  }
+}
@@ -0,0 +1,235 @@
+#ifndef SELF_TENSORKERNELS_H
+#define SELF_TENSORKERNELS_H
+
+#include "SELF_GPU_Macros.h"
+
+// Tensor-product kernels specialized at compile time on the polynomial degree.
+//
+// With N known at compile time, the ii=0..N reductions and the loops over the
+// quadrature points of a line have constant trip counts. The compiler can then
+// fully unroll the reductions, keep a line of output values in registers, and
+// vectorize across the i index. Each kernel is instantiated for degrees
+// 0..SELF_NMAX_SPECIALIZED and selected at runtime from a dispatch table built
+// with SELF_DISPATCH_TABLE. Degrees above SELF_NMAX_SPECIALIZED fall back to the
+// runtime-N kernels in SELF_Data.cpp.
+//
+// The data layouts are the same as for the GPU kernels (see SC_3D_INDEX,
+// SCB_3D_INDEX and VE_3D_INDEX in SELF_GPU_Macros.h), and every kernel works on
+// a single (element, variable) pair so that the callers can thread over
+// elements and variables with OpenMP.
+
+#define SELF_NMAX_SPECIALIZED 15
+
+#define SELF_DISPATCH_TABLE(kernel) { kernel<0>, kernel<1>, kernel<2>, kernel<3>, \
+                                      kernel<4>, kernel<5>, kernel<6>, kernel<7>, \
+                                      kernel<8>, kernel<9>, kernel<10>, kernel<11>, \
+                                      kernel<12>, kernel<13>, kernel<14>, kernel<15> }
+
+// Computes df = D_x f1 + D_y f2 for one element and variable, where D is the
+// (N+1)x(N+1) derivative matrix stored as dmatrix[ii+(N+1)*i]. f1, f2 and df
+// point to the first quadrature point of the element/variable block.
+template <int N>
+static void Divergence_2D_element(const real *__restrict__ f1, const real *__restrict__ f2,
+                                  real *__restrict__ df, const real *__restrict__ dmatrix){
+
+  constexpr int NP = N+1;
+  real dmT[NP*NP]; // transpose of the derivative matrix, so that the i loop is unit stride
+  for(int i = 0; i < NP; i++){
+    for(int ii = 0; ii < NP; ii++){
+      dmT[i+NP*ii] = dmatrix[ii+NP*i];
+    }
+  }
+
+  for(int j = 0; j < NP; j++){
+    real dfloc[NP];
+    #pragma omp simd
+    for(int i = 0; i < NP; i++) dfloc[i] = 0.0;
+
+    for(int ii = 0; ii < NP; ii++){
+      real dmj = dmatrix[ii+NP*j];
+      real f1ij = f1[ii+NP*j];
+      #pragma omp simd
+      for(int i = 0; i < NP; i++){
+        dfloc[i] += dmT[i+NP*ii]*f1ij + dmj*f2[i+NP*ii];
+      }
+    }
+
+    #pragma omp simd
+    for(int i = 0; i < NP; i++) df[i+NP*j] = dfloc[i];
+  }
+}
+
+// Computes df = D_x f1 + D_y f2 + D_z f3 for one element and variable
+template <int N>
+static void Divergence_3D_element(const real *__restrict__ f1, const real *__restrict__ f2,
+                                  const real *__restrict__ f3, real *__restrict__ df,
+                                  const real *__restrict__ dmatrix){
+
+  constexpr int NP = N+1;
+  real dmT[NP*NP]; // transpose of the derivative matrix, so that the i loop is unit stride
+  for(int i = 0; i < NP; i++){
+    for(int ii = 0; ii < NP; ii++){
+      dmT[i+NP*ii] = dmatrix[ii+NP*i];
+    }
+  }
+
+  for(int k = 0; k < NP; k++){
+    for(int j = 0; j < NP; j++){
+      real dfloc[NP];
+      #pragma omp simd
+      for(int i = 0; i < NP; i++) dfloc[i] = 0.0;
+
+      for(int ii = 0; ii < NP; ii++){
+        real f1ijk = f1[ii+NP*(j+NP*k)];
+        real dmj = dmatrix[ii+NP*j];
+        real dmk = dmatrix[ii+NP*k];
+        #pragma omp simd
+        for(int i = 0; i < NP; i++){
+          dfloc[i] += dmT[i+NP*ii]*f1ijk +
+                      dmj*f2[i+NP*(ii+NP*k)] +
+                      dmk*f3[i+NP*(j+NP*ii)];
+        }
+      }
+
+      #pragma omp simd
+      for(int i = 0; i < NP; i++) df[i+NP*(j+NP*k)] = dfloc[i];
+    }
+  }
+}
+
+// Interpolates one element/variable block of a 2-D scalar to the element sides.
+// fb points to the first side point of the element/variable block in the
+// SCB_2D_INDEX layout.
+template <int N>
+static void BoundaryInterp_2D_element(const real *__restrict__ f, real *__restrict__ fb,
+                                      const real *__restrict__ bMatrix){
+
+  constexpr int NP = N+1;
+  real fbs[NP] = {0.0}, fbn[NP] = {0.0}, fbw[NP] = {0.0}, fbe[NP] = {0.0};
+
+  for(int ii = 0; ii < NP; ii++){
+    real bl = bMatrix[ii];
+    real br = bMatrix[ii+NP];
+    #pragma omp simd
+    for(int i = 0; i < NP; i++){
+      fbs[i] += f[i+NP*ii]*bl; // South
+      fbn[i] += f[i+NP*ii]*br; // North
+    }
+  }
+  for(int i = 0; i < NP; i++){
+    for(int ii = 0; ii < NP; ii++){
+      fbw[i] += f[ii+NP*i]*bMatrix[ii]; // West
+      fbe[i] += f[ii+NP*i]*bMatrix[ii+NP]; // East
+    }
+  }
+
+  #pragma omp simd
+  for(int i = 0; i < NP; i++){
+    fb[i] = fbs[i];
+    fb[i+NP] = fbe[i];
+    fb[i+2*NP] = fbn[i];
+    fb[i+3*NP] = fbw[i];
+  }
+}
+
+// Interpolates one element/variable block of a 3-D scalar to the element sides.
+// fb points to the first side point of the element/variable block in the
+// SCB_3D_INDEX layout.
+template <int N>
+static void BoundaryInterp_3D_element(const real *__restrict__ f, real *__restrict__ fb,
+                                      const real *__restrict__ bMatrix){
+
+  constexpr int NP = N+1;
+  constexpr int NP2 = NP*NP;
+
+  for(int j = 0; j < NP; j++){
+    real fbb[NP] = {0.0}, fbs[NP] = {0.0}, fbe[NP] = {0.0};
+    real fbn[NP] = {0.0}, fbw[NP] = {0.0}, fbt[NP] = {0.0};
+
+    for(int ii = 0; ii < NP; ii++){
+      real bl = bMatrix[ii];
+      real br = bMatrix[ii+NP];
+      #pragma omp simd
+      for(int i = 0; i < NP; i++){
+        fbb[i] += f[i+NP*(j+NP*ii)]*bl; // Bottom
+        fbt[i] += f[i+NP*(j+NP*ii)]*br; // Top
+        fbs[i] += f[i+NP*(ii+NP*j)]*bl; // South
+        fbn[i] += f[i+NP*(ii+NP*j)]*br; // North
+      }
+    }
+    for(int i = 0; i < NP; i++){
+      for(int ii = 0; ii < NP; ii++){
+        fbw[i] += f[ii+NP*(i+NP*j)]*bMatrix[ii]; // West
+        fbe[i] += f[ii+NP*(i+NP*j)]*bMatrix[ii+NP]; // East
+      }
+    }
+
+    #pragma omp simd
+    for(int i = 0; i < NP; i++){
+      fb[i+NP*j] = fbb[i];
+      fb[i+NP*j+NP2] = fbs[i];
+      fb[i+NP*j+2*NP2] = fbe[i];
+      fb[i+NP*j+3*NP2] = fbn[i];
+      fb[i+NP*j+4*NP2] = fbw[i];
+      fb[i+NP*j+5*NP2] = fbt[i];
+    }
+  }
+}
+
+// Adds the weak form boundary terms to df for one element/variable block of a
+// 2-D divergence. bf points to the first side point of the element/variable
+// block in the SCB_2D_INDEX layout.
+template <int N>
+static void DG_BoundaryContribution_2D_element(const real *__restrict__ bf, real *__restrict__ df,
+                                               const real *__restrict__ bMatrix,
+                                               const real *__restrict__ qWeights){
+
+  constexpr int NP = N+1;
+  real lw[NP], rw[NP]; // boundary interpolants divided by the quadrature weights
+  for(int i = 0; i < NP; i++){
+    lw[i] = bMatrix[i]/qWeights[i];
+    rw[i] = bMatrix[i+NP]/qWeights[i];
+  }
+
+  for(int j = 0; j < NP; j++){
+    real bfe = bf[j+NP]; // east
+    real bfw = bf[j+3*NP]; // west
+    #pragma omp simd
+    for(int i = 0; i < NP; i++){
+      df[i+NP*j] += rw[i]*bfe + lw[i]*bfw +
+                    rw[j]*bf[i+2*NP] + lw[j]*bf[i]; // north + south
+    }
+  }
+}
+
+// Adds the weak form boundary terms to df for one element/variable block of a
+// 3-D divergence. bf points to the first side point of the element/variable
+// block in the SCB_3D_INDEX layout.
+template <int N>
+static void DG_BoundaryContribution_3D_element(const real *__restrict__ bf, real *__restrict__ df,
+                                               const real *__restrict__ bMatrix,
+                                               const real *__restrict__ qWeights){
+
+  constexpr int NP = N+1;
+  constexpr int NP2 = NP*NP;
+  real lw[NP], rw[NP]; // boundary interpolants divided by the quadrature weights
+  for(int i = 0; i < NP; i++){
+    lw[i] = bMatrix[i]/qWeights[i];
+    rw[i] = bMatrix[i+NP]/qWeights[i];
+  }
+
+  for(int k = 0; k < NP; k++){
+    for(int j = 0; j < NP; j++){
+      real bfe = bf[j+NP*k+2*NP2]; // east
+      real bfw = bf[j+NP*k+4*NP2]; // west
+      #pragma omp simd
+      for(int i = 0; i < NP; i++){
+        df[i+NP*(j+NP*k)] += rw[k]*bf[i+NP*j+5*NP2] + lw[k]*bf[i+NP*j] + // top + bottom
+                             rw[i]*bfe + lw[i]*bfw + // east + west
+                             rw[j]*bf[i+NP*k+3*NP2] + lw[j]*bf[i+NP*k+NP2]; // north + south
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,38 @@
+#include "SELF_GPU_Macros.h"
+#include <math.h>
+
+// Host (OpenMP) implementations of the kernels in src/gpu/SELF_advection_diffusion_1d.cpp
+
+extern "C"
+{
+  void setboundarycondition_advection_diffusion_1d_gpu(real *extBoundary, real *boundary, int nel, int nvar){
+    // Periodic boundary conditions
+    for(int ivar = 0; ivar < nvar; ivar++){
+      extBoundary[SCB_1D_INDEX(0,0,ivar,nel)] = boundary[SCB_1D_INDEX(1,nel-1,ivar,nel)];
+      extBoundary[SCB_1D_INDEX(1,nel-1,ivar,nel)] = boundary[SCB_1D_INDEX(0,0,ivar,nel)];
+    }
+  }
+}
+
+extern "C"
+{
+  void fluxmethod_advection_diffusion_1d_gpu(real *solution, real *solutiongradient, real *flux, real u, real nu, int ndof){
+    #pragma omp parallel for simd
+    for(int i = 0; i < ndof; i++){
+      flux[i] = u*solution[i] - nu*solutiongradient[i];
+    }
+  }
+}
+
+extern "C"
+{
+  void boundaryflux_advection_diffusion_1d_gpu(real *fb, real *fextb, real *dfavg, real *flux, real u, real nu, int ndof){
+    // when i is even, we are looking at the left side of the element and the boundary normal is negative
+    // when i is odd, we are looking at the right side of the element and boundary normal is positive
+    #pragma omp parallel for simd
+    for(int i = 0; i < ndof; i++){
+      real nhat = 2.0*(i%2)-1.0;
+      flux[i] = 0.5*(u*nhat*(fb[i]+fextb[i]) + fabs(u*nhat)*(fb[i]-fextb[i])) - nu*dfavg[i]*nhat;
+    }
+  }
+}
@@ -0,0 +1,87 @@
+#include "SELF_GPU_Macros.h"
+#include <math.h>
+
+// Host (OpenMP) implementations of the kernels in src/gpu/SELF_advection_diffusion_2d.cpp
+
+extern "C"
+{
+  void setboundarycondition_advection_diffusion_2d_gpu(real *extBoundary, real *boundary, int *sideInfo, int N, int nel, int nvar){
+
+    #pragma omp parallel for collapse(2)
+    for(int ivar = 0; ivar < nvar; ivar++){
+      for(int e1 = 0; e1 < nel; e1++){
+        for(int s1 = 0; s1 < 4; s1++){
+          if( sideInfo[INDEX3(2,s1,e1,5,4)] != 0 ) continue;
+          for(int i = 0; i < N+1; i++){
+            extBoundary[SCB_2D_INDEX(i,s1,e1,ivar,N,nel)] = 0.0;
+          }
+        }
+      }
+    }
+  }
+}
+
+extern "C"
+{
+  void setgradientboundarycondition_advection_diffusion_2d_gpu(real *extBoundary, real *boundary, int *sideInfo, int N, int nel, int nvar){
+
+    #pragma omp parallel for collapse(3)
+    for(int idir = 0; idir < 2; idir++){
+      for(int ivar = 0; ivar < nvar; ivar++){
+        for(int e1 = 0; e1 < nel; e1++){
+          for(int s1 = 0; s1 < 4; s1++){
+            if( sideInfo[INDEX3(2,s1,e1,5,4)] != 0 ) continue;
+            for(int i = 0; i < N+1; i++){
+              extBoundary[VEB_2D_INDEX(i,s1,e1,ivar,idir,N,nel,nvar)] = boundary[VEB_2D_INDEX(i,s1,e1,ivar,idir,N,nel,nvar)];
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+extern "C"
+{
+  void fluxmethod_advection_diffusion_2d_gpu(real *solution, real *solutiongradient, real *flux, real u, real v, real nu, int N, int nel, int nvar){
+    size_t ndof = (N+1)*(N+1)*nel*nvar;
+
+    #pragma omp parallel for simd
+    for(size_t i = 0; i < ndof; i++){
+      flux[i] = u*solution[i] - nu*solutiongradient[i];
+      flux[i+ndof] = v*solution[i] - nu*solutiongradient[i+ndof];
+    }
+  }
+}
+
+extern "C"
+{
+  void boundaryflux_advection_diffusion_2d_gpu(real *fb, real *fextb, real *dfavg, real *nhat, real *nscale, real *flux, real u, real v, real nu, int N, int nel, int nvar){
+    size_t ndof = (N+1)*4*nel;
+
+    #pragma omp parallel for collapse(2)
+    for(int ivar = 0; ivar < nvar; ivar++){
+      for(int iel = 0; iel < nel; iel++){
+        for(int j = 0; j < 4; j++){
+          for(int i = 0; i < N+1; i++){
+            size_t idof = SCB_2D_INDEX(i,j,iel,0,N,nel);
+
+            real nx = nhat[VEB_2D_INDEX(i,j,iel,0,0,N,nel,1)];
+            real ny = nhat[VEB_2D_INDEX(i,j,iel,0,1,N,nel,1)];
+
+            real un = u*nx+v*ny;
+
+            real dfdn = dfavg[VEB_2D_INDEX(i,j,iel,ivar,0,N,nel,nvar)]*nx+
+                        dfavg[VEB_2D_INDEX(i,j,iel,ivar,1,N,nel,nvar)]*ny;
+
+            real nmag = nscale[idof];
+
+            flux[idof+ivar*ndof] = (0.5*(un*(fb[idof+ivar*ndof]+fextb[idof+ivar*ndof])+
+                                    fabs(un)*(fb[idof+ivar*ndof]-fextb[idof+ivar*ndof]))-
+                                    nu*dfdn)*nmag;
+          }
+        }
+      }
+    }
+  }
+}
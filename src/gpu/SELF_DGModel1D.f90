@@ -56,8 +56,16 @@ module SELF_DGModel1D
     procedure :: UpdateGRK2 => UpdateGRK2_DGModel1D
     procedure :: UpdateGRK3 => UpdateGRK3_DGModel1D
     procedure :: UpdateGRK4 => UpdateGRK4_DGModel1D
+    procedure :: UpdateGLSRK => UpdateGLSRK_DGModel1D
+
+    procedure :: StoreERKStage => StoreERKStage_DGModel1D
+    procedure :: UpdateERK => UpdateERK_DGModel1D
+    procedure :: ERKErrorNorm => ERKErrorNorm_DGModel1D
+
+    procedure :: UpdateGAB => UpdateGAB_DGModel1D
 
     procedure :: CalculateSolutionGradient => CalculateSolutionGradient_DGModel1D
+    procedure :: CalculateFluxDivergence => CalculateFluxDivergence_DGModel1D
     procedure :: CalculateTendency => CalculateTendency_DGModel1D
 
   endtype DGModel1D
@@ -93,7 +101,8 @@ contains
     integer :: ndof
 
     ndof = this%solution%nvar*this%solution%nelem*(this%solution%interp%N+1)
-    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu,this%dsdt%interior_gpu, &
+    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu, &
+                       this%source%interior_gpu,this%fluxDivergence%interior_gpu, &
                        rk2_a(m),rk2_g(m),this%dt,ndof)
 
   endsubroutine UpdateGRK2_DGModel1D
@@ -106,7 +115,8 @@ contains
     integer :: ndof
 
     ndof = this%solution%nvar*this%solution%nelem*(this%solution%interp%N+1)
-    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu,this%dsdt%interior_gpu, &
+    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu, &
+                       this%source%interior_gpu,this%fluxDivergence%interior_gpu, &
                        rk3_a(m),rk3_g(m),this%dt,ndof)
 
   endsubroutine UpdateGRK3_DGModel1D
@@ -119,11 +129,105 @@ contains
     integer :: ndof
 
     ndof = this%solution%nvar*this%solution%nelem*(this%solution%interp%N+1)
-    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu,this%dsdt%interior_gpu, &
+    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu, &
+                       this%source%interior_gpu,this%fluxDivergence%interior_gpu, &
                        rk4_a(m),rk4_g(m),this%dt,ndof)
 
   endsubroutine UpdateGRK4_DGModel1D
 
+  subroutine UpdateGLSRK_DGModel1D(this,m)
+    implicit none
+    class(DGModel1D),intent(inout) :: this
+    integer,intent(in) :: m
+    ! Local
+    integer :: ndof
+
+    ndof = this%solution%nvar*this%solution%nelem*(this%solution%interp%N+1)
+    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu, &
+                       this%source%interior_gpu,this%fluxDivergence%interior_gpu, &
+                       this%lsrk_a(m),this%lsrk_g(m),this%dt,ndof)
+
+  endsubroutine UpdateGLSRK_DGModel1D
+
+  subroutine StoreERKStage_DGModel1D(this,m)
+    implicit none
+    class(DGModel1D),intent(inout) :: this
+    integer,intent(in) :: m
+    ! Local
+    integer :: ndof
+
+    ndof = this%solution%nvar*this%solution%nelem*(this%solution%interp%N+1)
+
+    if(m == 0) then
+      call this%ReserveERKStages()
+      call StoreERKStage_gpu(this%erkStages%interior_gpu,this%solution%interior_gpu,m,ndof)
+    else
+      call StoreERKStage_gpu(this%erkStages%interior_gpu,this%dsdt%interior_gpu,m,ndof)
+    endif
+
+  endsubroutine StoreERKStage_DGModel1D
+
+  subroutine UpdateERK_DGModel1D(this,w)
+    implicit none
+    class(DGModel1D),intent(inout) :: this
+    real(prec),intent(in) :: w(:)
+    ! Local
+    integer :: ndof
+    real(prec) :: wloc(1:SELF_ERK_MAX_STAGES)
+
+    ndof = this%solution%nvar*this%solution%nelem*(this%solution%interp%N+1)
+
+    wloc(1:size(w)) = w
+    call UpdateERK_gpu(this%solution%interior_gpu,this%erkStages%interior_gpu,wloc,size(w),ndof)
+
+  endsubroutine UpdateERK_DGModel1D
+
+  function ERKErrorNorm_DGModel1D(this,w) result(err)
+    !! The error norm is reduced in two passes; each block of 256 degrees of freedom is
+    !! summed on the device, into workSol, and the block sums are added on the host
+    implicit none
+    class(DGModel1D),intent(inout) :: this
+    real(prec),intent(in) :: w(:)
+    real(prec) :: err
+    ! Local
+    integer :: ndof,nblocks
+    real(prec) :: wloc(1:SELF_ERK_MAX_STAGES)
+    real(prec),allocatable,target :: partial(:)
+
+    ndof = this%solution%nvar*this%solution%nelem*(this%solution%interp%N+1)
+    nblocks = ndof/256+1
+    allocate(partial(1:nblocks))
+
+    wloc(1:size(w)) = w
+    call ERKErrorNorm_gpu(this%workSol%interior_gpu,this%solution%interior_gpu,this%erkStages%interior_gpu, &
+                          wloc,size(w),this%abstol,this%reltol,ndof)
+
+    call gpuCheck(hipMemcpy(c_loc(partial), &
+                            this%workSol%interior_gpu,sizeof(partial), &
+                            hipMemcpyDeviceToHost))
+
+    err = sqrt(sum(partial)/real(ndof,prec))
+
+    deallocate(partial)
+
+  endfunction ERKErrorNorm_DGModel1D
+
+  subroutine UpdateGAB_DGModel1D(this,w)
+    implicit none
+    class(DGModel1D),intent(inout) :: this
+    real(prec),intent(in) :: w(:)
+    ! Local
+    integer :: ndof
+    real(prec) :: wloc(1:SELF_ERK_MAX_STAGES)
+
+    ndof = this%solution%nvar*this%solution%nelem*(this%solution%interp%N+1)
+
+    call this%ReserveABHistory()
+    wloc(1:size(w)) = w
+    call UpdateGAB_gpu(this%abHistory%interior_gpu,this%dsdt%interior_gpu,wloc,size(w),this%ab_head,ndof)
+
+  endsubroutine UpdateGAB_DGModel1D
+
   subroutine CalculateSolutionGradient_DGModel1D(this)
     implicit none
     class(DGModel1D),intent(inout) :: this
@@ -322,11 +426,9 @@ contains
     implicit none
     class(DGModel1D),intent(inout) :: this
     ! Local
-    integer :: iel
-    integer :: iside
-    real(prec) :: fin(1:this%solution%nvar)
-    real(prec) :: fout(1:this%solution%nvar)
-    real(prec) :: dfdx(1:this%solution%nvar),nhat
+    integer :: ndof,n
+    real(prec),pointer :: fin(:,:),fout(:,:),dfdx(:,:),fb(:,:)
+    real(prec),allocatable :: nhat(:)
 
     call gpuCheck(hipMemcpy(c_loc(this%solution%boundary), &
                             this%solution%boundary_gpu,sizeof(this%solution%boundary), &
@@ -340,23 +442,21 @@ contains
                             this%solutiongradient%avgboundary_gpu,sizeof(this%solutiongradient%avgboundary), &
                             hipMemcpyDeviceToHost))
 
-    do concurrent(iside=1:2,iel=1:this%mesh%nElem)
-
-      ! set the normal velocity
-      if(iside == 1) then
-        nhat = -1.0_prec
-      else
-        nhat = 1.0_prec
-      endif
-
-      fin = this%solution%boundary(iside,iel,1:this%solution%nvar) ! interior solution
-      fout = this%solution%extboundary(iside,iel,1:this%solution%nvar) ! exterior solution
-      dfdx = this%solutionGradient%avgboundary(iside,iel,1:this%solution%nvar) ! average solution gradient (with direction taken into account)
-      this%flux%boundarynormal(iside,iel,1:this%solution%nvar) = &
-        this%riemannflux1d(fin,fout,dfdx,nhat)
+    ndof = 2*this%mesh%nElem
+    allocate(nhat(1:ndof))
+    fin(1:ndof,1:this%solution%nvar) => this%solution%boundary ! interior solution
+    fout(1:ndof,1:this%solution%nvar) => this%solution%extboundary ! exterior solution
+    dfdx(1:ndof,1:this%solution%nvar) => this%solutionGradient%avgboundary ! average solution gradient
+    fb(1:ndof,1:this%solution%nvar) => this%flux%boundarynormal
 
+    ! set the normal velocity; side 1 is the left side of each element
+    do concurrent(n=1:ndof)
+      nhat(n) = real(2*mod(n-1,2)-1,prec)
     enddo
 
+    call this%riemannflux1d_batch(fin,fout,dfdx,nhat,fb)
+    deallocate(nhat)
+
     call gpuCheck(hipMemcpy(this%flux%boundarynormal_gpu, &
                             c_loc(this%flux%boundarynormal), &
                             sizeof(this%flux%boundarynormal), &
@@ -368,19 +468,14 @@ contains
     implicit none
     class(DGModel1D),intent(inout) :: this
     ! Local
-    integer :: iel
-    integer :: i
-    real(prec) :: f(1:this%solution%nvar),dfdx(1:this%solution%nvar)
-
-    do concurrent(i=1:this%solution%N+1,iel=1:this%mesh%nElem)
-
-      f = this%solution%interior(i,iel,1:this%solution%nvar)
-      dfdx = this%solutionGradient%interior(i,iel,1:this%solution%nvar)
-
-      this%flux%interior(i,iel,1:this%solution%nvar) = &
-        this%flux1d(f,dfdx)
+    integer :: ndof
+    real(prec),pointer :: f(:,:),dfdx(:,:),flux(:,:)
 
-    enddo
+    ndof = (this%solution%N+1)*this%mesh%nElem
+    f(1:ndof,1:this%solution%nvar) => this%solution%interior
+    dfdx(1:ndof,1:this%solution%nvar) => this%solutionGradient%interior
+    flux(1:ndof,1:this%solution%nvar) => this%flux%interior
+    call this%flux1d_batch(f,dfdx,flux)
 
     call gpuCheck(hipMemcpy(this%flux%interior_gpu, &
                             c_loc(this%flux%interior), &
@@ -393,9 +488,8 @@ contains
     implicit none
     class(DGModel1D),intent(inout) :: this
     ! Local
-    integer :: iel
-    integer :: i
-    real(prec) :: f(1:this%solution%nvar),dfdx(1:this%solution%nvar)
+    integer :: ndof
+    real(prec),pointer :: f(:,:),dfdx(:,:),src(:,:)
 
     call gpuCheck(hipMemcpy(c_loc(this%solution%interior), &
                             this%solution%interior_gpu,sizeof(this%solution%interior), &
@@ -405,15 +499,11 @@ contains
                             this%solutiongradient%interior_gpu,sizeof(this%solutiongradient%interior), &
                             hipMemcpyDeviceToHost))
 
-    do concurrent(i=1:this%solution%N+1,iel=1:this%mesh%nElem)
-
-      f = this%solution%interior(i,iel,1:this%solution%nvar)
-      dfdx = this%solutionGradient%interior(i,iel,1:this%solution%nvar)
-
-      this%source%interior(i,iel,1:this%solution%nvar) = &
-        this%source1d(f,dfdx)
-
-    enddo
+    ndof = (this%solution%N+1)*this%mesh%nElem
+    f(1:ndof,1:this%solution%nvar) => this%solution%interior
+    dfdx(1:ndof,1:this%solution%nvar) => this%solutionGradient%interior
+    src(1:ndof,1:this%solution%nvar) => this%source%interior
+    call this%source1d_batch(f,dfdx,src)
 
     call gpuCheck(hipMemcpy(this%source%interior_gpu, &
                             c_loc(this%source%interior), &
@@ -422,11 +512,10 @@ contains
 
   endsubroutine sourcemethod_DGModel1D
 
-  subroutine CalculateTendency_DGModel1D(this)
+  subroutine CalculateFluxDivergence_DGModel1D(this)
+    !! Calculates the source and the flux divergence, without assembling the tendency dSdt
     implicit none
     class(DGModel1D),intent(inout) :: this
-    ! Local
-    integer :: ndof
 
     call this%solution%BoundaryInterp()
     call this%solution%SideExchange(this%mesh)
@@ -447,6 +536,16 @@ contains
 
     call this%flux%MappedDGDerivative(this%fluxDivergence%interior_gpu)
 
+  endsubroutine CalculateFluxDivergence_DGModel1D
+
+  subroutine CalculateTendency_DGModel1D(this)
+    implicit none
+    class(DGModel1D),intent(inout) :: this
+    ! Local
+    integer :: ndof
+
+    call this%CalculateFluxDivergence()
+
     ndof = this%solution%nvar*this%solution%nelem*(this%solution%interp%N+1)
     call CalculateDSDt_gpu(this%fluxDivergence%interior_gpu,this%source%interior_gpu, &
                            this%dsdt%interior_gpu,ndof)
@@ -48,8 +48,17 @@ module SELF_DGModel2D
     procedure :: UpdateGRK2 => UpdateGRK2_DGModel2D
     procedure :: UpdateGRK3 => UpdateGRK3_DGModel2D
     procedure :: UpdateGRK4 => UpdateGRK4_DGModel2D
+    procedure :: UpdateGLSRK => UpdateGLSRK_DGModel2D
+
+    procedure :: StoreERKStage => StoreERKStage_DGModel2D
+    procedure :: UpdateERK => UpdateERK_DGModel2D
+    procedure :: ERKErrorNorm => ERKErrorNorm_DGModel2D
+
+    procedure :: UpdateGAB => UpdateGAB_DGModel2D
 
     procedure :: CalculateSolutionGradient => CalculateSolutionGradient_DGModel2D
+    procedure :: FluxDivergenceVolume => FluxDivergenceVolume_DGModel2D
+    procedure :: CalculateFluxDivergence => CalculateFluxDivergence_DGModel2D
     procedure :: CalculateTendency => CalculateTendency_DGModel2D
 
   endtype DGModel2D
@@ -92,7 +101,8 @@ contains
            (this%solution%interp%N+1)* &
            (this%solution%interp%N+1)
 
-    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu,this%dsdt%interior_gpu, &
+    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu, &
+                       this%source%interior_gpu,this%fluxDivergence%interior_gpu, &
                        rk2_a(m),rk2_g(m),this%dt,ndof)
 
   endsubroutine UpdateGRK2_DGModel2D
@@ -109,7 +119,8 @@ contains
            (this%solution%interp%N+1)* &
            (this%solution%interp%N+1)
 
-    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu,this%dsdt%interior_gpu, &
+    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu, &
+                       this%source%interior_gpu,this%fluxDivergence%interior_gpu, &
                        rk3_a(m),rk3_g(m),this%dt,ndof)
 
   endsubroutine UpdateGRK3_DGModel2D
@@ -126,11 +137,137 @@ contains
            (this%solution%interp%N+1)* &
            (this%solution%interp%N+1)
 
-    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu,this%dsdt%interior_gpu, &
+    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu, &
+                       this%source%interior_gpu,this%fluxDivergence%interior_gpu, &
                        rk4_a(m),rk4_g(m),this%dt,ndof)
 
   endsubroutine UpdateGRK4_DGModel2D
 
+  subroutine UpdateGLSRK_DGModel2D(this,m)
+    implicit none
+    class(DGModel2D),intent(inout) :: this
+    integer,intent(in) :: m
+    ! Local
+    integer :: ndof
+
+    ndof = this%solution%nvar* &
+           this%solution%nelem* &
+           (this%solution%interp%N+1)* &
+           (this%solution%interp%N+1)
+
+    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu, &
+                       this%source%interior_gpu,this%fluxDivergence%interior_gpu, &
+                       this%lsrk_a(m),this%lsrk_g(m),this%dt,ndof)
+
+  endsubroutine UpdateGLSRK_DGModel2D
+
+  subroutine StoreERKStage_DGModel2D(this,m)
+    implicit none
+    class(DGModel2D),intent(inout) :: this
+    integer,intent(in) :: m
+    ! Local
+    integer :: ndof
+
+    ndof = this%solution%nvar* &
+           this%solution%nelem* &
+           (this%solution%interp%N+1)* &
+           (this%solution%interp%N+1)
+
+    if(m == 0) then
+      call this%ReserveERKStages()
+      call StoreERKStage_gpu(this%erkStages%interior_gpu,this%solution%interior_gpu,m,ndof)
+    else
+      call StoreERKStage_gpu(this%erkStages%interior_gpu,this%dsdt%interior_gpu,m,ndof)
+    endif
+
+  endsubroutine StoreERKStage_DGModel2D
+
+  subroutine UpdateERK_DGModel2D(this,w)
+    implicit none
+    class(DGModel2D),intent(inout) :: this
+    real(prec),intent(in) :: w(:)
+    ! Local
+    integer :: ndof
+    real(prec) :: wloc(1:SELF_ERK_MAX_STAGES)
+
+    ndof = this%solution%nvar* &
+           this%solution%nelem* &
+           (this%solution%interp%N+1)* &
+           (this%solution%interp%N+1)
+
+    wloc(1:size(w)) = w
+    call UpdateERK_gpu(this%solution%interior_gpu,this%erkStages%interior_gpu,wloc,size(w),ndof)
+
+  endsubroutine UpdateERK_DGModel2D
+
+  function ERKErrorNorm_DGModel2D(this,w) result(err)
+    !! The error norm is reduced in two passes; each block of 256 degrees of freedom is
+    !! summed on the device, into workSol, and the block sums are added on the host
+    implicit none
+    class(DGModel2D),intent(inout) :: this
+    real(prec),intent(in) :: w(:)
+    real(prec) :: err
+    ! Local
+    integer :: ndof,nblocks,ierror
+    real(prec) :: wloc(1:SELF_ERK_MAX_STAGES)
+    real(prec),allocatable,target :: partial(:)
+    real(prec) :: local(1:2),global(1:2)
+
+    ndof = this%solution%nvar* &
+           this%solution%nelem* &
+           (this%solution%interp%N+1)* &
+           (this%solution%interp%N+1)
+    nblocks = ndof/256+1
+    allocate(partial(1:nblocks))
+
+    wloc(1:size(w)) = w
+    call ERKErrorNorm_gpu(this%workSol%interior_gpu,this%solution%interior_gpu,this%erkStages%interior_gpu, &
+                          wloc,size(w),this%abstol,this%reltol,ndof)
+
+    call gpuCheck(hipMemcpy(c_loc(partial), &
+                            this%workSol%interior_gpu,sizeof(partial), &
+                            hipMemcpyDeviceToHost))
+
+    local(1) = sum(partial)
+    local(2) = real(ndof,prec)
+
+    if(this%mesh%decomp%mpiEnabled) then
+      call mpi_allreduce(local, &
+                         global, &
+                         2, &
+                         this%mesh%decomp%mpiPrec, &
+                         MPI_SUM, &
+                         this%mesh%decomp%mpiComm, &
+                         iError)
+    else
+      global = local
+    endif
+
+    err = sqrt(global(1)/global(2))
+
+    deallocate(partial)
+
+  endfunction ERKErrorNorm_DGModel2D
+
+  subroutine UpdateGAB_DGModel2D(this,w)
+    implicit none
+    class(DGModel2D),intent(inout) :: this
+    real(prec),intent(in) :: w(:)
+    ! Local
+    integer :: ndof
+    real(prec) :: wloc(1:SELF_ERK_MAX_STAGES)
+
+    ndof = this%solution%nvar* &
+           this%solution%nelem* &
+           (this%solution%interp%N+1)* &
+           (this%solution%interp%N+1)
+
+    call this%ReserveABHistory()
+    wloc(1:size(w)) = w
+    call UpdateGAB_gpu(this%abHistory%interior_gpu,this%dsdt%interior_gpu,wloc,size(w),this%ab_head,ndof)
+
+  endsubroutine UpdateGAB_DGModel2D
+
   subroutine CalculateSolutionGradient_DGModel2D(this)
     implicit none
     class(DGModel2D),intent(inout) :: this
@@ -189,19 +326,14 @@ contains
     implicit none
     class(DGModel2D),intent(inout) :: this
     ! Local
-    integer :: iel
-    integer :: i
-    integer :: j
-    real(prec) :: s(1:this%nvar),dsdx(1:this%nvar,1:2)
-
-    do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
-                  iel=1:this%mesh%nElem)
-
-      s = this%solution%interior(i,j,iel,1:this%nvar)
-      dsdx = this%solutionGradient%interior(i,j,iel,1:this%nvar,1:2)
-      this%flux%interior(i,j,iel,1:this%nvar,1:2) = this%flux2d(s,dsdx)
+    integer :: ndof
+    real(prec),pointer :: s(:,:),dsdx(:,:,:),f(:,:,:)
 
-    enddo
+    ndof = (this%solution%N+1)**2*this%mesh%nElem
+    s(1:ndof,1:this%nvar) => this%solution%interior
+    dsdx(1:ndof,1:this%nvar,1:2) => this%solutionGradient%interior
+    f(1:ndof,1:this%nvar,1:2) => this%flux%interior
+    call this%flux2d_batch(s,dsdx,f)
 
     call gpuCheck(hipMemcpy(this%flux%interior_gpu, &
                             c_loc(this%flux%interior), &
@@ -217,12 +349,9 @@ contains
     implicit none
     class(DGModel2D),intent(inout) :: this
     ! Local
-    integer :: iel
-    integer :: j
-    integer :: i
-    real(prec) :: sL(1:this%nvar),sR(1:this%nvar)
-    real(prec) :: dsdx(1:this%nvar,1:2)
-    real(prec) :: nhat(1:2),nmag
+    integer :: ndof,n,ivar
+    real(prec),pointer :: sL(:,:),sR(:,:),dsdx(:,:,:),fb(:,:)
+    real(prec),pointer :: nhat(:,:),nmag(:)
 
     call gpuCheck(hipMemcpy(c_loc(this%solution%boundary), &
                             this%solution%boundary_gpu,sizeof(this%solution%boundary), &
@@ -236,18 +365,17 @@ contains
                             this%solutiongradient%avgboundary_gpu,sizeof(this%solutiongradient%avgboundary), &
                             hipMemcpyDeviceToHost))
 
-    do concurrent(i=1:this%solution%N+1,j=1:4, &
-                  iel=1:this%mesh%nElem)
-
-      ! Get the boundary normals on cell edges from the mesh geometry
-      nhat = this%geometry%nHat%boundary(i,j,iEl,1,1:2)
-      sL = this%solution%boundary(i,j,iel,1:this%nvar) ! interior solution
-      sR = this%solution%extboundary(i,j,iel,1:this%nvar) ! exterior solution
-      dsdx = this%solutiongradient%avgboundary(i,j,iel,1:this%nvar,1:2)
-      nmag = this%geometry%nScale%boundary(i,j,iEl,1)
-
-      this%flux%boundaryNormal(i,j,iEl,1:this%nvar) = this%riemannflux2d(sL,sR,dsdx,nhat)*nmag
-
+    ndof = 4*(this%solution%N+1)*this%mesh%nElem
+    sL(1:ndof,1:this%nvar) => this%solution%boundary ! interior solution
+    sR(1:ndof,1:this%nvar) => this%solution%extboundary ! exterior solution
+    dsdx(1:ndof,1:this%nvar,1:2) => this%solutiongradient%avgboundary
+    fb(1:ndof,1:this%nvar) => this%flux%boundaryNormal
+    nhat(1:ndof,1:2) => this%geometry%nHat%boundary
+    nmag(1:ndof) => this%geometry%nScale%boundary
+
+    call this%riemannflux2d_batch(sL,sR,dsdx,nhat,fb)
+    do concurrent(n=1:ndof,ivar=1:this%nvar)
+      fb(n,ivar) = fb(n,ivar)*nmag(n)
     enddo
 
     call gpuCheck(hipMemcpy(this%flux%boundarynormal_gpu, &
@@ -261,10 +389,8 @@ contains
     implicit none
     class(DGModel2D),intent(inout) :: this
     ! Local
-    integer :: iel
-    integer :: i
-    integer :: j
-    real(prec) :: s(1:this%nvar),dsdx(1:this%nvar,1:2)
+    integer :: ndof
+    real(prec),pointer :: s(:,:),dsdx(:,:,:),src(:,:)
 
     call gpuCheck(hipMemcpy(c_loc(this%solution%interior), &
                             this%solution%interior_gpu,sizeof(this%solution%interior), &
@@ -274,14 +400,11 @@ contains
                             this%solutiongradient%interior_gpu,sizeof(this%solutiongradient%interior), &
                             hipMemcpyDeviceToHost))
 
-    do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
-                  iel=1:this%mesh%nElem)
-
-      s = this%solution%interior(i,j,iel,1:this%nvar)
-      dsdx = this%solutionGradient%interior(i,j,iel,1:this%nvar,1:2)
-      this%source%interior(i,j,iel,1:this%nvar) = this%source2d(s,dsdx)
-
-    enddo
+    ndof = (this%solution%N+1)**2*this%mesh%nElem
+    s(1:ndof,1:this%nvar) => this%solution%interior
+    dsdx(1:ndof,1:this%nvar,1:2) => this%solutionGradient%interior
+    src(1:ndof,1:this%nvar) => this%source%interior
+    call this%source2d_batch(s,dsdx,src)
 
     call gpuCheck(hipMemcpy(this%source%interior_gpu, &
                             c_loc(this%source%interior), &
@@ -421,29 +544,56 @@ contains
 
   endsubroutine setgradientboundarycondition_DGModel2D
 
-  subroutine CalculateTendency_DGModel2D(this)
+  subroutine FluxDivergenceVolume_DGModel2D(this)
+    implicit none
+    class(DGModel2D),intent(inout) :: this
+
+    call this%flux%MappedDGDivergenceVolume(this%fluxDivergence%interior_gpu)
+
+  endsubroutine FluxDivergenceVolume_DGModel2D
+
+  subroutine CalculateFluxDivergence_DGModel2D(this)
+    !! Calculates the source and the flux divergence, without assembling the tendency dSdt
     implicit none
     class(DGModel2D),intent(inout) :: this
-    ! Local
-    integer :: ndof
 
     call this%solution%BoundaryInterp()
-    call this%solution%SideExchange(this%mesh)
+    ! The halo exchange is started here and completed once the work that only
+    ! needs the element interiors is done
+    call this%solution%SideExchangeBegin(this%mesh)
 
     call this%PreTendency() ! User-supplied
-    call this%SetBoundaryCondition() ! User-supplied
 
     if(this%gradient_enabled) then
+      ! The solution gradient needs the neighbor data, so the exchange is finished first
+      call this%solution%SideExchangeEnd(this%mesh)
+      call this%SetBoundaryCondition() ! User-supplied
       call this%CalculateSolutionGradient()
       call this%SetGradientBoundaryCondition() ! User-supplied
       call this%solutionGradient%AverageSides()
     endif
 
     call this%SourceMethod() ! User supplied
-    call this%BoundaryFlux() ! User supplied
     call this%FluxMethod() ! User supplied
+    call this%FluxDivergenceVolume()
+
+    if(.not. this%gradient_enabled) then
+      call this%solution%SideExchangeEnd(this%mesh)
+      call this%SetBoundaryCondition() ! User-supplied
+    endif
+
+    call this%BoundaryFlux() ! User supplied
+    call this%flux%MappedDGDivergenceSurface(this%fluxDivergence%interior_gpu)
+
+  endsubroutine CalculateFluxDivergence_DGModel2D
+
+  subroutine CalculateTendency_DGModel2D(this)
+    implicit none
+    class(DGModel2D),intent(inout) :: this
+    ! Local
+    integer :: ndof
 
-    call this%flux%MappedDGDivergence(this%fluxDivergence%interior_gpu)
+    call this%CalculateFluxDivergence()
 
     ndof = this%solution%nvar* &
            this%solution%nelem* &
@@ -48,8 +48,17 @@ module SELF_DGModel3D
     procedure :: UpdateGRK2 => UpdateGRK2_DGModel3D
     procedure :: UpdateGRK3 => UpdateGRK3_DGModel3D
     procedure :: UpdateGRK4 => UpdateGRK4_DGModel3D
+    procedure :: UpdateGLSRK => UpdateGLSRK_DGModel3D
+
+    procedure :: StoreERKStage => StoreERKStage_DGModel3D
+    procedure :: UpdateERK => UpdateERK_DGModel3D
+    procedure :: ERKErrorNorm => ERKErrorNorm_DGModel3D
+
+    procedure :: UpdateGAB => UpdateGAB_DGModel3D
 
     procedure :: CalculateSolutionGradient => CalculateSolutionGradient_DGModel3D
+    procedure :: FluxDivergenceVolume => FluxDivergenceVolume_DGModel3D
+    procedure :: CalculateFluxDivergence => CalculateFluxDivergence_DGModel3D
     procedure :: CalculateTendency => CalculateTendency_DGModel3D
 
   endtype DGModel3D
@@ -94,7 +103,8 @@ contains
            (this%solution%interp%N+1)* &
            (this%solution%interp%N+1)
 
-    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu,this%dsdt%interior_gpu, &
+    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu, &
+                       this%source%interior_gpu,this%fluxDivergence%interior_gpu, &
                        rk2_a(m),rk2_g(m),this%dt,ndof)
 
   endsubroutine UpdateGRK2_DGModel3D
@@ -112,7 +122,8 @@ contains
            (this%solution%interp%N+1)* &
            (this%solution%interp%N+1)
 
-    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu,this%dsdt%interior_gpu, &
+    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu, &
+                       this%source%interior_gpu,this%fluxDivergence%interior_gpu, &
                        rk3_a(m),rk3_g(m),this%dt,ndof)
 
   endsubroutine UpdateGRK3_DGModel3D
@@ -130,11 +141,142 @@ contains
            (this%solution%interp%N+1)* &
            (this%solution%interp%N+1)
 
-    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu,this%dsdt%interior_gpu, &
+    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu, &
+                       this%source%interior_gpu,this%fluxDivergence%interior_gpu, &
                        rk4_a(m),rk4_g(m),this%dt,ndof)
 
   endsubroutine UpdateGRK4_DGModel3D
 
+  subroutine UpdateGLSRK_DGModel3D(this,m)
+    implicit none
+    class(DGModel3D),intent(inout) :: this
+    integer,intent(in) :: m
+    ! Local
+    integer :: ndof
+
+    ndof = this%solution%nvar* &
+           this%solution%nelem* &
+           (this%solution%interp%N+1)* &
+           (this%solution%interp%N+1)* &
+           (this%solution%interp%N+1)
+
+    call UpdateGRK_gpu(this%worksol%interior_gpu,this%solution%interior_gpu, &
+                       this%source%interior_gpu,this%fluxDivergence%interior_gpu, &
+                       this%lsrk_a(m),this%lsrk_g(m),this%dt,ndof)
+
+  endsubroutine UpdateGLSRK_DGModel3D
+
+  subroutine StoreERKStage_DGModel3D(this,m)
+    implicit none
+    class(DGModel3D),intent(inout) :: this
+    integer,intent(in) :: m
+    ! Local
+    integer :: ndof
+
+    ndof = this%solution%nvar* &
+           this%solution%nelem* &
+           (this%solution%interp%N+1)* &
+           (this%solution%interp%N+1)* &
+           (this%solution%interp%N+1)
+
+    if(m == 0) then
+      call this%ReserveERKStages()
+      call StoreERKStage_gpu(this%erkStages%interior_gpu,this%solution%interior_gpu,m,ndof)
+    else
+      call StoreERKStage_gpu(this%erkStages%interior_gpu,this%dsdt%interior_gpu,m,ndof)
+    endif
+
+  endsubroutine StoreERKStage_DGModel3D
+
+  subroutine UpdateERK_DGModel3D(this,w)
+    implicit none
+    class(DGModel3D),intent(inout) :: this
+    real(prec),intent(in) :: w(:)
+    ! Local
+    integer :: ndof
+    real(prec) :: wloc(1:SELF_ERK_MAX_STAGES)
+
+    ndof = this%solution%nvar* &
+           this%solution%nelem* &
+           (this%solution%interp%N+1)* &
+           (this%solution%interp%N+1)* &
+           (this%solution%interp%N+1)
+
+    wloc(1:size(w)) = w
+    call UpdateERK_gpu(this%solution%interior_gpu,this%erkStages%interior_gpu,wloc,size(w),ndof)
+
+  endsubroutine UpdateERK_DGModel3D
+
+  function ERKErrorNorm_DGModel3D(this,w) result(err)
+    !! The error norm is reduced in two passes; each block of 256 degrees of freedom is
+    !! summed on the device, into workSol, and the block sums are added on the host
+    implicit none
+    class(DGModel3D),intent(inout) :: this
+    real(prec),intent(in) :: w(:)
+    real(prec) :: err
+    ! Local
+    integer :: ndof,nblocks,ierror
+    real(prec) :: wloc(1:SELF_ERK_MAX_STAGES)
+    real(prec),allocatable,target :: partial(:)
+    real(prec) :: local(1:2),global(1:2)
+
+    ndof = this%solution%nvar* &
+           this%solution%nelem* &
+           (this%solution%interp%N+1)* &
+           (this%solution%interp%N+1)* &
+           (this%solution%interp%N+1)
+    nblocks = ndof/256+1
+    allocate(partial(1:nblocks))
+
+    wloc(1:size(w)) = w
+    call ERKErrorNorm_gpu(this%workSol%interior_gpu,this%solution%interior_gpu,this%erkStages%interior_gpu, &
+                          wloc,size(w),this%abstol,this%reltol,ndof)
+
+    call gpuCheck(hipMemcpy(c_loc(partial), &
+                            this%workSol%interior_gpu,sizeof(partial), &
+                            hipMemcpyDeviceToHost))
+
+    local(1) = sum(partial)
+    local(2) = real(ndof,prec)
+
+    if(this%mesh%decomp%mpiEnabled) then
+      call mpi_allreduce(local, &
+                         global, &
+                         2, &
+                         this%mesh%decomp%mpiPrec, &
+                         MPI_SUM, &
+                         this%mesh%decomp%mpiComm, &
+                         iError)
+    else
+      global = local
+    endif
+
+    err = sqrt(global(1)/global(2))
+
+    deallocate(partial)
+
+  endfunction ERKErrorNorm_DGModel3D
+
+  subroutine UpdateGAB_DGModel3D(this,w)
+    implicit none
+    class(DGModel3D),intent(inout) :: this
+    real(prec),intent(in) :: w(:)
+    ! Local
+    integer :: ndof
+    real(prec) :: wloc(1:SELF_ERK_MAX_STAGES)
+
+    ndof = this%solution%nvar* &
+           this%solution%nelem* &
+           (this%solution%interp%N+1)* &
+           (this%solution%interp%N+1)* &
+           (this%solution%interp%N+1)
+
+    call this%ReserveABHistory()
+    wloc(1:size(w)) = w
+    call UpdateGAB_gpu(this%abHistory%interior_gpu,this%dsdt%interior_gpu,wloc,size(w),this%ab_head,ndof)
+
+  endsubroutine UpdateGAB_DGModel3D
+
   subroutine CalculateSolutionGradient_DGModel3D(this)
     implicit none
     class(DGModel3D),intent(inout) :: this
@@ -195,18 +337,14 @@ contains
     implicit none
     class(DGModel3D),intent(inout) :: this
     ! Local
-    integer :: iel
-    integer :: i,j,k
-    real(prec) :: s(1:this%nvar),dsdx(1:this%nvar,1:3)
-
-    do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
-                  k=1:this%solution%N+1,iel=1:this%mesh%nElem)
+    integer :: ndof
+    real(prec),pointer :: s(:,:),dsdx(:,:,:),f(:,:,:)
 
-      s = this%solution%interior(i,j,k,iel,1:this%nvar)
-      dsdx = this%solutionGradient%interior(i,j,k,iel,1:this%nvar,1:3)
-      this%flux%interior(i,j,k,iel,1:this%nvar,1:3) = this%flux3d(s,dsdx)
-
-    enddo
+    ndof = (this%solution%N+1)**3*this%mesh%nElem
+    s(1:ndof,1:this%nvar) => this%solution%interior
+    dsdx(1:ndof,1:this%nvar,1:3) => this%solutionGradient%interior
+    f(1:ndof,1:this%nvar,1:3) => this%flux%interior
+    call this%flux3d_batch(s,dsdx,f)
 
     call gpuCheck(hipMemcpy(this%flux%interior_gpu, &
                             c_loc(this%flux%interior), &
@@ -222,10 +360,9 @@ contains
     implicit none
     class(DGModel3D),intent(inout) :: this
     ! Local
-    integer :: i,j,k,iel
-    real(prec) :: sL(1:this%nvar),sR(1:this%nvar)
-    real(prec) :: dsdx(1:this%nvar,1:3)
-    real(prec) :: nhat(1:3),nmag
+    integer :: ndof,n,ivar
+    real(prec),pointer :: sL(:,:),sR(:,:),dsdx(:,:,:),fb(:,:)
+    real(prec),pointer :: nhat(:,:),nmag(:)
 
     call gpuCheck(hipMemcpy(c_loc(this%solution%boundary), &
                             this%solution%boundary_gpu,sizeof(this%solution%boundary), &
@@ -239,17 +376,17 @@ contains
                             this%solutiongradient%avgboundary_gpu,sizeof(this%solutiongradient%avgboundary), &
                             hipMemcpyDeviceToHost))
 
-    do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
-                  k=1:6,iel=1:this%mesh%nElem)
-      ! Get the boundary normals on cell edges from the mesh geometry
-      nhat = this%geometry%nHat%boundary(i,j,k,iEl,1,1:3)
-      sL = this%solution%boundary(i,j,k,iel,1:this%nvar) ! interior solution
-      sR = this%solution%extboundary(i,j,k,iel,1:this%nvar) ! exterior solution
-      dsdx = this%solutiongradient%avgboundary(i,j,k,iel,1:this%nvar,1:3)
-      nmag = this%geometry%nScale%boundary(i,j,k,iEl,1)
-
-      this%flux%boundaryNormal(i,j,k,iEl,1:this%nvar) = this%riemannflux3d(sL,sR,dsdx,nhat)*nmag
-
+    ndof = 6*(this%solution%N+1)**2*this%mesh%nElem
+    sL(1:ndof,1:this%nvar) => this%solution%boundary ! interior solution
+    sR(1:ndof,1:this%nvar) => this%solution%extboundary ! exterior solution
+    dsdx(1:ndof,1:this%nvar,1:3) => this%solutiongradient%avgboundary
+    fb(1:ndof,1:this%nvar) => this%flux%boundaryNormal
+    nhat(1:ndof,1:3) => this%geometry%nHat%boundary
+    nmag(1:ndof) => this%geometry%nScale%boundary
+
+    call this%riemannflux3d_batch(sL,sR,dsdx,nhat,fb)
+    do concurrent(n=1:ndof,ivar=1:this%nvar)
+      fb(n,ivar) = fb(n,ivar)*nmag(n)
     enddo
 
     call gpuCheck(hipMemcpy(this%flux%boundarynormal_gpu, &
@@ -263,8 +400,8 @@ contains
     implicit none
     class(DGModel3D),intent(inout) :: this
     ! Local
-    integer :: i,j,k,iel
-    real(prec) :: s(1:this%nvar),dsdx(1:this%nvar,1:3)
+    integer :: ndof
+    real(prec),pointer :: s(:,:),dsdx(:,:,:),src(:,:)
 
     call gpuCheck(hipMemcpy(c_loc(this%solution%interior), &
                             this%solution%interior_gpu,sizeof(this%solution%interior), &
@@ -274,14 +411,11 @@ contains
                             this%solutiongradient%interior_gpu,sizeof(this%solutiongradient%interior), &
                             hipMemcpyDeviceToHost))
 
-    do concurrent(i=1:this%solution%N+1,j=1:this%solution%N+1, &
-                  k=1:this%solution%N+1,iel=1:this%mesh%nElem)
-
-      s = this%solution%interior(i,j,k,iel,1:this%nvar)
-      dsdx = this%solutionGradient%interior(i,j,k,iel,1:this%nvar,1:3)
-      this%source%interior(i,j,k,iel,1:this%nvar) = this%source3d(s,dsdx)
-
-    enddo
+    ndof = (this%solution%N+1)**3*this%mesh%nElem
+    s(1:ndof,1:this%nvar) => this%solution%interior
+    dsdx(1:ndof,1:this%nvar,1:3) => this%solutionGradient%interior
+    src(1:ndof,1:this%nvar) => this%source%interior
+    call this%source3d_batch(s,dsdx,src)
 
     call gpuCheck(hipMemcpy(this%source%interior_gpu, &
                             c_loc(this%source%interior), &
@@ -433,29 +567,56 @@ contains
 
   endsubroutine setgradientboundarycondition_DGModel3D
 
-  subroutine CalculateTendency_DGModel3D(this)
+  subroutine FluxDivergenceVolume_DGModel3D(this)
+    implicit none
+    class(DGModel3D),intent(inout) :: this
+
+    call this%flux%MappedDGDivergenceVolume(this%fluxDivergence%interior_gpu)
+
+  endsubroutine FluxDivergenceVolume_DGModel3D
+
+  subroutine CalculateFluxDivergence_DGModel3D(this)
+    !! Calculates the source and the flux divergence, without assembling the tendency dSdt
     implicit none
     class(DGModel3D),intent(inout) :: this
-    ! Local
-    integer :: ndof
 
     call this%solution%BoundaryInterp()
-    call this%solution%SideExchange(this%mesh)
+    ! The halo exchange is started here and completed once the work that only
+    ! needs the element interiors is done
+    call this%solution%SideExchangeBegin(this%mesh)
 
     call this%PreTendency() ! User-supplied
-    call this%SetBoundaryCondition() ! User-supplied
 
     if(this%gradient_enabled) then
+      ! The solution gradient needs the neighbor data, so the exchange is finished first
+      call this%solution%SideExchangeEnd(this%mesh)
+      call this%SetBoundaryCondition() ! User-supplied
       call this%CalculateSolutionGradient()
       call this%SetGradientBoundaryCondition() ! User-supplied
       call this%solutionGradient%AverageSides()
     endif
 
     call this%SourceMethod() ! User supplied
-    call this%BoundaryFlux() ! User supplied
     call this%FluxMethod() ! User supplied
+    call this%FluxDivergenceVolume()
+
+    if(.not. this%gradient_enabled) then
+      call this%solution%SideExchangeEnd(this%mesh)
+      call this%SetBoundaryCondition() ! User-supplied
+    endif
+
+    call this%BoundaryFlux() ! User supplied
+    call this%flux%MappedDGDivergenceSurface(this%fluxDivergence%interior_gpu)
+
+  endsubroutine CalculateFluxDivergence_DGModel3D
+
+  subroutine CalculateTendency_DGModel3D(this)
+    implicit none
+    class(DGModel3D),intent(inout) :: this
+    ! Local
+    integer :: ndof
 
-    call this%flux%MappedDGDivergence(this%fluxDivergence%interior_gpu)
+    call this%CalculateFluxDivergence()
 
     ndof = this%solution%nvar* &
            this%solution%nelem* &
@@ -34,6 +34,12 @@ module SELF_DomainDecomposition
 
   type,extends(DomainDecomposition_t) :: DomainDecomposition
     type(c_ptr) :: elemToRank_gpu
+    type(c_ptr) :: haloSide_gpu = c_null_ptr
+    type(c_ptr) :: haloElem_gpu = c_null_ptr
+    type(c_ptr) :: haloFlip_gpu = c_null_ptr
+    type(c_ptr) :: sendBuffer_gpu = c_null_ptr
+    type(c_ptr) :: recvBuffer_gpu = c_null_ptr
+    integer :: haloBufferSize_gpu = 0
 
   contains
 
@@ -41,6 +47,12 @@ module SELF_DomainDecomposition
     procedure :: Free => Free_DomainDecomposition
 
     procedure :: SetElemToRank => SetElemToRank_DomainDecomposition
+    procedure,public :: PartitionElements => PartitionElements_DomainDecomposition
+
+    procedure,public :: SetupHaloExchange => SetupHaloExchange_DomainDecomposition
+    procedure,public :: FreeHaloExchange => FreeHaloExchange_DomainDecomposition
+    procedure,public :: ReserveHaloBuffers => ReserveHaloBuffers_DomainDecomposition
+    procedure,public :: HaloExchangeAsync => HaloExchangeAsync_DomainDecomposition
 
   endtype DomainDecomposition
 
@@ -112,10 +124,15 @@ contains
       deallocate(this%elemToRank)
       call gpuCheck(hipFree(this%elemToRank_gpu))
     endif
+    if(associated(this%localToGlobal)) then
+      deallocate(this%localToGlobal)
+    endif
 
     if(allocated(this%requests)) deallocate(this%requests)
     if(allocated(this%stats)) deallocate(this%stats)
 
+    call this%FreeHaloExchange()
+
     print*,__FILE__," : Rank ",this%rankId+1,"/",this%nRanks," checking out."
     call MPI_FINALIZE(ierror)
 
@@ -147,4 +164,94 @@ contains
 
   endsubroutine SetElemToRank_DomainDecomposition
 
+  subroutine PartitionElements_DomainDecomposition(this,centroid,newElemId)
+    !! Partitions the elements on the host and copies the new element-to-rank
+    !! map to the device.
+    implicit none
+    class(DomainDecomposition),intent(inout) :: this
+    real(prec),intent(in) :: centroid(:,:)
+    integer,intent(out) :: newElemId(:)
+
+    call PartitionElements_DomainDecomposition_t(this,centroid,newElemId)
+    call gpuCheck(hipMemcpy(this%elemToRank_gpu,c_loc(this%elemToRank),sizeof(this%elemToRank),hipMemcpyHostToDevice))
+
+  endsubroutine PartitionElements_DomainDecomposition
+
+  subroutine SetupHaloExchange_DomainDecomposition(this,sideInfo)
+    !! Builds the communication plan on the host and copies the halo side lists
+    !! to the device for the pack and unpack kernels.
+    implicit none
+    class(DomainDecomposition),intent(inout) :: this
+    integer,intent(in) :: sideInfo(:,:,:)
+
+    call SetupHaloExchange_DomainDecomposition_t(this,sideInfo)
+
+    if(this%nHaloSides > 0) then
+      call gpuCheck(hipMalloc(this%haloSide_gpu,sizeof(this%haloSide)))
+      call gpuCheck(hipMalloc(this%haloElem_gpu,sizeof(this%haloElem)))
+      call gpuCheck(hipMalloc(this%haloFlip_gpu,sizeof(this%haloFlip)))
+      call gpuCheck(hipMemcpy(this%haloSide_gpu,c_loc(this%haloSide),sizeof(this%haloSide),hipMemcpyHostToDevice))
+      call gpuCheck(hipMemcpy(this%haloElem_gpu,c_loc(this%haloElem),sizeof(this%haloElem),hipMemcpyHostToDevice))
+      call gpuCheck(hipMemcpy(this%haloFlip_gpu,c_loc(this%haloFlip),sizeof(this%haloFlip),hipMemcpyHostToDevice))
+    endif
+
+  endsubroutine SetupHaloExchange_DomainDecomposition
+
+  subroutine FreeHaloExchange_DomainDecomposition(this)
+    implicit none
+    class(DomainDecomposition),intent(inout) :: this
+
+    if(c_associated(this%haloSide_gpu)) call gpuCheck(hipFree(this%haloSide_gpu))
+    if(c_associated(this%haloElem_gpu)) call gpuCheck(hipFree(this%haloElem_gpu))
+    if(c_associated(this%haloFlip_gpu)) call gpuCheck(hipFree(this%haloFlip_gpu))
+    if(c_associated(this%sendBuffer_gpu)) call gpuCheck(hipFree(this%sendBuffer_gpu))
+    if(c_associated(this%recvBuffer_gpu)) call gpuCheck(hipFree(this%recvBuffer_gpu))
+    this%haloSide_gpu = c_null_ptr
+    this%haloElem_gpu = c_null_ptr
+    this%haloFlip_gpu = c_null_ptr
+    this%sendBuffer_gpu = c_null_ptr
+    this%recvBuffer_gpu = c_null_ptr
+    this%haloBufferSize_gpu = 0
+
+    call FreeHaloExchange_DomainDecomposition_t(this)
+
+  endsubroutine FreeHaloExchange_DomainDecomposition
+
+  subroutine ReserveHaloBuffers_DomainDecomposition(this,n)
+    !! Ensures that the device send and receive buffers hold at least n values
+    implicit none
+    class(DomainDecomposition),intent(inout) :: this
+    integer,intent(in) :: n
+
+    if(this%haloBufferSize_gpu >= n) return
+
+    if(c_associated(this%sendBuffer_gpu)) then
+      ! The persistent requests are bound to the old buffers
+      call this%FreeHaloSchedules()
+      call gpuCheck(hipFree(this%sendBuffer_gpu))
+      call gpuCheck(hipFree(this%recvBuffer_gpu))
+    endif
+    this%haloBufferSize_gpu = max(n,1)
+    call gpuCheck(hipMalloc(this%sendBuffer_gpu,int(this%haloBufferSize_gpu,c_size_t)*prec))
+    call gpuCheck(hipMalloc(this%recvBuffer_gpu,int(this%haloBufferSize_gpu,c_size_t)*prec))
+
+  endsubroutine ReserveHaloBuffers_DomainDecomposition
+
+  subroutine HaloExchangeAsync_DomainDecomposition(this,nPerSide)
+    !! Starts one receive and one send per neighbor rank directly from the device
+    !! buffers. The send buffer must already be packed with PackHalo_2D_gpu or
+    !! PackHalo_3D_gpu.
+    implicit none
+    class(DomainDecomposition),intent(inout) :: this
+    integer,intent(in) :: nPerSide
+    ! Local
+    real(prec),pointer,contiguous :: sendBuffer(:),recvBuffer(:)
+
+    call c_f_pointer(this%sendBuffer_gpu,sendBuffer,[this%haloBufferSize_gpu])
+    call c_f_pointer(this%recvBuffer_gpu,recvBuffer,[this%haloBufferSize_gpu])
+
+    call this%StartHaloSchedule(nPerSide,sendBuffer,recvBuffer)
+
+  endsubroutine HaloExchangeAsync_DomainDecomposition
+
 endmodule SELF_DomainDecomposition
@@ -0,0 +1,214 @@
+/*
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+!
+! Maintainers : support@fluidnumerics.com
+! Official Repository : https://github.com/FluidNumerics/self/
+!
+! Copyright © 2024 Fluid Numerics LLC
+!
+! Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+!
+! 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+!
+! 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in
+!    the documentation and/or other materials provided with the distribution.
+!
+! 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from
+!    this software without specific prior written permission.
+!
+! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+! LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+! HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+! LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+! THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+! THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+*/
+
+#include "SELF_GPU_Macros.h"
+
+// Entropy conserving and kinetic energy preserving two-point flux (Ranocha, 2018)
+// in the direction (nx,ny). The states are primitive variables (rho,u,v,p).
+__device__ real lnmean_Euler2D(real x, real y){
+  real f2 = (x*(x-2.0*y)+y*y)/(x*(x+2.0*y)+y*y);
+  if( f2 < 1.0e-4 ){
+    return (x+y)/(2.0+f2*(2.0/3.0+f2*(0.4+f2*2.0/7.0)));
+  } else {
+    return (y-x)/log(y/x);
+  }
+}
+
+__device__ void twopointflux_Euler2D(const real *pl, const real *pr, real nx, real ny, real gamma, real *f){
+  real rhoMean = lnmean_Euler2D(pl[0],pr[0]);
+  real invRhoPMean = pl[3]*pr[3]/lnmean_Euler2D(pl[0]*pr[3],pr[0]*pl[3]);
+  real unl = pl[1]*nx + pl[2]*ny;
+  real unr = pr[1]*nx + pr[2]*ny;
+  real pAvg = 0.5*(pl[3]+pr[3]);
+
+  f[0] = 0.5*rhoMean*(unl+unr);
+  f[1] = 0.5*f[0]*(pl[1]+pr[1]) + pAvg*nx;
+  f[2] = 0.5*f[0]*(pl[2]+pr[2]) + pAvg*ny;
+  f[3] = f[0]*(0.5*(pl[1]*pr[1]+pl[2]*pr[2]) + invRhoPMean/(gamma-1.0)) + 0.5*(pl[3]*unr+pr[3]*unl);
+}
+
+// One block per element and one thread per quadrature point. The primitive
+// variables of the element are staged in shared memory, so that each is
+// computed once rather than once per pair of points.
+__global__ void fluxdifferencing_Euler2D_gpukernel(real *solution, real *dsdx, real *dMatrix, real *df, real gamma, int accumulate, int N, int nel){
+
+  extern __shared__ real prim[];
+  uint32_t iel = blockIdx.x;
+  uint32_t i = threadIdx.x;
+  uint32_t j = threadIdx.y;
+  int np = (N+1)*(N+1);
+  int ij = i + (N+1)*j;
+
+  real rho = solution[SC_2D_INDEX(i,j,iel,0,N,nel)];
+  real u = solution[SC_2D_INDEX(i,j,iel,1,N,nel)]/rho;
+  real v = solution[SC_2D_INDEX(i,j,iel,2,N,nel)]/rho;
+  prim[ij] = rho;
+  prim[ij+np] = u;
+  prim[ij+2*np] = v;
+  prim[ij+3*np] = (gamma-1.0)*(solution[SC_2D_INDEX(i,j,iel,3,N,nel)]-0.5*rho*(u*u+v*v));
+  __syncthreads();
+
+  real pl[4], pr[4], f[4];
+  real dfloc[4] = {0.0, 0.0, 0.0, 0.0};
+  for(int ivar = 0; ivar < 4; ivar++) pl[ivar] = prim[ij+ivar*np];
+
+  real ja1x = dsdx[TE_2D_INDEX(i,j,iel,0,0,0,N,nel,1)];
+  real ja1y = dsdx[TE_2D_INDEX(i,j,iel,0,1,0,N,nel,1)];
+  real ja2x = dsdx[TE_2D_INDEX(i,j,iel,0,0,1,N,nel,1)];
+  real ja2y = dsdx[TE_2D_INDEX(i,j,iel,0,1,1,N,nel,1)];
+
+  for(int n = 0; n < N+1; n++){
+    // Computational direction 1; the diagonal of the split derivative matrix is zero
+    if( n != i ){
+      real d = 2.0*dMatrix[n+(N+1)*i];
+      for(int ivar = 0; ivar < 4; ivar++) pr[ivar] = prim[n+(N+1)*j+ivar*np];
+      real nx = 0.5*(ja1x + dsdx[TE_2D_INDEX(n,j,iel,0,0,0,N,nel,1)]);
+      real ny = 0.5*(ja1y + dsdx[TE_2D_INDEX(n,j,iel,0,1,0,N,nel,1)]);
+      twopointflux_Euler2D(pl,pr,nx,ny,gamma,f);
+      for(int ivar = 0; ivar < 4; ivar++) dfloc[ivar] += d*f[ivar];
+    }
+    // Computational direction 2
+    if( n != j ){
+      real d = 2.0*dMatrix[n+(N+1)*j];
+      for(int ivar = 0; ivar < 4; ivar++) pr[ivar] = prim[i+(N+1)*n+ivar*np];
+      real nx = 0.5*(ja2x + dsdx[TE_2D_INDEX(i,n,iel,0,0,1,N,nel,1)]);
+      real ny = 0.5*(ja2y + dsdx[TE_2D_INDEX(i,n,iel,0,1,1,N,nel,1)]);
+      twopointflux_Euler2D(pl,pr,nx,ny,gamma,f);
+      for(int ivar = 0; ivar < 4; ivar++) dfloc[ivar] += d*f[ivar];
+    }
+  }
+
+  for(int ivar = 0; ivar < 4; ivar++){
+    if( accumulate ){
+      df[SC_2D_INDEX(i,j,iel,ivar,N,nel)] += dfloc[ivar];
+    } else {
+      df[SC_2D_INDEX(i,j,iel,ivar,N,nel)] = dfloc[ivar];
+    }
+  }
+
+}
+
+extern "C"
+{
+  void fluxdifferencing_Euler2D_gpu(real *solution, real *dsdx, real *dMatrix, real *df, real gamma, int accumulate, int N, int nel){
+    size_t shmem = 4*(N+1)*(N+1)*sizeof(real);
+    fluxdifferencing_Euler2D_gpukernel<<<dim3(nel,1,1), dim3(N+1,N+1,1), shmem, 0>>>(solution,dsdx,dMatrix,df,gamma,accumulate,N,nel);
+  }
+}
+
+__global__ void boundaryflux_Euler2D_gpukernel(real *fb, real *extfb, real *nhat, real *nmag, real *flux, real gamma, int ndof){
+  uint32_t idof = threadIdx.x + blockIdx.x*blockDim.x;
+
+  if( idof < ndof ){
+
+    real nx = nhat[idof];
+    real ny = nhat[idof+ndof];
+
+    real fl[4];
+    real rho = fb[idof];
+    real un = (fb[idof + ndof]*nx + fb[idof + 2*ndof]*ny)/rho;
+    real p = (gamma-1.0)*(fb[idof + 3*ndof] - 0.5*(fb[idof + ndof]*fb[idof + ndof] + fb[idof + 2*ndof]*fb[idof + 2*ndof])/rho);
+    fl[0] = rho*un; // density
+    fl[1] = fb[idof + ndof]*un + p*nx; // x-momentum
+    fl[2] = fb[idof + 2*ndof]*un + p*ny; // y-momentum
+    fl[3] = (fb[idof + 3*ndof] + p)*un; // total energy
+    real lam = fabs(un) + sqrt(gamma*p/rho);
+
+    real fr[4];
+    rho = extfb[idof];
+    un = (extfb[idof + ndof]*nx + extfb[idof + 2*ndof]*ny)/rho;
+    p = (gamma-1.0)*(extfb[idof + 3*ndof] - 0.5*(extfb[idof + ndof]*extfb[idof + ndof] + extfb[idof + 2*ndof]*extfb[idof + 2*ndof])/rho);
+    fr[0] = rho*un; // density
+    fr[1] = extfb[idof + ndof]*un + p*nx; // x-momentum
+    fr[2] = extfb[idof + 2*ndof]*un + p*ny; // y-momentum
+    fr[3] = (extfb[idof + 3*ndof] + p)*un; // total energy
+    lam = fmax(lam, fabs(un) + sqrt(gamma*p/rho));
+
+    real nm = nmag[idof];
+    for(int ivar = 0; ivar < 4; ivar++){
+      flux[idof+ivar*ndof] = (0.5*(fl[ivar]+fr[ivar])+0.5*lam*(fb[idof+ivar*ndof]-extfb[idof+ivar*ndof]))*nm;
+    }
+  }
+}
+
+extern "C"
+{
+  void boundaryflux_Euler2D_gpu(real *fb, real *extfb, real *nhat, real *nmag, real *flux, real gamma, int N, int nel){
+    int threads_per_block = 256;
+    uint32_t ndof = (N+1)*4*nel;
+    int nblocks_x = ndof/threads_per_block +1;
+
+    boundaryflux_Euler2D_gpukernel<<<dim3(nblocks_x,1,1), dim3(threads_per_block,1,1), 0, 0>>>(fb,extfb,nhat,nmag,flux,gamma,ndof);
+  }
+}
+
+__global__ void setboundarycondition_Euler2D_gpukernel(real *extBoundary, real *boundary, int *sideInfo, real *nhat, int N, int nel){
+
+  uint32_t idof = threadIdx.x + blockIdx.x*blockDim.x;
+  uint32_t ndof = (N+1)*4*nel;
+
+  if(idof < ndof){
+    uint32_t i = idof % (N+1);
+    uint32_t s1 = (idof/(N+1)) % 4;
+    uint32_t e1 = idof/(N+1)/4;
+    uint32_t e2 = sideInfo[INDEX3(2,s1,e1,5,4)];
+    uint32_t bcid = sideInfo[INDEX3(4,s1,e1,5,4)];
+    if( e2 == 0){
+      if( bcid == SELF_BC_NONORMALFLOW ){
+
+        real ru = boundary[SCB_2D_INDEX(i,s1,e1,1,N,nel)];
+        real rv = boundary[SCB_2D_INDEX(i,s1,e1,2,N,nel)];
+        real nx = nhat[VEB_2D_INDEX(i,s1,e1,0,0,N,nel,1)];
+        real ny = nhat[VEB_2D_INDEX(i,s1,e1,0,1,N,nel,1)];
+        real mn = ru*nx + rv*ny;
+        extBoundary[SCB_2D_INDEX(i,s1,e1,0,N,nel)] = boundary[SCB_2D_INDEX(i,s1,e1,0,N,nel)]; // density
+        extBoundary[SCB_2D_INDEX(i,s1,e1,1,N,nel)] = ru-2.0*mn*nx; // x-momentum
+        extBoundary[SCB_2D_INDEX(i,s1,e1,2,N,nel)] = rv-2.0*mn*ny; // y-momentum
+        extBoundary[SCB_2D_INDEX(i,s1,e1,3,N,nel)] = boundary[SCB_2D_INDEX(i,s1,e1,3,N,nel)]; // total energy
+
+      } else if ( bcid == SELF_BC_RADIATION ){
+
+        for(int ivar = 0; ivar < 4; ivar++){
+          extBoundary[SCB_2D_INDEX(i,s1,e1,ivar,N,nel)] = boundary[SCB_2D_INDEX(i,s1,e1,ivar,N,nel)];
+        }
+
+      }
+    }
+  }
+}
+
+extern "C"
+{
+  void setboundarycondition_Euler2D_gpu(real *extBoundary, real *boundary, int *sideInfo, real *nhat, int N, int nel){
+    int threads_per_block = 256;
+    int ndof = (N+1)*4*nel;
+    int nblocks_x = ndof/threads_per_block +1;
+
+    setboundarycondition_Euler2D_gpukernel<<<dim3(nblocks_x,1,1), dim3(threads_per_block,1,1), 0, 0>>>(extBoundary,boundary,sideInfo,nhat,N,nel);
+  }
+}
@@ -0,0 +1,197 @@
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+!
+! Maintainers : support@fluidnumerics.com
+! Official Repository : https://github.com/FluidNumerics/self/
+!
+! Copyright © 2024 Fluid Numerics LLC
+!
+! Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+!
+! 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+!
+! 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in
+!    the documentation and/or other materials provided with the distribution.
+!
+! 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from
+!    this software without specific prior written permission.
+!
+! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+! LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+! HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+! LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+! THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+! THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+
+module self_Euler3D
+
+  use self_Euler3D_t
+
+  implicit none
+
+  type,extends(Euler3D_t) :: Euler3D
+  contains
+    procedure :: setboundarycondition => setboundarycondition_Euler3D
+    procedure :: boundaryflux => boundaryflux_Euler3D
+    procedure :: fluxmethod => fluxmethod_Euler3D
+    procedure :: FluxDivergenceVolume => FluxDivergenceVolume_Euler3D
+
+  endtype Euler3D
+
+  interface
+    subroutine setboundarycondition_Euler3D_gpu(extboundary,boundary,sideinfo,nhat,N,nel) &
+      bind(c,name="setboundarycondition_Euler3D_gpu")
+      use iso_c_binding
+      type(c_ptr),value :: extboundary,boundary,sideinfo,nhat
+      integer(c_int),value :: N,nel
+    endsubroutine setboundarycondition_Euler3D_gpu
+  endinterface
+
+  interface
+    subroutine boundaryflux_Euler3D_gpu(fb,fextb,nhat,nscale,flux,gamma,N,nel) &
+      bind(c,name="boundaryflux_Euler3D_gpu")
+      use iso_c_binding
+      use SELF_Constants
+      type(c_ptr),value :: fb,fextb,flux,nhat,nscale
+      real(c_prec),value :: gamma
+      integer(c_int),value :: N,nel
+    endsubroutine boundaryflux_Euler3D_gpu
+  endinterface
+
+  interface
+    subroutine fluxdifferencing_Euler3D_gpu(solution,dsdx,dMatrix,df,gamma,accumulate,N,nel) &
+      bind(c,name="fluxdifferencing_Euler3D_gpu")
+      use iso_c_binding
+      use SELF_Constants
+      type(c_ptr),value :: solution,dsdx,dMatrix,df
+      real(c_prec),value :: gamma
+      integer(c_int),value :: accumulate,N,nel
+    endsubroutine fluxdifferencing_Euler3D_gpu
+  endinterface
+
+contains
+
+  subroutine boundaryflux_Euler3D(this)
+    !! The inviscid local Lax-Friedrichs flux is computed on the GPU. With
+    !! gradient_enabled, the viscous terms are included through riemannflux3d,
+    !! in the host method inherited by Euler3D_t. It is called on the Euler3D_t
+    !! parent component so that riemannflux3d still resolves to the Euler flux.
+    implicit none
+    class(Euler3D),intent(inout) :: this
+
+    if(this%gradient_enabled) then
+      call this%Euler3D_t%BoundaryFlux()
+    else
+      call boundaryflux_Euler3D_gpu(this%solution%boundary_gpu, &
+                                    this%solution%extBoundary_gpu, &
+                                    this%geometry%nhat%boundary_gpu, &
+                                    this%geometry%nscale%boundary_gpu, &
+                                    this%flux%boundarynormal_gpu, &
+                                    this%gamma,this%solution%interp%N, &
+                                    this%solution%nelem)
+    endif
+
+  endsubroutine boundaryflux_Euler3D
+
+  subroutine fluxmethod_Euler3D(this)
+    !! The viscous flux is computed on the host by fluxmethod_Euler3D_t. It
+    !! expects the solution and its gradient on the host, which the other DGModel3D
+    !! methods copy in SourceMethod; the source is null here, so the copies
+    !! are done in this method instead.
+    implicit none
+    class(Euler3D),intent(inout) :: this
+
+    if(this%gradient_enabled) then
+      call gpuCheck(hipMemcpy(c_loc(this%solution%interior), &
+                              this%solution%interior_gpu,sizeof(this%solution%interior), &
+                              hipMemcpyDeviceToHost))
+
+      call gpuCheck(hipMemcpy(c_loc(this%solutiongradient%interior), &
+                              this%solutiongradient%interior_gpu,sizeof(this%solutiongradient%interior), &
+                              hipMemcpyDeviceToHost))
+
+      call this%Euler3D_t%FluxMethod()
+
+      call gpuCheck(hipMemcpy(this%flux%interior_gpu, &
+                              c_loc(this%flux%interior), &
+                              sizeof(this%flux%interior), &
+                              hipMemcpyHostToDevice))
+    endif
+
+  endsubroutine fluxmethod_Euler3D
+
+  subroutine FluxDivergenceVolume_Euler3D(this)
+    implicit none
+    class(Euler3D),intent(inout) :: this
+    ! Local
+    integer(c_int) :: accumulate
+
+    accumulate = 0
+    if(this%gradient_enabled) then
+      call this%dgmodel3d%FluxDivergenceVolume()
+      accumulate = 1
+    endif
+
+    call fluxdifferencing_Euler3D_gpu(this%solution%interior_gpu, &
+                                      this%geometry%dsdx%interior_gpu, &
+                                      this%solution%interp%dMatrix_gpu, &
+                                      this%fluxDivergence%interior_gpu, &
+                                      this%gamma,accumulate, &
+                                      this%solution%interp%N,this%solution%nelem)
+
+  endsubroutine FluxDivergenceVolume_Euler3D
+
+  subroutine setboundarycondition_Euler3D(this)
+    !! No normal flow and radiation conditions are set on the GPU
+    implicit none
+    class(Euler3D),intent(inout) :: this
+    ! local
+    integer :: i,iEl,j,k,e2,bcid
+    real(prec) :: x(1:3)
+
+    if(this%prescribed_bcs_enabled) then
+      call gpuCheck(hipMemcpy(c_loc(this%solution%extboundary), &
+                              this%solution%extboundary_gpu,sizeof(this%solution%extboundary), &
+                              hipMemcpyDeviceToHost))
+
+      ! Prescribed boundaries are still done on the CPU
+      do iEl = 1,this%solution%nElem ! Loop over all elements
+        do k = 1,6 ! Loop over all sides
+
+          bcid = this%mesh%sideInfo(5,k,iEl) ! Boundary Condition ID
+          e2 = this%mesh%sideInfo(3,k,iEl) ! Neighboring Element ID
+
+          if(e2 == 0) then
+            if(bcid == SELF_BC_PRESCRIBED) then
+
+              do j = 1,this%solution%interp%N+1 ! Loop over quadrature points
+                do i = 1,this%solution%interp%N+1 ! Loop over quadrature points
+                  x = this%geometry%x%boundary(i,j,k,iEl,1,1:3)
+
+                  this%solution%extBoundary(i,j,k,iEl,1:this%nvar) = &
+                    this%hbc3d_Prescribed(x,this%t)
+                enddo
+              enddo
+
+            endif
+          endif
+
+        enddo
+      enddo
+
+      call gpuCheck(hipMemcpy(this%solution%extBoundary_gpu, &
+                              c_loc(this%solution%extBoundary), &
+                              sizeof(this%solution%extBoundary), &
+                              hipMemcpyHostToDevice))
+    endif
+    call setboundarycondition_Euler3D_gpu(this%solution%extboundary_gpu, &
+                                          this%solution%boundary_gpu, &
+                                          this%mesh%sideInfo_gpu, &
+                                          this%geometry%nhat%boundary_gpu, &
+                                          this%solution%interp%N, &
+                                          this%solution%nelem)
+
+  endsubroutine setboundarycondition_Euler3D
+
+endmodule self_Euler3D
@@ -36,6 +36,8 @@ module SELF_GPU
     function hipGetDeviceCount_(count) bind(c,name="hipGetDeviceCount")
 #elif HAVE_CUDA
       function hipGetDeviceCount_(count) bind(c,name="cudaGetDeviceCount")
+#elif HAVE_CXX_CPU
+      function hipGetDeviceCount_(count) bind(c,name="cpuGetDeviceCount")
 #endif
         use iso_c_binding
         use SELF_GPU_enums
@@ -50,6 +52,8 @@ module SELF_GPU
         function hipSetDevice_(device_id) bind(c,name="hipSetDevice")
 #elif HAVE_CUDA
           function hipSetDevice_(device_id) bind(c,name="cudaSetDevice")
+#elif HAVE_CXX_CPU
+          function hipSetDevice_(device_id) bind(c,name="cpuSetDevice")
 #endif
             use iso_c_binding
             use SELF_GPU_enums
@@ -63,6 +67,8 @@ module SELF_GPU
             function hipMalloc_(ptr,mySize) bind(c,name="hipMalloc")
 #elif HAVE_CUDA
               function hipMalloc_(ptr,mySize) bind(c,name="cudaMalloc")
+#elif HAVE_CXX_CPU
+              function hipMalloc_(ptr,mySize) bind(c,name="cpuMalloc")
 #endif
                 use iso_c_binding
                 use SELF_GPU_enums
@@ -78,6 +84,8 @@ module SELF_GPU
                 function hipFree_(ptr) bind(c,name="hipFree")
 #elif HAVE_CUDA
                   function hipFree_(ptr) bind(c,name="cudaFree")
+#elif HAVE_CXX_CPU
+                  function hipFree_(ptr) bind(c,name="cpuFree")
 #endif
                     use iso_c_binding
                     use SELF_GPU_enums
@@ -92,6 +100,8 @@ module SELF_GPU
                     function hipMemcpy_(dest,src,sizeBytes,myKind) bind(c,name="hipMemcpy")
 #elif HAVE_CUDA
                       function hipMemcpy_(dest,src,sizeBytes,myKind) bind(c,name="cudaMemcpy")
+#elif HAVE_CXX_CPU
+                      function hipMemcpy_(dest,src,sizeBytes,myKind) bind(c,name="cpuMemcpy")
 #endif
                         use iso_c_binding
                         use SELF_GPU_enums
@@ -10,6 +10,8 @@ module SELF_GPUBLAS
   interface hipblasCreate
 #ifdef HAVE_CUDA
     function hipblasCreate_(handle) bind(c,name="cublasCreate_v2")
+#elif HAVE_CXX_CPU
+    function hipblasCreate_(handle) bind(c,name="cpublasCreate")
 #else
       function hipblasCreate_(handle) bind(c,name="hipblasCreate")
 #endif
@@ -24,6 +26,8 @@ module SELF_GPUBLAS
       interface hipblasDestroy
 #ifdef HAVE_CUDA
         function hipblasDestroy_(handle) bind(c,name="cublasDestroy_v2")
+#elif HAVE_CXX_CPU
+        function hipblasDestroy_(handle) bind(c,name="cpublasDestroy")
 #else
           function hipblasDestroy_(handle) bind(c,name="hipblasDestroy")
 #endif
@@ -38,6 +42,8 @@ module SELF_GPUBLAS
           interface hipblasSgemm
 #ifdef HAVE_CUDA
             function hipblasSgemm_(handle,transa,transb,m,n,k,alpha,A,lda,B,ldb,beta,C,ldc) bind(c,name="cublasSgemm_v2")
+#elif HAVE_CXX_CPU
+            function hipblasSgemm_(handle,transa,transb,m,n,k,alpha,A,lda,B,ldb,beta,C,ldc) bind(c,name="cpublasSgemm")
 #else
               function hipblasSgemm_(handle,transa,transb,m,n,k,alpha,A,lda,B,ldb,beta,C,ldc) bind(c,name="hipblasSgemm")
 #endif
@@ -65,6 +71,8 @@ module SELF_GPUBLAS
               interface hipblasDgemm
 #ifdef HAVE_CUDA
                 function hipblasDgemm_(handle,transa,transb,m,n,k,alpha,A,lda,B,ldb,beta,C,ldc) bind(c,name="cublasDgemm_v2")
+#elif HAVE_CXX_CPU
+                function hipblasDgemm_(handle,transa,transb,m,n,k,alpha,A,lda,B,ldb,beta,C,ldc) bind(c,name="cpublasDgemm")
 #else
                   function hipblasDgemm_(handle,transa,transb,m,n,k,alpha,A,lda,B,ldb,beta,C,ldc) bind(c,name="hipblasDgemm")
 #endif
@@ -94,6 +102,10 @@ module SELF_GPUBLAS
                     function hipblasSgemvStridedBatched_(handle,trans,m,n,alpha,A,lda,strideA,x, &
                                                          incx,stridex,beta,y,incy,stridey,batchCount) &
                       bind(c,name="cublasSgemvStridedBatched")
+#elif HAVE_CXX_CPU
+                    function hipblasSgemvStridedBatched_(handle,trans,m,n,alpha,A,lda,strideA,x, &
+                                                         incx,stridex,beta,y,incy,stridey,batchCount) &
+                      bind(c,name="cpublasSgemvStridedBatched")
 #else
                       function hipblasSgemvStridedBatched_(handle,trans,m,n,alpha,A,lda,strideA,x, &
                                                            incx,stridex,beta,y,incy,stridey,batchCount) &
@@ -128,6 +140,10 @@ module SELF_GPUBLAS
                         function hipblasDgemvStridedBatched_(handle,trans,m,n,alpha,A,lda,strideA,x, &
                                                              incx,stridex,beta,y,incy,stridey,batchCount) &
                           bind(c,name="cublasDgemvStridedBatched")
+#elif HAVE_CXX_CPU
+                        function hipblasDgemvStridedBatched_(handle,trans,m,n,alpha,A,lda,strideA,x, &
+                                                             incx,stridex,beta,y,incy,stridey,batchCount) &
+                          bind(c,name="cpublasDgemvStridedBatched")
 #else
                           function hipblasDgemvStridedBatched_(handle,trans,m,n,alpha,A,lda,strideA,x, &
                                                                incx,stridex,beta,y,incy,stridey,batchCount) &
@@ -93,15 +93,55 @@ module SELF_GPUInterfaces
   endinterface
 
   interface
-    subroutine UpdateGRK_gpu(grk,solution,dsdt,rk_a,rk_g,dt,ndof) bind(c,name="UpdateGRK_gpu")
+    subroutine UpdateGRK_gpu(grk,solution,source,fluxDivergence,rk_a,rk_g,dt,ndof) bind(c,name="UpdateGRK_gpu")
       use iso_c_binding
       use SELF_Constants
-      type(c_ptr),value :: grk,solution,dsdt
+      type(c_ptr),value :: grk,solution,source,fluxDivergence
       real(c_prec),value :: rk_a,rk_g,dt
       integer(c_int),value :: ndof
     endsubroutine UpdateGRK_gpu
   endinterface
 
+  interface
+    subroutine StoreERKStage_gpu(stages,src,m,ndof) bind(c,name="StoreERKStage_gpu")
+      use iso_c_binding
+      type(c_ptr),value :: stages,src
+      integer(c_int),value :: m,ndof
+    endsubroutine StoreERKStage_gpu
+  endinterface
+
+  interface
+    subroutine UpdateERK_gpu(solution,stages,w,nw,ndof) bind(c,name="UpdateERK_gpu")
+      use iso_c_binding
+      use SELF_Constants
+      type(c_ptr),value :: solution,stages
+      real(c_prec) :: w(*)
+      integer(c_int),value :: nw,ndof
+    endsubroutine UpdateERK_gpu
+  endinterface
+
+  interface
+    subroutine ERKErrorNorm_gpu(partial,solution,stages,w,nw,abstol,reltol,ndof) bind(c,name="ERKErrorNorm_gpu")
+      use iso_c_binding
+      use SELF_Constants
+      type(c_ptr),value :: partial,solution,stages
+      real(c_prec) :: w(*)
+      integer(c_int),value :: nw
+      real(c_prec),value :: abstol,reltol
+      integer(c_int),value :: ndof
+    endsubroutine ERKErrorNorm_gpu
+  endinterface
+
+  interface
+    subroutine UpdateGAB_gpu(history,dsdt,w,nw,head,ndof) bind(c,name="UpdateGAB_gpu")
+      use iso_c_binding
+      use SELF_Constants
+      type(c_ptr),value :: history,dsdt
+      real(c_prec) :: w(*)
+      integer(c_int),value :: nw,head,ndof
+    endsubroutine UpdateGAB_gpu
+  endinterface
+
   interface
     subroutine CalculateDSDt_gpu(fluxDivergence,source,dsdt,ndof) bind(c,name="CalculateDSDt_gpu")
       use iso_c_binding
@@ -129,13 +169,23 @@ module SELF_GPUInterfaces
   endinterface
 
   interface
-    subroutine ApplyFlip_2D_gpu(extBoundary,sideInfo,elemToRank,rankId,offset,N,nVar,nEl) &
-      bind(c,name="ApplyFlip_2D_gpu")
+    subroutine PackHalo_2D_gpu(sendBuffer,boundary,haloSide,haloElem,nHaloSides,N,nVar,nEl) &
+      bind(c,name="PackHalo_2D_gpu")
       use iso_c_binding
       implicit none
-      type(c_ptr),value :: extBoundary,sideInfo,elemToRank
-      integer(c_int),value :: rankId,offset,N,nVar,nEl
-    endsubroutine ApplyFlip_2D_gpu
+      type(c_ptr),value :: sendBuffer,boundary,haloSide,haloElem
+      integer(c_int),value :: nHaloSides,N,nVar,nEl
+    endsubroutine PackHalo_2D_gpu
+  endinterface
+
+  interface
+    subroutine UnpackHalo_2D_gpu(extBoundary,recvBuffer,haloSide,haloElem,haloFlip,nHaloSides,N,nVar,nEl) &
+      bind(c,name="UnpackHalo_2D_gpu")
+      use iso_c_binding
+      implicit none
+      type(c_ptr),value :: extBoundary,recvBuffer,haloSide,haloElem,haloFlip
+      integer(c_int),value :: nHaloSides,N,nVar,nEl
+    endsubroutine UnpackHalo_2D_gpu
   endinterface
 
   interface
@@ -168,13 +218,23 @@ module SELF_GPUInterfaces
   endinterface
 
   interface
-    subroutine ApplyFlip_3D_gpu(extBoundary,sideInfo,elemToRank,rankId,offset,N,nVar,nEl) &
-      bind(c,name="ApplyFlip_3D_gpu")
+    subroutine PackHalo_3D_gpu(sendBuffer,boundary,haloSide,haloElem,nHaloSides,N,nVar,nEl) &
+      bind(c,name="PackHalo_3D_gpu")
       use iso_c_binding
       implicit none
-      type(c_ptr),value :: extBoundary,sideInfo,elemToRank
-      integer(c_int),value :: rankId,offset,N,nVar,nEl
-    endsubroutine ApplyFlip_3D_gpu
+      type(c_ptr),value :: sendBuffer,boundary,haloSide,haloElem
+      integer(c_int),value :: nHaloSides,N,nVar,nEl
+    endsubroutine PackHalo_3D_gpu
+  endinterface
+
+  interface
+    subroutine UnpackHalo_3D_gpu(extBoundary,recvBuffer,haloSide,haloElem,haloFlip,nHaloSides,N,nVar,nEl) &
+      bind(c,name="UnpackHalo_3D_gpu")
+      use iso_c_binding
+      implicit none
+      type(c_ptr),value :: extBoundary,recvBuffer,haloSide,haloElem,haloFlip
+      integer(c_int),value :: nHaloSides,N,nVar,nEl
+    endsubroutine UnpackHalo_3D_gpu
   endinterface
 
   interface
@@ -15,7 +15,13 @@
 #include <climits>
 #include <cstdio>
 
-#ifdef __HIP_PLATFORM_AMD__
+#ifdef HAVE_CXX_CPU
+
+// Host-only build : kernels are implemented with OpenMP in src/cxx/
+// and no device runtime is required.
+#include <stdint.h> // required to provide uint32_t
+
+#elif defined(__HIP_PLATFORM_AMD__)
 
 #include <hip/hip_runtime.h>
 
@@ -46,7 +52,9 @@ static void check(const cudaError_t err, const char *const file, const int line)
 
 #endif
 
+#ifndef HAVE_CXX_CPU
 #define CHECK(X) check(X,__FILE__,__LINE__)
+#endif
 
 
 #define INDEX(i,j,N) i+j*(N+1)
@@ -116,50 +116,73 @@ extern "C"
   }
 }
 
-__global__ void ApplyFlip_2D(real *extBoundary, int *sideInfo, int *elemToRank, int rankId, int offset, int N, int nVar, int nEl){
+// The halo kernels copy side data between the element boundary arrays and the
+// contiguous MPI buffers of the neighbor-rank communication plan. The buffers are
+// ordered as buffer[i + (N+1)*(ivar + nVar*ihalo)] (2-D) and
+// buffer[i + (N+1)*(j + (N+1)*(ivar + nVar*ihalo))] (3-D). haloSide and haloElem hold
+// the (1-based) local side and element id of each halo side.
+__global__ void PackHalo_2D(real *sendBuffer, real *boundary, int *haloSide, int *haloElem, int nHaloSides, int N, int nVar, int nEl){
 
   uint32_t idof = threadIdx.x + blockIdx.x*blockDim.x;
-  uint32_t ndof = nVar*nEl*4;
-  uint32_t s1 = (idof) % 4;
-  uint32_t e1 = (idof/4) % nEl;
-  uint32_t ivar = idof/4/nEl;
-  
+  uint32_t ndof = (N+1)*nVar*nHaloSides;
+
   if(idof < ndof){
-    int e2Global = sideInfo[INDEX3(2,s1,e1,5,4)];
-    int e2 = e2Global - offset;
-    int s2 = sideInfo[INDEX3(3,s1,e1,5,4)]/10;
-    int flip = sideInfo[INDEX3(3,s1,e1,5,4)]-s2*10;
-    real buff[24]; // warning : set fixed buffer size for applying flip. This limits the polynomial degree to 23 
+    uint32_t i = idof % (N+1);
+    uint32_t ivar = (idof/(N+1)) % nVar;
+    uint32_t ihalo = idof/(N+1)/nVar;
+    int s1 = haloSide[ihalo]-1;
+    int e1 = haloElem[ihalo]-1;
+    sendBuffer[idof] = boundary[SCB_2D_INDEX(i,s1,e1,ivar,N,nEl)];
+  }
 
-    if(e2Global != 0){
-      int neighborRank = elemToRank[e2Global-1];
-      if( neighborRank != rankId ){
-        if(flip == 1){
-          for( int i1 = 0; i1<N+1; i1++){
-            int i2 = N-i1;
-            buff[i1] = extBoundary[SCB_2D_INDEX(i2,s1,e1,ivar,N,nEl)];
-          }
-          for( int i1 = 0; i1<N+1; i1++){
-            extBoundary[SCB_2D_INDEX(i1,s1,e1,ivar,N,nEl)] = buff[i1];
-          }
-        }
-      }
-    }
+}
+
+extern "C"
+{
+  void PackHalo_2D_gpu(real *sendBuffer, real *boundary, int *haloSide, int *haloElem, int nHaloSides, int N, int nVar, int nEl)
+  {
+    int ndof = (N+1)*nVar*nHaloSides;
+    if(ndof == 0) return;
+    int threads_per_block = 256;
+    int nblocks_x = ndof/threads_per_block + 1;
+
+    PackHalo_2D<<<dim3(nblocks_x,1,1), dim3(threads_per_block,1,1), 0, 0>>>(sendBuffer, boundary, haloSide, haloElem, nHaloSides, N, nVar, nEl);
+    // The send buffer is handed to MPI next, so the packing must be complete
+#ifdef __HIP_PLATFORM_AMD__
+    CHECK(hipDeviceSynchronize());
+#else
+    CHECK(cudaDeviceSynchronize());
+#endif
   }
-  
+}
+
+__global__ void UnpackHalo_2D(real *extBoundary, real *recvBuffer, int *haloSide, int *haloElem, int *haloFlip, int nHaloSides, int N, int nVar, int nEl){
+
+  uint32_t idof = threadIdx.x + blockIdx.x*blockDim.x;
+  uint32_t ndof = (N+1)*nVar*nHaloSides;
+
+  if(idof < ndof){
+    uint32_t i = idof % (N+1);
+    uint32_t ivar = (idof/(N+1)) % nVar;
+    uint32_t ihalo = idof/(N+1)/nVar;
+    int s1 = haloSide[ihalo]-1;
+    int e1 = haloElem[ihalo]-1;
+    int i2 = (haloFlip[ihalo] == 1) ? N-i : i;
+    extBoundary[SCB_2D_INDEX(i,s1,e1,ivar,N,nEl)] = recvBuffer[i2+(N+1)*(ivar + nVar*ihalo)];
+  }
+
 }
 
 extern "C"
 {
-  void ApplyFlip_2D_gpu(real *extBoundary, int *sideInfo, int *elemToRank, int rankId, int offset, int N, int nVar, int nEl)
+  void UnpackHalo_2D_gpu(real *extBoundary, real *recvBuffer, int *haloSide, int *haloElem, int *haloFlip, int nHaloSides, int N, int nVar, int nEl)
   {
-    int ndof = 4*nEl*nVar;
+    int ndof = (N+1)*nVar*nHaloSides;
+    if(ndof == 0) return;
     int threads_per_block = 256;
     int nblocks_x = ndof/threads_per_block + 1;
 
-    dim3 nblocks(nblocks_x,1,1);
-    dim3 nthreads(threads_per_block,1,1);
-    ApplyFlip_2D<<<nblocks,nthreads>>>(extBoundary, sideInfo, elemToRank, rankId, offset, N, nVar, nEl);
+    UnpackHalo_2D<<<dim3(nblocks_x,1,1), dim3(threads_per_block,1,1), 0, 0>>>(extBoundary, recvBuffer, haloSide, haloElem, haloFlip, nHaloSides, N, nVar, nEl);
   }
 }
 
@@ -244,76 +267,82 @@ extern "C"
   }
 }
 
-__global__ void ApplyFlip_3D(real *extBoundary, int *sideInfo, int *elemToRank, int rankId, int offset, int N, int nVar, int nEl){
+__global__ void PackHalo_3D(real *sendBuffer, real *boundary, int *haloSide, int *haloElem, int nHaloSides, int N, int nVar, int nEl){
 
-  uint32_t s1 = blockIdx.x;
-  uint32_t e1 = blockIdx.y;
-  uint32_t ivar = blockIdx.z;
-  uint32_t i = threadIdx.x;
-  uint32_t j = threadIdx.y;
+  uint32_t idof = threadIdx.x + blockIdx.x*blockDim.x;
+  uint32_t ndof = (N+1)*(N+1)*nVar*nHaloSides;
 
-  __shared__ real extBuff[256];
+  if(idof < ndof){
+    uint32_t i = idof % (N+1);
+    uint32_t j = (idof/(N+1)) % (N+1);
+    uint32_t ivar = (idof/(N+1)/(N+1)) % nVar;
+    uint32_t ihalo = idof/(N+1)/(N+1)/nVar;
+    int s1 = haloSide[ihalo]-1;
+    int e1 = haloElem[ihalo]-1;
+    sendBuffer[idof] = boundary[SCB_3D_INDEX(i,j,s1,e1,ivar,N,nEl)];
+  }
 
-  extBuff[i+(N+1)*j] = extBoundary[SCB_3D_INDEX(i,j,s1,e1,ivar,N,nEl)];
+}
 
-  __syncthreads();
-  
-  int e2Global = sideInfo[INDEX3(2,s1,e1,5,4)];
-  int e2 = e2Global - offset;
-  int s2 = sideInfo[INDEX3(3,s1,e1,5,4)]/10;
-  int flip = sideInfo[INDEX3(3,s1,e1,5,4)]-s2*10;
-
-  if(e2Global != 0){
-    int neighborRank = elemToRank[e2Global-1];
-    if( neighborRank != rankId ){
-
-      if(flip == 1){
-        int i2 = N-i;
-        int j2 = j;
-        extBoundary[SCB_3D_INDEX(i,j,s1,e1,ivar,N,nEl)] = extBuff[i2+(N+1)*j2];
-      }
-      else if(flip == 2){
-        int i2 = N-i;
-        int j2 = N-j;
-        extBoundary[SCB_3D_INDEX(i,j,s1,e1,ivar,N,nEl)] = extBuff[i2+(N+1)*j2];
-      }
-      else if(flip == 3){
-        int i2 = i;
-        int j2 = N-j;
-        extBoundary[SCB_3D_INDEX(i,j,s1,e1,ivar,N,nEl)] = extBuff[i2+(N+1)*j2];
-      }
-      else if(flip == 4){
-        int i2 = j;
-        int j2 = i;
-        extBoundary[SCB_3D_INDEX(i,j,s1,e1,ivar,N,nEl)] = extBuff[i2+(N+1)*j2];
-      }
-      else if(flip == 5){
-        int i2 = N-j;
-        int j2 = i;
-        extBoundary[SCB_3D_INDEX(i,j,s1,e1,ivar,N,nEl)] = extBuff[i2+(N+1)*j2];
-      }
-      else if(flip == 6){
-        int i2 = N-j;
-        int j2 = N-i;
-        extBoundary[SCB_3D_INDEX(i,j,s1,e1,ivar,N,nEl)] = extBuff[i2+(N+1)*j2];
-      }
-      else if(flip == 7){
-        int i2 = j;
-        int j2 = N-i;
-        extBoundary[SCB_3D_INDEX(i,j,s1,e1,ivar,N,nEl)] = extBuff[i2+(N+1)*j2];    
-      }
+extern "C"
+{
+  void PackHalo_3D_gpu(real *sendBuffer, real *boundary, int *haloSide, int *haloElem, int nHaloSides, int N, int nVar, int nEl)
+  {
+    int ndof = (N+1)*(N+1)*nVar*nHaloSides;
+    if(ndof == 0) return;
+    int threads_per_block = 256;
+    int nblocks_x = ndof/threads_per_block + 1;
+
+    PackHalo_3D<<<dim3(nblocks_x,1,1), dim3(threads_per_block,1,1), 0, 0>>>(sendBuffer, boundary, haloSide, haloElem, nHaloSides, N, nVar, nEl);
+    // The send buffer is handed to MPI next, so the packing must be complete
+#ifdef __HIP_PLATFORM_AMD__
+    CHECK(hipDeviceSynchronize());
+#else
+    CHECK(cudaDeviceSynchronize());
+#endif
+  }
+}
+
+__global__ void UnpackHalo_3D(real *extBoundary, real *recvBuffer, int *haloSide, int *haloElem, int *haloFlip, int nHaloSides, int N, int nVar, int nEl){
+
+  uint32_t idof = threadIdx.x + blockIdx.x*blockDim.x;
+  uint32_t ndof = (N+1)*(N+1)*nVar*nHaloSides;
+
+  if(idof < ndof){
+    int i = idof % (N+1);
+    int j = (idof/(N+1)) % (N+1);
+    uint32_t ivar = (idof/(N+1)/(N+1)) % nVar;
+    uint32_t ihalo = idof/(N+1)/(N+1)/nVar;
+    int s1 = haloSide[ihalo]-1;
+    int e1 = haloElem[ihalo]-1;
+    int i2 = i;
+    int j2 = j;
+
+    switch(haloFlip[ihalo]){
+      case 1: i2 = N-i; j2 = j;   break;
+      case 2: i2 = N-i; j2 = N-j; break;
+      case 3: i2 = i;   j2 = N-j; break;
+      case 4: i2 = j;   j2 = i;   break;
+      case 5: i2 = N-j; j2 = i;   break;
+      case 6: i2 = N-j; j2 = N-i; break;
+      case 7: i2 = j;   j2 = N-i; break;
+      default: break;
     }
+    extBoundary[SCB_3D_INDEX(i,j,s1,e1,ivar,N,nEl)] = recvBuffer[i2+(N+1)*(j2+(N+1)*(ivar + nVar*ihalo))];
   }
-  
+
 }
 
 extern "C"
 {
-  void ApplyFlip_3D_gpu(real *extBoundary, int *sideInfo, int *elemToRank, int rankId, int offset, int N, int nVar, int nEl)
+  void UnpackHalo_3D_gpu(real *extBoundary, real *recvBuffer, int *haloSide, int *haloElem, int *haloFlip, int nHaloSides, int N, int nVar, int nEl)
   {
-    dim3 nblocks(6,nEl,nVar);
-    dim3 nthreads(N+1,N+1,1);
-    ApplyFlip_3D<<<nblocks,nthreads>>>(extBoundary, sideInfo, elemToRank, rankId, offset, N, nVar, nEl);
+    int ndof = (N+1)*(N+1)*nVar*nHaloSides;
+    if(ndof == 0) return;
+    int threads_per_block = 256;
+    int nblocks_x = ndof/threads_per_block + 1;
+
+    UnpackHalo_3D<<<dim3(nblocks_x,1,1), dim3(threads_per_block,1,1), 0, 0>>>(extBoundary, recvBuffer, haloSide, haloElem, haloFlip, nHaloSides, N, nVar, nEl);
   }
 }
 
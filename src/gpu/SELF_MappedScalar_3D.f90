@@ -43,7 +43,8 @@ module SELF_MappedScalar_3D
 
     procedure,public :: SetInteriorFromEquation => SetInteriorFromEquation_MappedScalar3D
 
-    procedure,public :: SideExchange => SideExchange_MappedScalar3D
+    procedure,public :: SideExchangeBegin => SideExchangeBegin_MappedScalar3D
+    procedure,public :: SideExchangeEnd => SideExchangeEnd_MappedScalar3D
     procedure,private :: MPIExchangeAsync => MPIExchangeAsync_MappedScalar3D
 
     generic,public :: MappedGradient => MappedGradient_MappedScalar3D
@@ -189,63 +190,26 @@ contains
   endsubroutine SetInteriorFromEquation_MappedScalar3D
 
   subroutine MPIExchangeAsync_MappedScalar3D(this,mesh)
+    !! Packs the halo sides into the device send buffer and posts one send and
+    !! one receive per neighbor rank
     implicit none
     class(MappedScalar3D),intent(inout) :: this
     type(Mesh3D),intent(inout) :: mesh
     ! Local
-    integer :: e1,s1,e2,s2,ivar
-    integer :: globalSideId,r2,tag
-    integer :: iError
-    integer :: msgCount
-    real(prec),pointer :: boundary(:,:,:,:,:)
-    real(prec),pointer :: extboundary(:,:,:,:,:)
-
-    msgCount = 0
-    call c_f_pointer(this%boundary_gpu,boundary,[this%interp%N+1,this%interp%N+1,6,this%nelem,this%nvar])
-    call c_f_pointer(this%extboundary_gpu,extboundary,[this%interp%N+1,this%interp%N+1,6,this%nelem,this%nvar])
-
-    do ivar = 1,this%nvar
-      do e1 = 1,this%nElem
-        do s1 = 1,6
-
-          e2 = mesh%sideInfo(3,s1,e1) ! Neighbor Element
-          if(e2 > 0) then
-            r2 = mesh%decomp%elemToRank(e2) ! Neighbor Rank
-
-            if(r2 /= mesh%decomp%rankId) then
-
-              s2 = mesh%sideInfo(4,s1,e1)/10
-              globalSideId = abs(mesh%sideInfo(2,s1,e1))
-              ! create unique tag for each side and each variable
-              tag = globalsideid+mesh%nUniqueSides*(ivar-1)
-
-              msgCount = msgCount+1
-              call MPI_IRECV(extBoundary(:,:,s1,e1,ivar), &
-                             (this%interp%N+1)*(this%interp%N+1), &
-                             mesh%decomp%mpiPrec, &
-                             r2,tag, &
-                             mesh%decomp%mpiComm, &
-                             mesh%decomp%requests(msgCount),iError)
-
-              msgCount = msgCount+1
-              call MPI_ISEND(boundary(:,:,s1,e1,ivar), &
-                             (this%interp%N+1)*(this%interp%N+1), &
-                             mesh%decomp%mpiPrec, &
-                             r2,tag, &
-                             mesh%decomp%mpiComm, &
-                             mesh%decomp%requests(msgCount),iError)
-            endif
-          endif
+    integer :: nPerSide
 
-        enddo
-      enddo
-    enddo
-
-    mesh%decomp%msgCount = msgCount
+    nPerSide = (this%interp%N+1)*(this%interp%N+1)*this%nvar
+    call mesh%decomp%ReserveHaloBuffers(nPerSide*mesh%decomp%nHaloSides)
+    call PackHalo_3D_gpu(mesh%decomp%sendBuffer_gpu,this%boundary_gpu, &
+                         mesh%decomp%haloSide_gpu,mesh%decomp%haloElem_gpu, &
+                         mesh%decomp%nHaloSides,this%interp%N,this%nvar,this%nElem)
+    call mesh%decomp%HaloExchangeAsync(nPerSide)
 
   endsubroutine MPIExchangeAsync_MappedScalar3D
 
-  subroutine SideExchange_MappedScalar3D(this,mesh)
+  subroutine SideExchangeBegin_MappedScalar3D(this,mesh)
+    !! Packs and posts the halo messages from the device buffers, then launches the
+    !! exchange for the sides shared by elements of this rank
     implicit none
     class(MappedScalar3D),intent(inout) :: this
     type(Mesh3D),intent(inout) :: mesh
@@ -262,15 +226,23 @@ contains
                              this%boundary_gpu,mesh%sideinfo_gpu,mesh%decomp%elemToRank_gpu, &
                              mesh%decomp%rankid,offset,this%interp%N,this%nvar,this%nelem)
 
+  endsubroutine SideExchangeBegin_MappedScalar3D
+
+  subroutine SideExchangeEnd_MappedScalar3D(this,mesh)
+    implicit none
+    class(MappedScalar3D),intent(inout) :: this
+    type(Mesh3D),intent(inout) :: mesh
+
     if(mesh%decomp%mpiEnabled) then
       call mesh%decomp%FinalizeMPIExchangeAsync()
-      ! Apply side flips for data exchanged with MPI
-      call ApplyFlip_3D_gpu(this%extboundary_gpu,mesh%sideInfo_gpu, &
-                            mesh%decomp%elemToRank_gpu,mesh%decomp%rankId, &
-                            offset,this%interp%N,this%nVar,this%nElem)
+      ! Copy the received halo data into extBoundary, applying the side flips
+      call UnpackHalo_3D_gpu(this%extboundary_gpu,mesh%decomp%recvBuffer_gpu, &
+                             mesh%decomp%haloSide_gpu,mesh%decomp%haloElem_gpu, &
+                             mesh%decomp%haloFlip_gpu,mesh%decomp%nHaloSides, &
+                             this%interp%N,this%nvar,this%nElem)
     endif
 
-  endsubroutine SideExchange_MappedScalar3D
+  endsubroutine SideExchangeEnd_MappedScalar3D
 
   subroutine MappedGradient_MappedScalar3D(this,df)
   !! Calculates the gradient of a function using the strong form of the gradient
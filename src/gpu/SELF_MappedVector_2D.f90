@@ -48,6 +48,12 @@ module SELF_MappedVector_2D
     generic,public :: MappedDGDivergence => MappedDGDivergence_MappedVector2D
     procedure,private :: MappedDGDivergence_MappedVector2D
 
+    generic,public :: MappedDGDivergenceVolume => MappedDGDivergenceVolume_MappedVector2D
+    procedure,private :: MappedDGDivergenceVolume_MappedVector2D
+
+    generic,public :: MappedDGDivergenceSurface => MappedDGDivergenceSurface_MappedVector2D
+    procedure,private :: MappedDGDivergenceSurface_MappedVector2D
+
   endtype MappedVector2D
 
   interface
@@ -99,61 +105,20 @@ contains
   endsubroutine SetInteriorFromEquation_MappedVector2D
 
   subroutine MPIExchangeAsync_MappedVector2D(this,mesh)
+    !! Packs the halo sides into the device send buffer and posts one send and
+    !! one receive per neighbor rank
     implicit none
     class(MappedVector2D),intent(inout) :: this
     type(Mesh2D),intent(inout) :: mesh
     ! Local
-    integer :: e1,s1,e2,s2,ivar,idir
-    integer :: globalSideId,r2,tag
-    integer :: iError
-    integer :: msgCount
-    real(prec),pointer :: boundary(:,:,:,:,:)
-    real(prec),pointer :: extboundary(:,:,:,:,:)
-
-    msgCount = 0
-    call c_f_pointer(this%boundary_gpu,boundary,[this%interp%N+1,4,this%nelem,this%nvar,2])
-    call c_f_pointer(this%extboundary_gpu,extboundary,[this%interp%N+1,4,this%nelem,this%nvar,2])
-
-    do idir = 1,2
-      do ivar = 1,this%nvar
-        do e1 = 1,this%nElem
-          do s1 = 1,4
-
-            e2 = mesh%sideInfo(3,s1,e1) ! Neighbor Element
-            if(e2 > 0) then
-              r2 = mesh%decomp%elemToRank(e2) ! Neighbor Rank
-
-              if(r2 /= mesh%decomp%rankId) then
-
-                s2 = mesh%sideInfo(4,s1,e1)/10
-                globalSideId = abs(mesh%sideInfo(2,s1,e1))
-                ! create unique tag for each side and each variable
-                tag = globalsideid+mesh%nUniqueSides*(ivar-1+this%nvar*(idir-1))
-
-                msgCount = msgCount+1
-                call MPI_IRECV(extBoundary(:,s1,e1,ivar,idir), &
-                               (this%interp%N+1), &
-                               mesh%decomp%mpiPrec, &
-                               r2,tag, &
-                               mesh%decomp%mpiComm, &
-                               mesh%decomp%requests(msgCount),iError)
-
-                msgCount = msgCount+1
-                call MPI_ISEND(boundary(:,s1,e1,ivar,idir), &
-                               (this%interp%N+1), &
-                               mesh%decomp%mpiPrec, &
-                               r2,tag, &
-                               mesh%decomp%mpiComm, &
-                               mesh%decomp%requests(msgCount),iError)
-              endif
-            endif
-
-          enddo
-        enddo
-      enddo
-    enddo
+    integer :: nPerSide
 
-    mesh%decomp%msgCount = msgCount
+    nPerSide = (this%interp%N+1)*2*this%nvar
+    call mesh%decomp%ReserveHaloBuffers(nPerSide*mesh%decomp%nHaloSides)
+    call PackHalo_2D_gpu(mesh%decomp%sendBuffer_gpu,this%boundary_gpu, &
+                         mesh%decomp%haloSide_gpu,mesh%decomp%haloElem_gpu, &
+                         mesh%decomp%nHaloSides,this%interp%N,2*this%nvar,this%nElem)
+    call mesh%decomp%HaloExchangeAsync(nPerSide)
 
   endsubroutine MPIExchangeAsync_MappedVector2D
 
@@ -181,10 +146,11 @@ contains
 
     if(mesh%decomp%mpiEnabled) then
       call mesh%decomp%FinalizeMPIExchangeAsync()
-      ! Apply side flips for data exchanged with MPI
-      call ApplyFlip_2D_gpu(this%extboundary_gpu,mesh%sideInfo_gpu, &
-                            mesh%decomp%elemToRank_gpu,mesh%decomp%rankId, &
-                            offset,this%interp%N,2*this%nVar,this%nElem)
+      ! Copy the received halo data into extBoundary, applying the side flips
+      call UnpackHalo_2D_gpu(this%extboundary_gpu,mesh%decomp%recvBuffer_gpu, &
+                             mesh%decomp%haloSide_gpu,mesh%decomp%haloElem_gpu, &
+                             mesh%decomp%haloFlip_gpu,mesh%decomp%nHaloSides, &
+                             this%interp%N,2*this%nvar,this%nElem)
     endif
 
   endsubroutine SideExchange_MappedVector2D
@@ -228,4 +194,31 @@ contains
 
   endsubroutine MappedDGDivergence_MappedVector2D
 
+  subroutine MappedDGDivergenceVolume_MappedVector2D(this,df)
+    implicit none
+    class(MappedVector2D),intent(inout) :: this
+    type(c_ptr),intent(inout) :: df
+
+    ! Contravariant projection
+    call ContravariantProjection_2D_gpu(this%interior_gpu, &
+                                        this%geometry%dsdx%interior_gpu,this%interp%N,this%nvar,this%nelem)
+
+    call Divergence_2D_gpu(this%interior_gpu,df,this%interp%dgMatrix_gpu, &
+                           this%interp%N,this%nvar,this%nelem)
+
+  endsubroutine MappedDGDivergenceVolume_MappedVector2D
+
+  subroutine MappedDGDivergenceSurface_MappedVector2D(this,df)
+    implicit none
+    class(MappedVector2D),intent(inout) :: this
+    type(c_ptr),intent(inout) :: df
+
+    ! Boundary terms
+    call DG_BoundaryContribution_2D_gpu(this%interp%bmatrix_gpu,this%interp%qweights_gpu, &
+                                        this%boundarynormal_gpu,df,this%interp%N,this%nvar,this%nelem)
+
+    call JacobianWeight_2D_gpu(df,this%geometry%J%interior_gpu,this%interp%N,this%nVar,this%nelem)
+
+  endsubroutine MappedDGDivergenceSurface_MappedVector2D
+
 endmodule SELF_MappedVector_2D
@@ -47,6 +47,12 @@ module SELF_MappedVector_3D
     generic,public :: MappedDGDivergence => MappedDGDivergence_MappedVector3D
     procedure,private :: MappedDGDivergence_MappedVector3D
 
+    generic,public :: MappedDGDivergenceVolume => MappedDGDivergenceVolume_MappedVector3D
+    procedure,private :: MappedDGDivergenceVolume_MappedVector3D
+
+    generic,public :: MappedDGDivergenceSurface => MappedDGDivergenceSurface_MappedVector3D
+    procedure,private :: MappedDGDivergenceSurface_MappedVector3D
+
     procedure,public :: SetInteriorFromEquation => SetInteriorFromEquation_MappedVector3D
 
   endtype MappedVector3D
@@ -106,61 +112,20 @@ contains
   endsubroutine SetInteriorFromEquation_MappedVector3D
 
   subroutine MPIExchangeAsync_MappedVector3D(this,mesh)
+    !! Packs the halo sides into the device send buffer and posts one send and
+    !! one receive per neighbor rank
     implicit none
     class(MappedVector3D),intent(inout) :: this
     type(Mesh3D),intent(inout) :: mesh
     ! Local
-    integer :: e1,s1,e2,s2,ivar,idir
-    integer :: globalSideId,r2,tag
-    integer :: iError
-    integer :: msgCount
-    real(prec),pointer :: boundary(:,:,:,:,:,:)
-    real(prec),pointer :: extboundary(:,:,:,:,:,:)
-
-    msgCount = 0
-    call c_f_pointer(this%boundary_gpu,boundary,[this%interp%N+1,this%interp%N+1,6,this%nelem,this%nvar,3])
-    call c_f_pointer(this%extboundary_gpu,extboundary,[this%interp%N+1,this%interp%N+1,6,this%nelem,this%nvar,3])
-
-    do idir = 1,3
-      do ivar = 1,this%nvar
-        do e1 = 1,this%nElem
-          do s1 = 1,6
-
-            e2 = mesh%sideInfo(3,s1,e1) ! Neighbor Element
-            if(e2 > 0) then
-              r2 = mesh%decomp%elemToRank(e2) ! Neighbor Rank
-
-              if(r2 /= mesh%decomp%rankId) then
-
-                s2 = mesh%sideInfo(4,s1,e1)/10
-                globalSideId = abs(mesh%sideInfo(2,s1,e1))
-                ! create unique tag for each side and each variable
-                tag = globalsideid+mesh%nUniqueSides*(ivar-1+this%nvar*(idir-1))
-
-                msgCount = msgCount+1
-                call MPI_IRECV(extBoundary(:,:,s1,e1,ivar,idir), &
-                               (this%interp%N+1)*(this%interp%N+1), &
-                               mesh%decomp%mpiPrec, &
-                               r2,tag, &
-                               mesh%decomp%mpiComm, &
-                               mesh%decomp%requests(msgCount),iError)
-
-                msgCount = msgCount+1
-                call MPI_ISEND(boundary(:,:,s1,e1,ivar,idir), &
-                               (this%interp%N+1)*(this%interp%N+1), &
-                               mesh%decomp%mpiPrec, &
-                               r2,tag, &
-                               mesh%decomp%mpiComm, &
-                               mesh%decomp%requests(msgCount),iError)
-              endif
-            endif
-
-          enddo
-        enddo
-      enddo
-    enddo
+    integer :: nPerSide
 
-    mesh%decomp%msgCount = msgCount
+    nPerSide = (this%interp%N+1)*(this%interp%N+1)*3*this%nvar
+    call mesh%decomp%ReserveHaloBuffers(nPerSide*mesh%decomp%nHaloSides)
+    call PackHalo_3D_gpu(mesh%decomp%sendBuffer_gpu,this%boundary_gpu, &
+                         mesh%decomp%haloSide_gpu,mesh%decomp%haloElem_gpu, &
+                         mesh%decomp%nHaloSides,this%interp%N,3*this%nvar,this%nElem)
+    call mesh%decomp%HaloExchangeAsync(nPerSide)
 
   endsubroutine MPIExchangeAsync_MappedVector3D
 
@@ -182,10 +147,11 @@ contains
 
     if(mesh%decomp%mpiEnabled) then
       call mesh%decomp%FinalizeMPIExchangeAsync()
-      ! Apply side flips for data exchanged with MPI
-      call ApplyFlip_3D_gpu(this%extboundary_gpu,mesh%sideInfo_gpu, &
-                            mesh%decomp%elemToRank_gpu,mesh%decomp%rankId, &
-                            offset,this%interp%N,3*this%nVar,this%nElem)
+      ! Copy the received halo data into extBoundary, applying the side flips
+      call UnpackHalo_3D_gpu(this%extboundary_gpu,mesh%decomp%recvBuffer_gpu, &
+                             mesh%decomp%haloSide_gpu,mesh%decomp%haloElem_gpu, &
+                             mesh%decomp%haloFlip_gpu,mesh%decomp%nHaloSides, &
+                             this%interp%N,3*this%nvar,this%nElem)
     endif
 
   endsubroutine SideExchange_MappedVector3D
@@ -233,4 +199,31 @@ contains
 
   endsubroutine MappedDGDivergence_MappedVector3D
 
+  subroutine MappedDGDivergenceVolume_MappedVector3D(this,df)
+    implicit none
+    class(MappedVector3D),intent(inout) :: this
+    type(c_ptr),intent(inout) :: df
+
+    ! Contravariant projection
+    call ContravariantProjection_3D_gpu(this%interior_gpu, &
+                                        this%geometry%dsdx%interior_gpu,this%interp%N,this%nvar,this%nelem)
+
+    call Divergence_3D_gpu(this%interior_gpu,df,this%interp%dgMatrix_gpu, &
+                           this%interp%N,this%nvar,this%nelem)
+
+  endsubroutine MappedDGDivergenceVolume_MappedVector3D
+
+  subroutine MappedDGDivergenceSurface_MappedVector3D(this,df)
+    implicit none
+    class(MappedVector3D),intent(inout) :: this
+    type(c_ptr),intent(inout) :: df
+
+    ! Boundary terms
+    call DG_BoundaryContribution_3D_gpu(this%interp%bmatrix_gpu,this%interp%qweights_gpu, &
+                                        this%boundarynormal_gpu,df,this%interp%N,this%nvar,this%nelem)
+
+    call JacobianWeight_3D_gpu(df,this%geometry%J%interior_gpu,this%interp%N,this%nVar,this%nelem)
+
+  endsubroutine MappedDGDivergenceSurface_MappedVector3D
+
 endmodule SELF_MappedVector_3D
@@ -10,111 +10,103 @@ __global__ void UpdateSolution_Model(real *solution, real *dSdt, real dt, uint32
 
 }
 
-__global__ void UpdateGAB2_Model(real *prevsol, real *solution, int m, uint32_t ndof){
+__global__ void UpdateGRK_Model(real *grk, real *solution, real *source, real *fluxDivergence, real rk_a, real rk_g, real dt, uint32_t ndof){
 
   size_t i = threadIdx.x + blockIdx.x*blockDim.x;
 
   if (i < ndof ){
+    // The tendency, source - fluxDivergence, is assembled here rather than stored in dSdt
+    grk[i] = rk_a*grk[i] + source[i] - fluxDivergence[i];
+    solution[i] += rk_g*dt*grk[i];
+  }
 
-    if( m == 0 ){
-
-      prevsol[i] = solution[i];
-
-    }
-    else if( m == 1 ) {
-
-      solution[i] = prevsol[i];
-
-    }
-    else if( m == 2 ) {
-
-      prevsol[i + ndof] = prevsol[i];
-      prevsol[i] = solution[i];
-      solution[i] = 1.5*prevsol[i]-0.5*prevsol[i+ndof];
+}
 
-    }
+// Weights of the stage slots for the embedded Runge-Kutta updates, passed by value
+#define SELF_ERK_MAX_STAGES 8
+typedef struct {
+  real w[SELF_ERK_MAX_STAGES];
+  int n;
+} erk_weights;
+
+static erk_weights PackERKWeights(real *w, int nw){
+  erk_weights weights;
+  weights.n = nw;
+  for(int m = 0; m < nw; m++){
+    weights.w[m] = w[m];
   }
-
+  return weights;
 }
 
-__global__ void UpdateGAB3_Model(real *prevsol, real *solution, int m, uint32_t ndof){
+__global__ void StoreERKStage_Model(real *stages, real *src, int m, uint32_t ndof){
 
   size_t i = threadIdx.x + blockIdx.x*blockDim.x;
 
   if (i < ndof ){
-
-    if( m == 0 ){
-
-      prevsol[i+ndof] = solution[i];
-
-    }
-    else if( m == 1 ){
-
-      prevsol[i] = solution[i];
-
-    }
-    else if( m == 2 ) {
-
-      solution[i] = prevsol[i];
-
-    }
-    else {
-
-      prevsol[i+2*ndof] = prevsol[i+ndof];
-      prevsol[i+ndof] = prevsol[i];
-      solution[i] = (23.0*prevsol[i]-16.0*prevsol[i+ndof] + 5.0*prevsol[i+2*ndof])/12.0;
-
-    }
+    stages[i+(size_t)m*ndof] = src[i];
   }
 
 }
 
-__global__ void UpdateGAB4_Model(real *prevsol, real *solution, int m, uint32_t ndof){
+__global__ void UpdateERK_Model(real *solution, real *stages, erk_weights w, uint32_t ndof){
 
   size_t i = threadIdx.x + blockIdx.x*blockDim.x;
 
   if (i < ndof ){
-
-    if( m == 0 ){
-
-      prevsol[i+2*ndof] = solution[i];
-
+    real s = stages[i];
+    for(int m = 0; m < w.n; m++){
+      s += w.w[m]*stages[i+(size_t)(m+1)*ndof];
     }
-    else if( m == 1 ){
+    solution[i] = s;
+  }
 
-      prevsol[i+ndof] = solution[i];
+}
 
-    }
-    else if( m == 2 ){
+// Each block writes the sum of the squared, scaled error estimates
+// over its degrees of freedom to partial[blockIdx.x]
+template <int blockSize>
+__global__ void ERKErrorNorm_Model(real *partial, real *solution, real *stages, erk_weights w, real abstol, real reltol, uint32_t ndof){
 
-      prevsol[i] = solution[i];
+  __shared__ real e2[blockSize];
+  size_t i = threadIdx.x + blockIdx.x*blockDim.x;
 
+  e2[threadIdx.x] = 0.0;
+  if (i < ndof ){
+    real e = 0.0;
+    for(int m = 0; m < w.n; m++){
+      e += w.w[m]*stages[i+(size_t)(m+1)*ndof];
     }
-    else if( m == 3 ) {
-
-      solution[i] = prevsol[i];
+    real sc = abstol + reltol*fmax(fabs(stages[i]),fabs(solution[i]));
+    e2[threadIdx.x] = (e/sc)*(e/sc);
+  }
+  __syncthreads();
 
+  for(int s = blockSize/2; s > 0; s >>= 1){
+    if(threadIdx.x < s){
+      e2[threadIdx.x] += e2[threadIdx.x+s];
     }
-    else {
-
-
-      prevsol[i+3*ndof] = prevsol[i+2*ndof];
-      prevsol[i+2*ndof] = prevsol[i+ndof];
-      prevsol[i+ndof] = prevsol[i];
-      solution[i] = (55.0*prevsol[i]-59.0*prevsol[i+ndof]+37.0*prevsol[i+2*ndof]-9.0*prevsol[i+3*ndof])/24.0;
+    __syncthreads();
+  }
 
-    }
+  if(threadIdx.x == 0){
+    partial[blockIdx.x] = e2[0];
   }
 
 }
 
-__global__ void UpdateGRK_Model(real *grk, real *solution, real *dSdt, real rk_a, real rk_g, real dt, uint32_t ndof){
+// The Adams-Bashforth tendency history is a ring buffer of w.n slots; the tendency
+// is stored in slot head and replaced with the weighted sum of all slots
+__global__ void UpdateGAB_Model(real *history, real *dSdt, erk_weights w, int head, uint32_t ndof){
 
   size_t i = threadIdx.x + blockIdx.x*blockDim.x;
 
   if (i < ndof ){
-    grk[i] = rk_a*grk[i] + dSdt[i];
-    solution[i] += rk_g*dt*grk[i];
+    history[i+(size_t)head*ndof] = dSdt[i];
+    real s = 0.0;
+    for(int m = 0; m < w.n; m++){
+      s += w.w[m]*history[i+(size_t)m*ndof];
+    }
+    dSdt[i] = s;
   }
 
 }
@@ -141,11 +133,51 @@ extern "C"
 
 extern "C"
 {
-  void UpdateGRK_gpu(real *grk, real *solution, real *dSdt, real rk_a, real rk_g, real dt, int ndof)
+  void UpdateGRK_gpu(real *grk, real *solution, real *source, real *fluxDivergence, real rk_a, real rk_g, real dt, int ndof)
+  {
+    uint32_t nthreads = 256;
+    uint32_t nblocks_x = ndof/nthreads + 1;
+    UpdateGRK_Model<<<dim3(nblocks_x,1), dim3(nthreads,1,1), 0, 0>>>(grk, solution, source, fluxDivergence, rk_a, rk_g, dt, ndof);
+  }
+}
+
+extern "C"
+{
+  void StoreERKStage_gpu(real *stages, real *src, int m, int ndof)
+  {
+    uint32_t nthreads = 256;
+    uint32_t nblocks_x = ndof/nthreads + 1;
+    StoreERKStage_Model<<<dim3(nblocks_x,1), dim3(nthreads,1,1), 0, 0>>>(stages, src, m, ndof);
+  }
+}
+
+extern "C"
+{
+  void UpdateERK_gpu(real *solution, real *stages, real *w, int nw, int ndof)
+  {
+    uint32_t nthreads = 256;
+    uint32_t nblocks_x = ndof/nthreads + 1;
+    UpdateERK_Model<<<dim3(nblocks_x,1), dim3(nthreads,1,1), 0, 0>>>(solution, stages, PackERKWeights(w,nw), ndof);
+  }
+}
+
+extern "C"
+{
+  void ERKErrorNorm_gpu(real *partial, real *solution, real *stages, real *w, int nw, real abstol, real reltol, int ndof)
+  {
+    uint32_t nthreads = 256;
+    uint32_t nblocks_x = ndof/nthreads + 1;
+    ERKErrorNorm_Model<256><<<dim3(nblocks_x,1), dim3(nthreads,1,1), 0, 0>>>(partial, solution, stages, PackERKWeights(w,nw), abstol, reltol, ndof);
+  }
+}
+
+extern "C"
+{
+  void UpdateGAB_gpu(real *history, real *dSdt, real *w, int nw, int head, int ndof)
   {
     uint32_t nthreads = 256;
     uint32_t nblocks_x = ndof/nthreads + 1;
-    UpdateGRK_Model<<<dim3(nblocks_x,1), dim3(nthreads,1,1), 0, 0>>>(grk, solution, dSdt, rk_a, rk_g, dt, ndof);
+    UpdateGAB_Model<<<dim3(nblocks_x,1), dim3(nthreads,1,1), 0, 0>>>(history, dSdt, PackERKWeights(w,nw), head, ndof);
   }
 }
 
@@ -0,0 +1,129 @@
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+!
+! Maintainers : support@fluidnumerics.com
+! Official Repository : https://github.com/FluidNumerics/self/
+!
+! Copyright © 2024 Fluid Numerics LLC
+!
+! Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+!
+! 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+!
+! 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in
+!    the documentation and/or other materials provided with the distribution.
+!
+! 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from
+!    this software without specific prior written permission.
+!
+! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+! LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+! HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+! LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+! THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+! THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+
+program advection_diffusion_1d_mrab3
+
+  use self_data
+  use self_advection_diffusion_1d
+
+  implicit none
+  integer,parameter :: controlDegree = 7
+  integer,parameter :: targetDegree = 16
+  real(prec),parameter :: u = 1.0_prec ! velocity
+  real(prec),parameter :: cfl = 0.25_prec ! within the stability region of ab3
+  integer,parameter :: maxLevels = 3
+  real(prec),parameter :: endtime = 0.2_prec
+  real(prec),parameter :: tolerance = 1.0e-4_prec
+  ! The mesh is refined by 2 and then 4 around x = 0.5
+  integer,parameter :: nelem = 56
+  real(prec),parameter :: h(1:5) = (/0.025_prec,0.0125_prec,0.00625_prec,0.0125_prec,0.025_prec/)
+  integer,parameter :: nh(1:5) = (/16,4,16,4,16/)
+  real(prec) :: dt,maxdiff
+  real(prec),allocatable :: s0(:,:,:),sref(:,:,:)
+  integer :: iel,ih,ie
+  type(advection_diffusion_1d) :: modelobj
+  type(Lagrange),target :: interp
+  type(Mesh1D),target :: mesh
+  type(Geometry1D),target :: geometry
+
+  ! Create a uniform mesh and move its nodes to the graded element sizes
+  call mesh%StructuredMesh(nElem=nelem, &
+                           x=(/0.0_prec,1.0_prec/))
+  iel = 0
+  do ih = 1,5
+    do ie = 1,nh(ih)
+      iel = iel+1
+      mesh%nodeCoords(2*iel) = mesh%nodeCoords(2*iel-1)+h(ih)
+      if(iel < nelem) mesh%nodeCoords(2*iel+1) = mesh%nodeCoords(2*iel)
+    enddo
+  enddo
+
+  ! Create an interpolant
+  call interp%Init(N=controlDegree, &
+                   controlNodeType=GAUSS, &
+                   M=targetDegree, &
+                   targetNodeType=UNIFORM)
+
+  ! Generate geometry (metric terms) from the mesh elements
+  call geometry%Init(interp,mesh%nElem)
+  call geometry%GenerateFromMesh(mesh)
+
+  ! Initialize the model
+  call modelobj%Init(mesh,geometry)
+  modelobj%gradient_enabled = .false.
+  ! Set the velocity
+  modelobj%u = u
+  !Set the diffusivity
+  modelobj%nu = 0.0_prec
+
+  ! Set the initial condition, upstream of the refined region
+  call modelobj%solution%SetEquation(1,'f = exp( -( (x-0.35)^2 )/0.0025 )')
+  call modelobj%solution%SetInteriorFromEquation(0.0_prec)
+  s0 = modelobj%solution%interior
+
+  ! Reference solution, with every element stepping at the step size of the smallest ones
+  dt = modelobj%ComputeStableDt(cfl)
+  call modelobj%SetTimeIntegrator('ab3')
+  call modelobj%ForwardStep(endtime,dt,endtime)
+  sref = modelobj%solution%interior
+
+  ! Multirate solution
+  modelobj%solution%interior = s0
+  call modelobj%solution%UpdateDevice()
+  modelobj%t = 0.0_prec
+  call modelobj%SetTimeIntegrator('mrab3')
+  call modelobj%SetMultirateLevels(cfl,maxLevels)
+  if(modelobj%lts_nlevels /= maxLevels) then
+    print*,"Error: Expected ",maxLevels," rate levels, found ",modelobj%lts_nlevels
+    stop 1
+  endif
+  if(abs(modelobj%dt-dt) > epsilon(1.0_prec)*dt) then
+    print*,"Error: The fastest level time step ",modelobj%dt," differs from the stable time step ",dt
+    stop 1
+  endif
+  call modelobj%ForwardStep(endtime,modelobj%dt,endtime)
+
+  call modelobj%solution%UpdateHost()
+  maxdiff = maxval(abs(modelobj%solution%interior-sref))
+  print*,"max difference from the single rate solution : ",maxdiff
+
+  ! Written so that a NaN solution also fails the test
+  if(.not.(maxval(abs(sref)) <= 1.0_prec)) then
+    print*,"Error: Single rate solution is unstable, max |s| = ",maxval(abs(sref))
+    stop 1
+  endif
+  if(.not.(maxdiff <= tolerance)) then
+    print*,"Error: Multirate solution differs from the single rate solution by ",maxdiff
+    stop 1
+  endif
+
+  ! Clean up
+  call modelobj%free()
+  call mesh%free()
+  call geometry%free()
+  call interp%free()
+
+endprogram advection_diffusion_1d_mrab3
@@ -0,0 +1,115 @@
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+!
+! Maintainers : support@fluidnumerics.com
+! Official Repository : https://github.com/FluidNumerics/self/
+!
+! Copyright © 2024 Fluid Numerics LLC
+!
+! Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+!
+! 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+!
+! 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in
+!    the documentation and/or other materials provided with the distribution.
+!
+! 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from
+!    this software without specific prior written permission.
+!
+! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+! LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+! HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+! LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+! THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+! THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+
+program advection_diffusion_1d_stabledt
+
+  use self_data
+  use self_advection_diffusion_1d
+
+  implicit none
+  integer,parameter :: nelem = 20
+  integer,parameter :: controlDegree = 7
+  integer,parameter :: targetDegree = 16
+  integer,parameter :: nsteps = 2000
+  real(prec),parameter :: u = 1.0_prec ! velocity
+  real(prec),parameter :: nu = 0.0_prec ! diffusivity
+  real(prec) :: e0,ef ! Initial and final entropy
+  real(prec) :: dt,rho
+  real(prec),allocatable :: s0(:,:,:)
+  type(advection_diffusion_1d) :: modelobj
+  type(Lagrange),target :: interp
+  type(Mesh1D),target :: mesh
+  type(Geometry1D),target :: geometry
+
+  ! Create a mesh using the built-in
+  ! uniform mesh generator.
+  ! The domain is set to x in [0,1]
+  ! We use `nelem` elements
+  call mesh%StructuredMesh(nElem=nelem, &
+                           x=(/0.0_prec,1.0_prec/))
+
+  ! Create an interpolant
+  call interp%Init(N=controlDegree, &
+                   controlNodeType=GAUSS, &
+                   M=targetDegree, &
+                   targetNodeType=UNIFORM)
+
+  ! Generate geometry (metric terms) from the mesh elements
+  call geometry%Init(interp,mesh%nElem)
+  call geometry%GenerateFromMesh(mesh)
+
+  ! Initialize the model
+  call modelobj%Init(mesh,geometry)
+  modelobj%tecplot_enabled = .false.
+  ! Set the velocity
+  modelobj%u = u
+  !Set the diffusivity
+  modelobj%nu = nu
+
+  ! Set the initial condition
+  call modelobj%solution%SetEquation(1,'f = exp( -( (x-0.5)^2 )/0.01 )')
+  call modelobj%solution%SetInteriorFromEquation(0.0_prec)
+  s0 = modelobj%solution%interior
+
+  call modelobj%CalculateEntropy()
+  e0 = modelobj%entropy
+
+  call modelobj%SetTimeIntegrator('rk3')
+  rho = modelobj%EstimateSpectralRadius()
+  dt = modelobj%EstimateStableDt()
+  print*,"spectral radius : ",rho
+  print*,"stable time step : ",dt,", cfl limit : ",modelobj%ComputeStableDt(1.0_prec)
+
+  ! Stepping at the estimated limit keeps the solution bounded
+  call modelobj%ForwardStep(nsteps*dt,dt,nsteps*dt)
+  ef = modelobj%entropy
+  print*,"entropy at the estimated limit : ",e0,ef
+  if(.not.(ef <= e0)) then
+    print*,"Error: Final entropy greater than initial entropy! ",e0,ef
+    stop 1
+  endif
+
+  ! Stepping 25% beyond the true limit is unstable. The entropy may overflow to NaN,
+  ! which is also counted as unstable
+  modelobj%solution%interior = s0
+  call modelobj%solution%UpdateDevice()
+  modelobj%t = 0.0_prec
+  dt = 1.25_prec*dt/0.95_prec
+  call modelobj%ForwardStep(nsteps*dt,dt,nsteps*dt)
+  ef = modelobj%entropy
+  print*,"entropy beyond the limit : ",e0,ef
+  if(ef <= e0) then
+    print*,"Error: Time step beyond the estimated limit is stable ",e0,ef
+    stop 1
+  endif
+
+  ! Clean up
+  call modelobj%free()
+  call mesh%free()
+  call geometry%free()
+  call interp%free()
+
+endprogram advection_diffusion_1d_stabledt
@@ -0,0 +1,128 @@
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+!
+! Maintainers : support@fluidnumerics.com
+! Official Repository : https://github.com/FluidNumerics/self/
+!
+! Copyright © 2024 Fluid Numerics LLC
+!
+! Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+!
+! 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+!
+! 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in
+!    the documentation and/or other materials provided with the distribution.
+!
+! 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from
+!    this software without specific prior written permission.
+!
+! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+! LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+! HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+! LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+! THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+! THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+
+program advection_diffusion_2d_rk3_compressed
+
+  use self_data
+  use self_advection_diffusion_2d
+
+  implicit none
+  character(SELF_INTEGRATOR_LENGTH),parameter :: integrator = 'rk3'
+  integer,parameter :: controlDegree = 7
+  integer,parameter :: targetDegree = 16
+  real(prec),parameter :: u = 0.25_prec ! velocity
+  real(prec),parameter :: v = 0.25_prec
+  real(prec),parameter :: nu = 0.005_prec ! diffusivity
+  real(prec),parameter :: dt = 1.0_prec*10.0_prec**(-4) ! time-step size
+  real(prec),parameter :: endtime = 0.01_prec
+  real(prec),parameter :: iointerval = 0.01_prec
+  real(prec),parameter :: tolerance = 10.0_prec**(-12)
+  type(advection_diffusion_2d) :: modelobj
+  type(Lagrange),target :: interp
+  type(Mesh2D),target :: mesh
+  type(SEMQuad),target :: geometry
+  character(LEN=255) :: WORKSPACE
+  real(prec),allocatable :: f(:,:,:)
+  integer :: contiguousSize,compressedSize
+
+  ! Create a uniform block mesh
+  call get_environment_variable("WORKSPACE",WORKSPACE)
+  call mesh%Read_HOPr(trim(WORKSPACE)//"/share/mesh/Block2D/Block2D_mesh.h5")
+
+  ! Create an interpolant
+  call interp%Init(N=controlDegree, &
+                   controlNodeType=GAUSS, &
+                   M=targetDegree, &
+                   targetNodeType=UNIFORM)
+
+  ! Generate geometry (metric terms) from the mesh elements
+  call geometry%Init(interp,mesh%nElem)
+  call geometry%GenerateFromMesh(mesh)
+
+  ! Initialize the model
+  call modelobj%Init(mesh,geometry)
+  modelobj%gradient_enabled = .true.
+  modelobj%tecplot_enabled = .false.
+
+  ! Set the velocity
+  modelobj%u = u
+  modelobj%v = v
+  !Set the diffusivity
+  modelobj%nu = nu
+
+  ! Set the initial condition
+  call modelobj%solution%SetEquation(1,'f = exp( -( (x-0.5)^2 + (y-0.5)^2 )/0.005 )')
+  call modelobj%solution%SetInteriorFromEquation(geometry,0.0_prec)
+
+  ! Set the model's time integration method
+  call modelobj%SetTimeIntegrator(integrator)
+
+  ! forward step the model to `endtime` using a time step
+  ! of `dt` and outputing model data every `iointerval`
+  call modelobj%ForwardStep(endtime,dt,iointerval)
+
+  ! Write the same state with the default (contiguous) storage and with chunked,
+  ! compressed storage. The mantissa rounding must not be applied to the pickup file.
+  call modelobj%WriteModel("advdiff2d-contiguous.pickup.h5")
+  modelobj%outputStorage%chunked = .true.
+  modelobj%outputStorage%chunkElems = 16
+  modelobj%outputStorage%shuffle = .true.
+  modelobj%outputStorage%deflateLevel = 6
+  modelobj%outputStorage%mantissaBits = 10
+  call modelobj%WriteModel("advdiff2d-compressed.pickup.h5")
+
+  inquire(file="advdiff2d-contiguous.pickup.h5",size=contiguousSize)
+  inquire(file="advdiff2d-compressed.pickup.h5",size=compressedSize)
+  print*,"file size (contiguous, compressed) : ",contiguousSize,compressedSize
+  if(compressedSize >= contiguousSize) then
+    print*,"Error: compressed pickup file is not smaller than the contiguous pickup file"
+    stop 1
+  endif
+
+  ! Keep the solution at the time of the write, then overwrite the model state;
+  ! reading the compressed pickup file must restore it exactly
+  call modelobj%solution%UpdateHost()
+  f = modelobj%solution%interior(:,:,:,1)
+  modelobj%solution%interior = 0.0_prec
+  call modelobj%solution%UpdateDevice()
+
+  call modelobj%ReadModel("advdiff2d-compressed.pickup.h5")
+  call modelobj%solution%UpdateHost()
+
+  print*,"max error : ",maxval(abs(f-modelobj%solution%interior(:,:,:,1)))
+  if(maxval(abs(f-modelobj%solution%interior(:,:,:,1))) > tolerance) then
+    print*,"Error: solution read from the compressed pickup file does not match"
+    stop 1
+  endif
+
+  ! Clean up
+  deallocate(f)
+  call modelobj%free()
+  call mesh%free()
+  call geometry%free()
+  call interp%free()
+
+endprogram advection_diffusion_2d_rk3_compressed
@@ -0,0 +1,137 @@
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+!
+! Maintainers : support@fluidnumerics.com
+! Official Repository : https://github.com/FluidNumerics/self/
+!
+! Copyright © 2024 Fluid Numerics LLC
+!
+! Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+!
+! 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+!
+! 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in
+!    the documentation and/or other materials provided with the distribution.
+!
+! 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from
+!    this software without specific prior written permission.
+!
+! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+! LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+! HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+! LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+! THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+! THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+
+program Euler3D_weakblastwave
+  !! Runs a weak blast wave in a closed box with the flux differencing Euler model
+  !! and checks that the total mass is conserved and that the total (mathematical)
+  !! entropy does not increase.
+  use self_data
+  use self_Euler3D
+  use self_mesh_3d
+
+  implicit none
+  character(SELF_INTEGRATOR_LENGTH),parameter :: integrator = 'rk3'
+
+  integer,parameter :: controlDegree = 3
+  integer,parameter :: targetDegree = 6
+  real(prec),parameter :: dt = 10.0_prec**(-3) ! time-step size
+  real(prec),parameter :: endtime = 0.05_prec
+  real(prec),parameter :: iointerval = 0.05_prec
+  real(prec) :: e0,ef ! Initial and final entropy
+  real(prec) :: m0,mf ! Initial and final mass
+  type(Euler3D) :: modelobj
+  type(Lagrange),target :: interp
+  integer :: bcids(1:6)
+  type(Mesh3D),target :: mesh
+  type(SEMHex),target :: geometry
+
+  ! Set no normal flow boundary conditions
+  bcids(1:6) = [SELF_BC_NONORMALFLOW, & ! Bottom
+                SELF_BC_NONORMALFLOW, & ! South
+                SELF_BC_NONORMALFLOW, & ! East
+                SELF_BC_NONORMALFLOW, & ! North
+                SELF_BC_NONORMALFLOW, & ! West
+                SELF_BC_NONORMALFLOW] ! Top
+
+  ! Create a uniform block mesh
+  call mesh%StructuredMesh(2,2,2, &
+                           2,2,2, &
+                           0.25_prec,0.25_prec,0.25_prec, &
+                           bcids)
+
+  ! Create an interpolant; flux differencing needs Gauss-Lobatto points
+  call interp%Init(N=controlDegree, &
+                   controlNodeType=GAUSS_LOBATTO, &
+                   M=targetDegree, &
+                   targetNodeType=UNIFORM)
+
+  ! Generate geometry (metric terms) from the mesh elements
+  call geometry%Init(interp,mesh%nElem)
+  call geometry%GenerateFromMesh(mesh)
+
+  ! Initialize the model
+  call modelobj%Init(mesh,geometry)
+  modelobj%prescribed_bcs_enabled = .false.
+  modelobj%tecplot_enabled = .false.
+
+  ! Set the initial condition
+  call modelobj%ThermalBubble(1.0_prec,0.1_prec,0.1_prec,1.0_prec,0.5_prec,0.1_prec,0.5_prec,0.5_prec,0.5_prec)
+
+  call Integrals(m0,e0)
+
+  ! Set the model's time integration method
+  call modelobj%SetTimeIntegrator(integrator)
+
+  ! forward step the model to `endtime` using a time step
+  ! of `dt` and outputing model data every `iointerval`
+  call modelobj%ForwardStep(endtime,dt,iointerval)
+
+  call modelobj%solution%UpdateHost()
+  call Integrals(mf,ef)
+  print*,"Mass : ",m0,mf
+  print*,"Entropy : ",e0,ef
+
+  if(abs(mf-m0) > 10.0_prec**(-5)*m0) then
+    print*,"Error: Mass is not conserved! ",m0,mf
+    stop 1
+  endif
+  if(.not.(ef <= e0)) then
+    print*,"Error: Final entropy greater than initial entropy! ",e0,ef
+    stop 1
+  endif
+
+  ! Clean up
+  call modelobj%free()
+  call mesh%free()
+  call geometry%free()
+  call interp%free()
+
+contains
+
+  subroutine Integrals(mass,entropy)
+    !! Quadrature of the density and of the entropy function over the domain
+    real(prec),intent(out) :: mass,entropy
+    ! Local
+    integer :: i,j,k,iel
+    real(prec) :: wJ
+
+    mass = 0.0_prec
+    entropy = 0.0_prec
+    do iel = 1,mesh%nElem
+      do k = 1,controlDegree+1
+        do j = 1,controlDegree+1
+          do i = 1,controlDegree+1
+            wJ = interp%qWeights(i)*interp%qWeights(j)*interp%qWeights(k)*geometry%J%interior(i,j,k,iel,1)
+            mass = mass+modelobj%solution%interior(i,j,k,iel,1)*wJ
+            entropy = entropy+modelobj%entropy_func(modelobj%solution%interior(i,j,k,iel,1:5))*wJ
+          enddo
+        enddo
+      enddo
+    enddo
+
+  endsubroutine Integrals
+
+endprogram Euler3D_weakblastwave
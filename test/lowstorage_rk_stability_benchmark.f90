@@ -0,0 +1,138 @@
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+!
+! Maintainers : support@fluidnumerics.com
+! Official Repository : https://github.com/FluidNumerics/self/
+!
+! Copyright © 2024 Fluid Numerics LLC
+!
+! Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+!
+! 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+!
+! 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in
+!    the documentation and/or other materials provided with the distribution.
+!
+! 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from
+!    this software without specific prior written permission.
+!
+! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+! LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+! HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+! LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+! THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+! THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+
+program test
+
+  implicit none
+  integer :: exit_code
+
+  exit_code = lowstorage_rk_stability_benchmark()
+  if(exit_code /= 0) then
+    stop exit_code
+  endif
+
+contains
+  integer function lowstorage_rk_stability_benchmark() result(r)
+    !! Finds the largest stable cfl number of each low storage Runge-Kutta method for
+    !! 1D advection with the upwind DG discretization, by bisection. A cfl number is taken
+    !! as stable when the entropy of a random initial condition does not grow over nSteps
+    !! time steps. The largest stable cfl number per stage, relative to rk3, is reported as
+    !! the gain in time step size per tendency evaluation; the test fails only if a method
+    !! is unstable at every cfl number tried.
+    use self_data
+    use self_advection_diffusion_1d
+
+    implicit none
+
+    integer,parameter :: nelem = 10
+    integer,parameter :: controlDegree = 7
+    integer,parameter :: targetDegree = 16
+    integer,parameter :: nSteps = 500
+    integer,parameter :: nBisect = 16
+    integer,parameter :: nSchemes = 8
+    character(SELF_INTEGRATOR_LENGTH),parameter :: schemes(1:nSchemes) = &
+      [character(SELF_INTEGRATOR_LENGTH) :: 'rk3','rk4','lsrk124','lsrk134','lsrk144', &
+      'lddrk73','lddrk84c','lddrk84f']
+    integer,parameter :: nStages(1:nSchemes) = (/3,5,12,13,14,7,8,8/)
+    type(advection_diffusion_1d) :: modelobj
+    type(Lagrange),target :: interp
+    type(Mesh1D),target :: mesh
+    type(Geometry1D),target :: geometry
+    real(prec),allocatable :: s0(:,:,:)
+    real(prec) :: dt1,e0,cflLo,cflHi,cfl,perStage,perStageRK3
+    integer :: ischeme,ib
+
+    r = 0
+
+    call mesh%StructuredMesh(nElem=nelem, &
+                             x=(/0.0_prec,1.0_prec/))
+
+    call interp%Init(N=controlDegree, &
+                     controlNodeType=GAUSS, &
+                     M=targetDegree, &
+                     targetNodeType=UNIFORM)
+
+    call geometry%Init(interp,mesh%nElem)
+    call geometry%GenerateFromMesh(mesh)
+
+    call modelobj%Init(mesh,geometry)
+    modelobj%u = 1.0_prec
+    modelobj%nu = 0.0_prec
+
+    allocate(s0(1:controlDegree+1,1:nelem,1:1))
+    call random_number(s0)
+    s0 = 2.0_prec*s0-1.0_prec
+
+    ! Time step size at a cfl number of one
+    dt1 = modelobj%ComputeStableDt(1.0_prec)
+
+    perStageRK3 = 1.0_prec
+    do ischeme = 1,nSchemes
+
+      call modelobj%SetTimeIntegrator(schemes(ischeme))
+
+      cflLo = 0.0_prec
+      cflHi = 4.0_prec*real(nStages(ischeme),prec)
+      do ib = 1,nBisect
+        cfl = 0.5_prec*(cflLo+cflHi)
+
+        ! The stage register is reset too, since an unstable attempt leaves NaNs in it
+        modelobj%solution%interior = s0
+        modelobj%workSol%interior = 0.0_prec
+        call modelobj%solution%UpdateDevice()
+        call modelobj%workSol%UpdateDevice()
+        call modelobj%CalculateEntropy()
+        e0 = modelobj%entropy
+
+        modelobj%t = 0.0_prec
+        modelobj%dt = cfl*dt1
+        call modelobj%timeIntegrator(real(nSteps,prec)*cfl*dt1)
+        call modelobj%CalculateEntropy()
+
+        ! Written so that a NaN entropy counts as unstable
+        if(modelobj%entropy <= e0) then
+          cflLo = cfl
+        else
+          cflHi = cfl
+        endif
+      enddo
+
+      perStage = cflLo/real(nStages(ischeme),prec)
+      if(ischeme == 1) perStageRK3 = perStage
+      print*,schemes(ischeme),", stages =",nStages(ischeme),", max stable cfl =",cflLo, &
+        ", cfl per stage =",perStage,", gain over rk3 =",perStage/perStageRK3
+      if(cflLo <= 0.0_prec) r = 1
+
+    enddo
+
+    deallocate(s0)
+    call modelobj%free()
+    call mesh%free()
+    call geometry%free()
+    call interp%free()
+
+  endfunction lowstorage_rk_stability_benchmark
+endprogram test
@@ -0,0 +1,115 @@
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+!
+! Maintainers : support@fluidnumerics.com
+! Official Repository : https://github.com/FluidNumerics/self/
+!
+! Copyright © 2024 Fluid Numerics LLC
+!
+! Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+!
+! 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+!
+! 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in
+!    the documentation and/or other materials provided with the distribution.
+!
+! 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from
+!    this software without specific prior written permission.
+!
+! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS” AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+! LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+! HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+! LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+! THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+! THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+!
+! //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////// !
+
+program test
+
+  implicit none
+  integer :: exit_code
+
+  exit_code = scalargridinterp_3d_benchmark()
+  if(exit_code /= 0) then
+    stop exit_code
+  endif
+
+contains
+  integer function scalargridinterp_3d_benchmark() result(r)
+    !! Compares the sum-factorized grid interpolation against a direct evaluation of the
+    !! tensor-product interpolant at every target point, with the target degree set to
+    !! twice the control degree. The wall-clock times of both are reported for each degree;
+    !! the test fails only if the two results disagree.
+    use SELF_Constants
+    use SELF_Lagrange
+    use SELF_Scalar_3D
+
+    implicit none
+
+    integer,parameter :: maxControlDegree = 7
+    integer,parameter :: nvar = 1
+    integer,parameter :: nelem = 50
+#ifdef DOUBLE_PRECISION
+    real(prec),parameter :: tolerance = 10.0_prec**(-10)
+#else
+    real(prec),parameter :: tolerance = 10.0_prec**(-4)
+#endif
+    type(Scalar3D) :: f
+    type(Lagrange),target :: interp
+    real(prec),allocatable :: fTarget(:,:,:,:,:)
+    real(prec),allocatable :: fDirect(:,:,:,:,:)
+    integer :: N,M,i,j,k,ii,jj,kk,iel,ivar
+    integer(8) :: t1,t2,clockRate
+    real(prec) :: fi,fij,fijk,tDirect,tFactored,err
+
+    r = 0
+    do N = 2,maxControlDegree
+      M = 2*N
+
+      call interp%Init(N=N, &
+                       controlNodeType=GAUSS, &
+                       M=M, &
+                       targetNodeType=UNIFORM)
+
+      call f%Init(interp,nvar,nelem)
+      allocate(fTarget(1:M+1,1:M+1,1:M+1,1:nelem,1:nvar), &
+               fDirect(1:M+1,1:M+1,1:M+1,1:nelem,1:nvar))
+
+      call random_number(f%interior)
+
+      call system_clock(t1,clockRate)
+      do concurrent(i=1:M+1,j=1:M+1,k=1:M+1,iel=1:nelem,ivar=1:nvar)
+        fijk = 0.0_prec
+        do kk = 1,N+1
+          fij = 0.0_prec
+          do jj = 1,N+1
+            fi = 0.0_prec
+            do ii = 1,N+1
+              fi = fi+f%interior(ii,jj,kk,iel,ivar)*interp%iMatrix(ii,i)
+            enddo
+            fij = fij+fi*interp%iMatrix(jj,j)
+          enddo
+          fijk = fijk+fij*interp%iMatrix(kk,k)
+        enddo
+        fDirect(i,j,k,iel,ivar) = fijk
+      enddo
+      call system_clock(t2)
+      tDirect = real(t2-t1,prec)/real(clockRate,prec)
+
+      call system_clock(t1)
+      call f%GridInterp(fTarget)
+      call system_clock(t2)
+      tFactored = real(t2-t1,prec)/real(clockRate,prec)
+
+      err = maxval(abs(fTarget-fDirect))
+      print*,"N =",N,", M =",M,", direct (s) =",tDirect,", sum-factorized (s) =",tFactored, &
+        ", absmax difference =",err
+      if(err > tolerance) r = 1
+
+      deallocate(fTarget,fDirect)
+      call f%free()
+      call interp%free()
+    enddo
+
+  endfunction scalargridinterp_3d_benchmark
+endprogram test